@@ -0,0 +1,215 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	engine
+File:	render_primitive_benchmark.cpp
+-------------------------------------------
+*/
+
+#include <chrono>
+#include <filesystem>
+#include <random>
+#include <sstream>
+#include <string_view>
+
+#include "Ion.h"
+
+using namespace std::string_view_literals;
+
+using namespace ion::graphics::render;
+using namespace ion::graphics::utilities;
+using namespace ion::types::type_literals;
+
+
+/*
+	Render primitive benchmark
+	--------------------------
+	Built and run by the render_primitive_benchmark project (project/render_primitive_benchmark.vcxproj), preferably in release.
+	Times the previous (per vertex matrix) transform and opacity paths against the current (block/SIMD) kernels,
+	on interleaved vertex data laid out like the engine's own vertex declarations.
+	Run once for each SIMD configuration (AVX2, SSE2 and ION_NO_SIMD).
+	The report is saved to the log path below, and the exit code is 0 if both paths gave identical results
+*/
+
+const std::filesystem::path log_path = "render_primitive_benchmark.log";
+
+constexpr auto vertex_count = 100'000;
+constexpr auto pass_count = 100;
+
+
+/*
+	Previous paths
+	--------------
+	The transform and opacity functions as they were before being vectorized
+*/
+
+namespace previous
+{
+	void transform_positions(const render_primitive::detail::vertex_metrics &metrics, const Matrix4 &model_matrix, render_primitive::VertexContainer &data) noexcept
+	{
+		auto size = std::ssize(data);
+		auto stride = std::max(metrics.position_components, metrics.position_stride);
+
+		switch (metrics.position_components)
+		{
+			//Two-components (x, y)
+			case 2:
+			{
+				for (auto off = metrics.position_offset; off + 1 < size; off += stride)
+				{
+					auto [x, y] = (Matrix3::Transformation(model_matrix) * Vector2{data[off + 0], data[off + 1]}).XY();
+					data[off + 0] = x;
+					data[off + 1] = y;
+				}
+
+				break;
+			}
+
+			//Three-components (x, y, z)
+			case 3:
+			case 4: //w is left as is
+			{
+				for (auto off = metrics.position_offset; off + 2 < size; off += stride)
+				{
+					auto [x, y, z] = (model_matrix * Vector3{data[off + 0], data[off + 1], data[off + 2]}).XYZ();
+					data[off + 0] = x;
+					data[off + 1] = y;
+					data[off + 2] = z;
+				}
+
+				break;
+			}
+		}
+	}
+
+	void apply_opacity(const render_primitive::detail::vertex_metrics &metrics, real opacity, const render_primitive::VertexContainer &source_data, render_primitive::VertexContainer &data) noexcept
+	{
+		auto size = std::ssize(data);
+		auto stride = std::max(metrics.color_components, metrics.color_stride);
+
+		switch (metrics.color_components)
+		{
+			//Four-channels (r, g, b, a)
+			case 4: //Need alpha channel
+			{
+				for (auto off = metrics.color_offset; off + 3 < size; off += stride)
+					data[off + 3] = source_data[off + 3] * opacity;
+
+				break;
+			}
+		}
+	}
+} //previous
+
+
+/*
+	Benchmarking
+*/
+
+//Returns the average duration (in microseconds) of one pass
+template <typename Function>
+auto time_passes(Function &&function)
+{
+	auto stopwatch = ion::timers::Stopwatch::StartNew();
+
+	for (auto i = 0; i < pass_count; ++i)
+		function();
+
+	return std::chrono::duration<double, std::micro>{stopwatch.Elapsed()}.count() / pass_count;
+}
+
+auto make_vertex_data(int stride, std::mt19937 &generator)
+{
+	std::uniform_real_distribution<real> distribution{-1.0_r, 1.0_r};
+	render_primitive::VertexContainer data(vertex_count * stride);
+
+	for (auto &value : data)
+		value = distribution(generator);
+
+	return data;
+}
+
+//Returns true if both paths gave identical results
+bool benchmark_transform(std::string_view name, const render_primitive::detail::vertex_metrics &metrics, int stride,
+	std::mt19937 &generator, std::ostringstream &report)
+{
+	auto model_matrix = Matrix4::Transformation(0.5_r, {1.5_r, 0.75_r, 1.0_r}, {10.0_r, -20.0_r, -1.5_r});
+	auto source_data = make_vertex_data(stride, generator);
+	auto previous_data = source_data;
+	auto data = source_data;
+
+	//Transform the same source data each pass
+	auto previous_time = time_passes(
+		[&]() noexcept
+		{
+			previous_data = source_data;
+			previous::transform_positions(metrics, model_matrix, previous_data);
+		});
+	auto time = time_passes(
+		[&]() noexcept
+		{
+			data = source_data;
+			render_primitive::detail::transform_positions(metrics, model_matrix, data);
+		});
+
+	auto identical = previous_data == data;
+	report << name << ": " << previous_time << " us -> " << time << " us per pass" <<
+		(identical ? "" : " (results differ)") << '\n';
+	return identical;
+}
+
+//Returns true if both paths gave identical results
+bool benchmark_opacity(std::string_view name, const render_primitive::detail::vertex_metrics &metrics, int stride,
+	std::mt19937 &generator, std::ostringstream &report)
+{
+	auto source_data = make_vertex_data(stride, generator);
+	auto previous_data = source_data;
+	auto data = source_data;
+
+	auto previous_time = time_passes(
+		[&]() noexcept
+		{
+			previous::apply_opacity(metrics, 0.5_r, source_data, previous_data);
+		});
+	auto time = time_passes(
+		[&]() noexcept
+		{
+			render_primitive::detail::apply_opacity(metrics, 0.5_r, source_data, data);
+		});
+
+	auto identical = previous_data == data;
+	report << name << ": " << previous_time << " us -> " << time << " us per pass" <<
+		(identical ? "" : " (results differ)") << '\n';
+	return identical;
+}
+
+
+#ifdef ION_WIN32
+//Entry point for windows 32/64 bit
+int WINAPI WinMain([[maybe_unused]] _In_ HINSTANCE instance,
+				   [[maybe_unused]] _In_opt_ HINSTANCE prev_instance,
+				   [[maybe_unused]] _In_ LPSTR cmd_line,
+				   [[maybe_unused]] _In_ int cmd_show)
+#else
+//Entry point for non windows systems
+int main([[maybe_unused]] int argc, [[maybe_unused]] char *argv[])
+#endif
+{
+	std::mt19937 generator{1234}; //Same vertex data each run
+	std::ostringstream report;
+	report << vertex_count << " vertices, " << pass_count << " passes\n";
+
+	//Position (2), color (4) and tex coord (2)
+	auto identical = benchmark_transform("2D transform", {2, 0, 8, 4, 2, 8}, 8, generator, report);
+
+	//Position (3), color (4) and tex coord (3)
+	identical &= benchmark_transform("3D transform", {3, 0, 10, 4, 3, 10}, 10, generator, report);
+	identical &= benchmark_opacity("Opacity", {3, 0, 10, 4, 3, 10}, 10, generator, report);
+
+	ion::utilities::file::Save(log_path, report.str());
+	return identical ? 0 : 1;
+}
\ No newline at end of file
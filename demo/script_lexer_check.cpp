@@ -0,0 +1,458 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	engine
+File:	script_lexer_check.cpp
+-------------------------------------------
+*/
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "Ion.h"
+
+using namespace std::string_literals;
+using namespace std::string_view_literals;
+
+using namespace ion::script::script_compiler::detail;
+
+
+/*
+	Script lexer check
+	------------------
+	Built and run by the script_lexer_check project (project/script_lexer_check.vcxproj).
+	Lexes all demo data scripts with the previous (scalar) lexer and the current (SIMD) lexer,
+	and checks that the token streams are identical.
+	Each lexeme function is also compared at every offset of the demo data scripts, and of random strings.
+	Run once for each SIMD configuration (AVX2, SSE2 and ION_NO_SIMD).
+	The report is saved to the log path below, and the exit code is 0 if no differences were found
+*/
+
+const std::filesystem::path scripts_path = "data/scripts";
+const std::filesystem::path log_path = "script_lexer_check.log";
+
+constexpr auto random_string_count = 20'000;
+constexpr auto random_string_max_size = 64;
+constexpr auto max_reported_differences = 100;
+
+
+/*
+	Previous lexer
+	--------------
+	The lexeme functions as they were before being vectorized
+*/
+
+namespace previous
+{
+	std::pair<std::string_view, int> get_comment_lexeme(std::string_view str) noexcept
+	{
+		//Line comment
+		if (str[1] == '/')
+		{
+			if (auto off = str.find('\n', 2); off != std::string_view::npos)
+				str.remove_suffix(std::size(str) - off);
+
+			return {str, 0};
+		}
+		//Block comment
+		else
+		{
+			if (auto off = str.find("*/", 2); off != std::string_view::npos)
+				str.remove_suffix(std::size(str) - (off + 2));
+
+			return {str, static_cast<int>(std::count(std::begin(str), std::end(str), '\n'))};
+		}
+	}
+
+	std::string_view get_hex_literal_lexeme(std::string_view str) noexcept
+	{
+		//#<Hexadecimal>
+		if (auto iter = std::find_if(std::begin(str) + 1, std::end(str), std::not_fn(is_hex_digit));
+			iter != std::end(str))
+			str.remove_suffix(std::size(str) - (iter - std::begin(str)));
+
+		return str;
+	}
+
+	std::string_view get_identifer_lexeme(std::string_view str) noexcept
+	{
+		if (auto iter = std::find_if(std::begin(str) + 1, std::end(str), std::not_fn(is_valid_in_identifier));
+			iter != std::end(str))
+			str.remove_suffix(std::size(str) - (iter - std::begin(str)));
+
+		return str;
+	}
+
+	std::pair<std::string_view, int> get_string_literal_lexeme(std::string_view str) noexcept
+	{
+		auto line_breaks = 0;
+		auto backtick = str.front() == '`';
+
+		if (auto iter = std::find_if(std::begin(str) + 1, std::end(str),
+			[&, escaped = false, escaped_cr = false](auto c) mutable noexcept
+			{
+				//Double-quote, single-quote or backtick
+				if (c == str.front())
+				{
+					if (!escaped)
+						return true;
+				}
+				else
+				{
+					switch (c)
+					{
+						case '\\': //Backslash
+						escaped = !escaped;
+						return (escaped_cr = false);
+
+						case '\r': //Carriage return
+						escaped_cr = escaped;
+						break;
+
+						case '\n': //Line feed
+						{
+							if (!escaped && !escaped_cr && !backtick)
+								return true;
+							else
+								++line_breaks;
+
+							[[fallthrough]];
+						}
+
+						default:
+						escaped_cr = false;
+						break;
+					}
+				}
+
+				return (escaped = false);
+			}); iter != std::end(str))
+
+			str.remove_suffix(std::size(str) - (iter - std::begin(str) + (*iter != '\n')));
+
+		return {str, line_breaks};
+	}
+
+	std::pair<std::string_view, int> get_white_space_lexeme(std::string_view str) noexcept
+	{
+		//White space
+		if (auto iter = std::find_if(std::begin(str) + 1, std::end(str), std::not_fn(is_white_space));
+			iter != std::end(str))
+			str.remove_suffix(std::size(str) - (iter - std::begin(str)));
+
+		return {str, static_cast<int>(std::count(std::begin(str), std::end(str), '\n'))};
+	}
+
+
+	//Same as lex in IonScriptCompiler.cpp, but with the previous lexeme functions
+	//Imports are not followed, since they don't change the tokens of the importing unit
+	lexical_tokens lex(translation_unit &unit)
+	{
+		std::string_view str = unit.source;
+		lexical_tokens tokens;
+		lexical_token token;
+		auto line_number = 1;
+
+		auto inside_declaration = false;
+		auto scope_depth = 0;
+
+		for (auto iter = std::begin(str), end = std::end(str); iter != end;)
+		{
+			auto c = *iter;
+			auto next_c = iter + 1 != end ? *(iter + 1) : '\0';
+			auto off = iter - std::begin(str);
+
+			//White space
+			if (is_white_space(c))
+			{
+				auto [lexeme, line_breaks] = get_white_space_lexeme(str.substr(off));
+				token = {token_name::WhiteSpace, lexeme, &unit, line_number += line_breaks};
+
+				//For global scope only
+				if (scope_depth == 0 && !std::empty(tokens) &&
+					tokens.back().name == token_name::Identifier &&
+					is_class_identifier(tokens.back().value) &&
+					is_class_selector(next_c))
+						token.name = token_name::Selector; //Descendant selector
+			}
+			//Selector
+			else if (is_selector(c) && scope_depth == 0 && !inside_declaration) //For global scope only
+			{
+				token = {token_name::Selector, str.substr(off, 1), &unit, line_number};
+
+				if (token.value.front() == '*')
+					token.name = token_name::Identifier; //Change to class identifier
+			}
+			//Separator
+			else if (is_separator(c))
+				token = {token_name::Separator, str.substr(off, 1), &unit, line_number};
+			//String literal
+			else if (is_start_of_string_literal(c))
+			{
+				auto [lexeme, line_breaks] = get_string_literal_lexeme(str.substr(off));
+				token = {token_name::StringLiteral, lexeme, &unit, line_number += line_breaks};
+			}
+			//Comment
+			else if (is_start_of_comment(c, next_c))
+			{
+				auto [lexeme, line_breaks] = get_comment_lexeme(str.substr(off));
+				token = {token_name::Comment, lexeme, &unit, line_number += line_breaks};
+			}
+			//Identifier
+			else if (is_start_of_identifier(c, next_c) ||
+					(c == '%' && !std::empty(tokens) && tokens.back().name == token_name::NumericLiteral))
+			{
+				auto lexeme = get_identifer_lexeme(str.substr(off));
+				token = {
+					[&]() noexcept
+					{
+						if (!std::empty(tokens) && tokens.back().name == token_name::NumericLiteral)
+							return token_name::Unit;
+						else if (is_boolean_literal(lexeme))
+							return token_name::BooleanLiteral;
+						else if (is_function(lexeme) &&
+							off + std::size(lexeme) < std::size(str) && str[off + std::size(lexeme)] == '(')
+							return token_name::Function;
+						else
+							return token_name::Identifier;
+					}(), lexeme, &unit, line_number};
+
+				//Expand token to engulf class selector/variable prefix
+				if (token.name == token_name::Identifier && !std::empty(tokens) &&
+					((tokens.back().name == token_name::Selector && is_class_selector(tokens.back().value.front())) ||
+					(tokens.back().name == token_name::UnknownSymbol && is_variable_prefix(tokens.back().value.front()))))
+				{
+					token.value = str.substr(off - 1, std::size(lexeme) + 1);
+					tokens.pop_back();
+					--iter;
+				}
+			}
+			//Operator
+			else if (is_operator(c))
+				token = {token_name::Operator, str.substr(off, 1), &unit, line_number};
+			//Numeric literal (not vectorized)
+			else if (is_start_of_numeric_literal(c, next_c))
+				token = {token_name::NumericLiteral, get_numeric_literal_lexeme(str.substr(off)), &unit, line_number};
+			//Hex literal
+			else if (is_start_of_hex_literal(c, next_c))
+				token = {token_name::HexLiteral, get_hex_literal_lexeme(str.substr(off)), &unit, line_number};
+			//Rule
+			else if (is_start_of_rule(c))
+				token = {token_name::Rule, get_identifer_lexeme(str.substr(off)), &unit, line_number};
+			//Unknown symbol
+			else
+				token = {token_name::UnknownSymbol, str.substr(off, 1), &unit, line_number};
+
+			iter += std::size(token.value);
+			tokens.push_back(token);
+
+			//For selectors (scope aware)
+			if (token.name == token_name::Separator)
+			{
+				switch (token.value.front())
+				{
+					case '{':
+					case '(':
+					++scope_depth;
+					break;
+
+					case '}':
+					case ')':
+					{
+						if (scope_depth > 0)
+							--scope_depth;
+						break;
+					}
+
+					case ':':
+					inside_declaration = true;
+					break;
+
+					case ';':
+					inside_declaration = false;
+					break;
+				}
+			}
+		}
+
+		return tokens;
+	}
+} //previous
+
+
+/*
+	Comparing
+*/
+
+class Report
+{
+	private:
+
+		std::ostringstream out_;
+		int differences_ = 0;
+
+	public:
+
+		template <typename... Ts>
+		void Line(Ts &&...args)
+		{
+			(out_ << ... << std::forward<Ts>(args)) << '\n';
+		}
+
+		template <typename... Ts>
+		void Difference(Ts &&...args)
+		{
+			if (differences_++ < max_reported_differences)
+				Line(std::forward<Ts>(args)...);
+		}
+
+		[[nodiscard]] auto Differences() const noexcept
+		{
+			return differences_;
+		}
+
+		[[nodiscard]] auto Str() const
+		{
+			return out_.str();
+		}
+};
+
+//Compares the lexeme functions at the given offset (where each lexeme could start)
+void compare_lexemes(std::string_view str, std::string_view source_name, Report &report)
+{
+	for (auto off = std::string_view::size_type{0}; off + 1 < std::size(str); ++off)
+	{
+		auto part = str.substr(off);
+		auto c = part[0];
+		auto next_c = part[1];
+
+		if (is_start_of_comment(c, next_c) &&
+			previous::get_comment_lexeme(part) != get_comment_lexeme(part))
+			report.Difference(source_name, ": comment lexeme differs at offset ", off);
+
+		if (is_start_of_hex_literal(c, next_c) &&
+			previous::get_hex_literal_lexeme(part) != get_hex_literal_lexeme(part))
+			report.Difference(source_name, ": hex literal lexeme differs at offset ", off);
+
+		if ((is_start_of_identifier(c, next_c) || is_start_of_rule(c)) &&
+			previous::get_identifer_lexeme(part) != get_identifer_lexeme(part))
+			report.Difference(source_name, ": identifier lexeme differs at offset ", off);
+
+		if (is_start_of_string_literal(c) &&
+			previous::get_string_literal_lexeme(part) != get_string_literal_lexeme(part))
+			report.Difference(source_name, ": string literal lexeme differs at offset ", off);
+
+		if (is_white_space(c) &&
+			previous::get_white_space_lexeme(part) != get_white_space_lexeme(part))
+			report.Difference(source_name, ": white space lexeme differs at offset ", off);
+	}
+}
+
+//Compares the complete token streams of the given script file
+void compare_tokens(const std::filesystem::path &file_path, Report &report)
+{
+	translation_unit unit;
+	unit.file_path = file_path.lexically_normal().string();
+
+	if (!ion::utilities::file::Load(file_path, unit.source, ion::utilities::file::FileLoadMode::Binary))
+	{
+		report.Difference(unit.file_path, ": could not be loaded");
+		return;
+	}
+
+	build_system system{file_path.parent_path()};
+	file_trace trace;
+	trace.push_file(file_path.lexically_normal());
+
+	auto tokens = lex(unit, std::move(trace), system);
+	auto previous_tokens = previous::lex(unit);
+
+	if (!tokens)
+	{
+		report.Difference(unit.file_path, ": could not be lexed");
+		return;
+	}
+
+	if (std::size(*tokens) != std::size(previous_tokens))
+		report.Difference(unit.file_path, ": ", std::size(*tokens), " tokens, previously ", std::size(previous_tokens));
+
+	for (auto i = std::size_t{0}; i < std::min(std::size(*tokens), std::size(previous_tokens)); ++i)
+	{
+		auto &token = (*tokens)[i];
+		auto &previous_token = previous_tokens[i];
+
+		//Compare views, not just content, so that tokens must also start at the same offset
+		if (token.name != previous_token.name ||
+			std::data(token.value) != std::data(previous_token.value) ||
+			std::size(token.value) != std::size(previous_token.value) ||
+			token.line_number != previous_token.line_number)
+		{
+			report.Difference(unit.file_path, ": token ", i, " differs at line ", token.line_number,
+				" (previously line ", previous_token.line_number, ")");
+			break;
+		}
+	}
+
+	compare_lexemes(unit.source, unit.file_path, report);
+	report.Line(unit.file_path, ": ", std::size(*tokens), " tokens");
+}
+
+//Compares the lexeme functions on random strings, biased towards characters that changes the lexer state
+void compare_random_strings(Report &report)
+{
+	constexpr auto alphabet = "\"'`\\\r\n\t *#/-_@%.09afAFzZ{}();:"sv;
+
+	std::mt19937 generator{1234}; //Same strings each run
+	std::uniform_int_distribution<int> size_distribution{2, random_string_max_size};
+	std::uniform_int_distribution<int> char_distribution{0, static_cast<int>(std::size(alphabet)) - 1};
+
+	for (auto i = 0; i < random_string_count; ++i)
+	{
+		std::string str(size_distribution(generator), '\0');
+
+		for (auto &c : str)
+			c = alphabet[char_distribution(generator)];
+
+		compare_lexemes(str, "random string "s + std::to_string(i), report);
+	}
+
+	report.Line(random_string_count, " random strings");
+}
+
+
+#ifdef ION_WIN32
+//Entry point for windows 32/64 bit
+int WINAPI WinMain([[maybe_unused]] _In_ HINSTANCE instance,
+				   [[maybe_unused]] _In_opt_ HINSTANCE prev_instance,
+				   [[maybe_unused]] _In_ LPSTR cmd_line,
+				   [[maybe_unused]] _In_ int cmd_show)
+#else
+//Entry point for non windows systems
+int main([[maybe_unused]] int argc, [[maybe_unused]] char *argv[])
+#endif
+{
+	Report report;
+
+	for (auto &file_path : ion::utilities::file::FilesIn(scripts_path, ion::utilities::file::DirectoryIteration::Recursive))
+	{
+		if (file_path.extension() == ".ion")
+			compare_tokens(file_path, report);
+	}
+
+	compare_random_strings(report);
+	report.Line(report.Differences(), " differences");
+
+	ion::utilities::file::Save(log_path, report.Str());
+	return report.Differences() > 0 ? 1 : 0;
+}
\ No newline at end of file
@@ -24,6 +24,7 @@ File:	Ion.h
 #include "adaptors/ranges/IonIterable.h"
 
 #include "assets/IonAssetLoader.h"
+#include "assets/IonDataFileIndex.h"
 #include "assets/repositories/IonAudioRepository.h"
 #include "assets/repositories/IonFileRepository.h"
 #include "assets/repositories/IonFontRepository.h"
@@ -62,6 +63,7 @@ File:	Ion.h
 #include "graphics/particles/IonEmitter.h"
 #include "graphics/particles/IonEmitterManager.h"
 #include "graphics/particles/IonParticle.h"
+#include "graphics/particles/IonParticleStorage.h"
 #include "graphics/particles/IonParticleSystem.h"
 #include "graphics/particles/IonParticleSystemManager.h"
 #include "graphics/particles/affectors/IonAffector.h"
@@ -80,6 +82,8 @@ File:	Ion.h
 #include "graphics/render/IonRenderPrimitive.h"
 #include "graphics/render/IonRenderTarget.h"
 #include "graphics/render/IonRenderWindow.h"
+#include "graphics/render/IonVertexDataAllocator.h"
+#include "graphics/render/IonVertexUpload.h"
 #include "graphics/render/IonViewport.h"
 #include "graphics/render/vertex/IonVertexArrayObject.h"
 #include "graphics/render/vertex/IonVertexBatch.h"
@@ -97,6 +101,7 @@ File:	Ion.h
 #include "graphics/scene/IonMovableSound.h"
 #include "graphics/scene/IonMovableSoundListener.h"
 #include "graphics/scene/IonSceneManager.h"
+#include "graphics/scene/IonSpatialIndex.h"
 #include "graphics/scene/graph/IonSceneGraph.h"
 #include "graphics/scene/graph/IonSceneNode.h"
 #include "graphics/scene/graph/animations/IonAttachableNodeAnimation.h"
@@ -177,6 +182,7 @@ File:	Ion.h
 #include "memory/IonNonOwningPtr.h"
 #include "memory/IonOwningPtr.h"
 
+#include "parallel/IonTaskScheduler.h"
 #include "parallel/IonWorker.h"
 #include "parallel/IonWorkerPool.h"
 
@@ -188,6 +194,7 @@ File:	Ion.h
 #include "script/IonScriptCompiler.h"
 #include "script/IonScriptError.h"
 #include "script/IonScriptTree.h"
+#include "script/IonScriptTreeView.h"
 #include "script/IonScriptTypes.h"
 #include "script/IonScriptValidator.h"
 #include "script/interfaces/IonAnimationScriptInterface.h"
@@ -242,11 +249,14 @@ File:	Ion.h
 #include "unmanaged/IonObjectFactory.h"
 
 #include "utilities/IonCodec.h"
+#include "utilities/IonCompression.h"
 #include "utilities/IonConvert.h"
 #include "utilities/IonCrypto.h"
 #include "utilities/IonFileUtility.h"
+#include "utilities/IonMappedFile.h"
 #include "utilities/IonMath.h"
 #include "utilities/IonRandom.h"
+#include "utilities/IonSimd.h"
 #include "utilities/IonStringUtility.h"
 
 
@@ -12,6 +12,8 @@ File:	IonAssetLoader.cpp
 
 #include "IonAssetLoader.h"
 
+#include "parallel/IonTaskScheduler.h"
+#include "utilities/IonCompression.h"
 #include "utilities/IonConvert.h"
 #include "utilities/IonStringUtility.h"
 
@@ -67,6 +69,50 @@ bool load_data_file(const std::filesystem::path &file_path, Strings &file_entrie
 	return false;
 }
 
+bool load_data_file(std::string_view data, Strings &file_entries)
+{
+	//Control header content
+	if (data.starts_with(detail::data_file_header) &&
+		std::ssize(data) >= std::ssize(detail::data_file_header) + detail::data_file_footer_size)
+	{
+		auto file_size = std::ssize(data);
+
+		//Control footer content
+		if (auto entries_size = convert::FirstPartTo<std::streamsize>(data.substr(file_size - detail::data_file_footer_size));
+			entries_size && *entries_size > 0 &&
+			*entries_size <= file_size - detail::data_file_footer_size - std::ssize(detail::data_file_header))
+		{
+			//Read file entries
+			file_entries = string::Split(
+				data.substr(file_size - detail::data_file_footer_size - *entries_size, *entries_size),
+				data_file_delimiter, string::StringSplitOptions::PreserveEmptyEntries);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void compile_file(const std::filesystem::path &file_path, compiled_file &file, bool compress, bool checksum)
+{
+	//Do not compile zero byte files
+	if (!(file.loaded = file::Load(file_path, file.bytes, file::FileLoadMode::Binary)) ||
+		std::empty(file.bytes))
+		return;
+
+	file.uncompressed_count = std::ssize(file.bytes);
+
+	if (compress)
+	{
+		//Only keep compressed bytes if smaller
+		if (auto bytes = compression::Compress(file.bytes); std::size(bytes) < std::size(file.bytes))
+			file.bytes = std::move(bytes);
+	}
+
+	if (checksum)
+		file.checksum = data_file_index::Checksum(file.bytes);
+}
+
 bool save_data_file_header(const std::filesystem::path &file_path) noexcept
 {
 	return file::Save(file_path, data_file_header, file::FileSaveMode::Binary);
@@ -92,16 +138,98 @@ bool save_data_file_footer(const std::filesystem::path &file_path, const Strings
 	return file::Save(file_path, file_entries_section, file::FileSaveMode::BinaryAppend);
 }
 
+bool save_data_file_footer(const std::filesystem::path &file_path, const data_file_index::Entries &file_entries,
+	std::streamoff table_offset) noexcept
+{
+	return file::Save(file_path,
+		data_file_index::Serialize(file_entries, table_offset),
+		file::FileSaveMode::BinaryAppend);
+}
+
 } //asset_loader::detail
 
 
 //Private
 
+std::shared_ptr<const file::MappedFile> AssetLoader::MapDataFile(const std::filesystem::path &data_file_path)
+{
+	//Data file already mapped
+	for (auto &mapped_data_file : mapped_data_files_)
+	{
+		if (mapped_data_file->FilePath() == data_file_path)
+			return mapped_data_file;
+	}
+
+	if (auto mapped_data_file = std::make_shared<const file::MappedFile>(data_file_path);
+		mapped_data_file->IsMapped())
+		return mapped_data_files_.emplace_back(std::move(mapped_data_file));
+	else
+		return nullptr;
+}
+
 bool AssetLoader::ExtractDataFile(const std::filesystem::path &data_file_path)
 {
 	Strings file_entries;
-	
-	if (detail::load_data_file(data_file_path, file_entries) &&
+	auto mapped_data_file = data_file_access_ == asset_loader::DataFileAccess::MemoryMapped ?
+		MapDataFile(data_file_path) : nullptr;
+
+	//Binary table of contents
+	if (auto data_file_index = mapped_data_file ?
+		DataFileIndex::Load(mapped_data_file) :
+		DataFileIndex::Load(data_file_path); data_file_index)
+	{
+		auto file_path = data_file_path.relative_path();
+		auto index = std::make_shared<const DataFileIndex>(std::move(*data_file_index));
+		std::vector<file_repository::FileEntry> files;
+		auto added = false;
+
+		for (auto &repository : repositories_)
+		{
+			//Entries are resolved lazily (by file path) when looked up
+			if (repository->FileNamingConvention() == file_repository::NamingConvention::FilePath)
+			{
+				added |= repository->AddDataFileIndex(file_path, index);
+				continue;
+			}
+
+			//Entries needs to be named up front (by file name)
+			if (std::empty(files))
+			{
+				files.reserve(index->Count());
+
+				for (auto off = 0; off < index->Count(); ++off)
+				{
+					if (auto entry = index->At(off); entry)
+						files.push_back({std::move(entry->Path), file_repository::FileLocation{file_path,
+							entry->Position, entry->Count, mapped_data_file, entry->Checksum,
+							entry->UncompressedCount != entry->Count ?
+								std::make_optional(entry->UncompressedCount) : std::nullopt,
+							index, off}});
+				}
+			}
+
+			added |= repository->AddFiles(
+				file_repository::detail::filter_by_file_extensions(files, repository->FileExtensions()));
+		}
+
+		//Data file already extracted, replace index
+		if (auto iter = std::find_if(std::begin(data_file_indices_), std::end(data_file_indices_),
+				[&](auto &x) noexcept
+				{
+					return x.first == file_path;
+				});
+			iter != std::end(data_file_indices_))
+			iter->second = std::move(index);
+		else
+			data_file_indices_.emplace_back(file_path, std::move(index));
+
+		return added;
+	}
+
+	//Text table of contents
+	else if ((mapped_data_file ?
+		detail::load_data_file(mapped_data_file->View(), file_entries) :
+		detail::load_data_file(data_file_path, file_entries)) &&
 		//Make sure the size is modulo 3
 		std::size(file_entries) % 3 == 0)
 	{
@@ -113,7 +241,8 @@ bool AssetLoader::ExtractDataFile(const std::filesystem::path &data_file_path)
 			end = std::cend(file_entries); iter != end; iter += 3)
 				files.push_back({iter[0], file_repository::FileLocation{file_path,
 					convert::FirstPartTo<std::streamoff>(iter[1]).value_or(0),
-					convert::FirstPartTo<std::streamsize>(iter[2]).value_or(0)}});
+					convert::FirstPartTo<std::streamsize>(iter[2]).value_or(0),
+					mapped_data_file}});
 
 		return LoadFiles(files);
 	}
@@ -204,44 +333,91 @@ bool AssetLoader::CompileDataFile(std::filesystem::path data_file_path,
 	if (!detail::save_data_file_header(data_file_path))
 		return false;
 
-	Strings file_entries;
+	auto binary_format = data_file_format_ == asset_loader::DataFileFormat::Binary;
+	auto compress = binary_format && data_file_compression_ == asset_loader::DataFileCompression::Compressed;
+	auto footer_size = binary_format ?
+		data_file_index::detail::footer_size :
+		detail::data_file_footer_size;
+
+	data_file_index::Entries file_entries;
+	decltype(file_repository::FileLocation::Position) current_position =
+		std::size(detail::data_file_header);
+
+	auto save_data_file_footer =
+		[&]() noexcept
+		{
+			if (binary_format)
+				return detail::save_data_file_footer(data_file_path, file_entries, current_position);
+
+			Strings entries;
+			entries.reserve(std::size(file_entries) * 3);
+
+			for (auto &entry : file_entries)
+			{
+				entries.push_back(entry.Path);
+				entries.push_back(convert::ToString(entry.Position));
+				entries.push_back(convert::ToString(entry.Count));
+			}
+
+			return detail::save_data_file_footer(data_file_path, entries);
+		};
+
 	{
 		auto file_name = data_file_path.filename().replace_extension().generic_string();
 		auto extension = data_file_path.extension().generic_string();
 		auto data_file_count = 1;
-		std::string data;
 
-		decltype(file_repository::FileLocation::Position) current_position =
-			std::size(detail::data_file_header);
 		decltype(file_repository::FileLocation::Count) total_count =
 			std::size(detail::data_file_header);
 
-		for (const auto &file_path : file_paths)
+		for (auto first = std::cbegin(file_paths), end = std::cend(file_paths); first != end;)
 		{
-			if (file::Load(file_path, data, file::FileLoadMode::Binary))
+			auto last = first;
+
+			//Find next batch of files
+			for (auto batch_size = std::uintmax_t{0};
+				last != end && (last == first || batch_size < detail::compile_batch_size); ++last)
+				batch_size += file::Size(*last).value_or(0);
+
+			std::vector<detail::compiled_file> files(last - first);
+
+			//Load (and compress) all files in batch in parallel
+			parallel::TaskScheduler::Instance().ParallelFor(0, static_cast<int>(std::size(files)),
+				[&](int i)
+				{
+					detail::compile_file(first[i], files[i], compress, binary_format);
+				});
+
+			for (auto &file : files)
 			{
+				auto &file_path = *first++;
+
 				//Do not add zero byte files
-				if (std::empty(data))
+				if (!file.loaded || std::empty(file.bytes))
 					continue;
 
-				auto byte_count = std::size(data);
+				auto byte_count = std::size(file.bytes);
 				auto path_part = file_path.generic_string();
-				auto position_part = convert::ToString(current_position);
-				auto count_part = convert::ToString(byte_count);
 
 				auto count = byte_count;
 				count += std::size(path_part);
-				count += std::size(position_part);
-				count += std::size(count_part);
-				count += !std::empty(file_entries) + 2; //Delimiters
+
+				if (binary_format)
+					count += data_file_index::detail::record_size;
+				else
+				{
+					count += std::size(convert::ToString(current_position));
+					count += std::size(convert::ToString(byte_count));
+					count += !std::empty(file_entries) + 2; //Delimiters
+				}
 
 				//Split file, if too big
 				if (total_count + count >
-					detail::max_file_split_size(file_split_size) - detail::data_file_footer_size)
+					detail::max_file_split_size(file_split_size) - footer_size)
 				{
 					//Save footer for current data file
 					if (std::empty(file_entries) ||
-						!detail::save_data_file_footer(data_file_path, file_entries))
+						!save_data_file_footer())
 							return false;
 					
 					data_file_path.replace_filename(
@@ -254,31 +430,52 @@ bool AssetLoader::CompileDataFile(std::filesystem::path data_file_path,
 					file_entries.clear();
 					current_position = std::size(detail::data_file_header);
 					total_count = std::size(detail::data_file_header);
-
-					position_part = convert::ToString(current_position);
 				}
 
 				//Save file bytes
-				if (!detail::save_data_file_bytes(data_file_path, data))
+				if (!detail::save_data_file_bytes(data_file_path, file.bytes))
 					return false;
 
-				file_entries.push_back(std::move(path_part));
-				file_entries.push_back(std::move(position_part));
-				file_entries.push_back(std::move(count_part));
-				
+				file_entries.push_back({std::move(path_part),
+					current_position, static_cast<std::streamsize>(byte_count),
+					file.checksum, file.uncompressed_count});
+
 				current_position += byte_count;
 				total_count += count;
-				data.clear();
+				file.bytes = {}; //Release memory
 			}
 		}
 	}
 
 	return !std::empty(file_entries) ?
-		detail::save_data_file_footer(data_file_path, file_entries) :
+		save_data_file_footer() :
 		false;
 }
 
 
+/*
+	Data file entries
+*/
+
+std::optional<file_repository::FileEntry> AssetLoader::DataFileEntry(std::string_view file_path) const
+{
+	for (auto &[data_file_path, data_file_index] : data_file_indices_)
+	{
+		if (auto off = data_file_index->OffsetOf(file_path); off)
+		{
+			if (auto entry = data_file_index->At(*off); entry)
+				return file_repository::FileEntry{std::move(entry->Path), file_repository::FileLocation{data_file_path,
+					entry->Position, entry->Count, data_file_index->MappedDataFile(), entry->Checksum,
+					entry->UncompressedCount != entry->Count ?
+						std::make_optional(entry->UncompressedCount) : std::nullopt,
+					data_file_index, *off}};
+		}
+	}
+
+	return {};
+}
+
+
 /*
 	Detaching
 */
@@ -14,14 +14,19 @@ File:	IonAssetLoader.h
 #define ION_ASSET_LOADER_H
 
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
+#include "IonDataFileIndex.h"
 #include "adaptors/ranges/IonDereferenceIterable.h"
 #include "repositories/IonFileRepository.h"
 #include "types/IonTypes.h"
 #include "utilities/IonFileUtility.h"
+#include "utilities/IonMappedFile.h"
 
 #undef max
 
@@ -40,12 +45,40 @@ namespace ion::assets
 			Max256TB
 		};
 
+		enum class DataFileAccess : bool
+		{
+			Streamed,
+			MemoryMapped
+		};
+
+		enum class DataFileFormat : bool
+		{
+			Text,
+			Binary
+		};
+
+		enum class DataFileCompression : bool
+		{
+			Uncompressed,
+			Compressed
+		};
+
 
 		namespace detail
 		{
 			using namespace utilities::file::literals;
 
 			using container_type = std::vector<repositories::FileRepository*>; //Non-owning
+			using mapped_files = std::vector<std::shared_ptr<const utilities::file::MappedFile>>;
+			using data_file_indices = std::vector<std::pair<std::filesystem::path, std::shared_ptr<const DataFileIndex>>>;
+
+			struct compiled_file final
+			{
+				std::string bytes; //Compressed, if smaller
+				std::streamsize uncompressed_count = 0;
+				uint64 checksum = 0;
+				bool loaded = false;
+			};
 
 
 			constexpr auto max_file_size_2_gb = 2_gb - 1;
@@ -58,6 +91,8 @@ namespace ion::assets
 			constexpr auto data_file_delimiter = "\0"sv;
 			constexpr auto data_file_footer_size = 15;
 
+			constexpr auto compile_batch_size = 64_mb; //Max bytes loaded (and compressed) in parallel
+
 
 			constexpr auto max_file_split_size(FileSplitSize file_split_size) noexcept
 			{
@@ -82,10 +117,15 @@ namespace ion::assets
 
 
 			bool load_data_file(const std::filesystem::path &file_path, Strings &file_entries);
+			bool load_data_file(std::string_view data, Strings &file_entries);
+
+			void compile_file(const std::filesystem::path &file_path, compiled_file &file, bool compress, bool checksum);
 
 			bool save_data_file_header(const std::filesystem::path &file_path) noexcept;
 			bool save_data_file_bytes(const std::filesystem::path &file_path, std::string_view file_bytes) noexcept;
 			bool save_data_file_footer(const std::filesystem::path &file_path, const Strings &file_entries) noexcept;
+			bool save_data_file_footer(const std::filesystem::path &file_path, const data_file_index::Entries &file_entries,
+				std::streamoff table_offset) noexcept;
 		} //detail
 	} //asset_loader
 
@@ -98,9 +138,15 @@ namespace ion::assets
 		private:
 
 			asset_loader::detail::container_type repositories_;
+			asset_loader::detail::mapped_files mapped_data_files_;
+			asset_loader::detail::data_file_indices data_file_indices_;
 			std::string data_file_extension_ = ".dat";
+			asset_loader::DataFileAccess data_file_access_ = asset_loader::DataFileAccess::Streamed;
+			asset_loader::DataFileFormat data_file_format_ = asset_loader::DataFileFormat::Binary;
+			asset_loader::DataFileCompression data_file_compression_ = asset_loader::DataFileCompression::Uncompressed;
 
 
+			std::shared_ptr<const utilities::file::MappedFile> MapDataFile(const std::filesystem::path &data_file_path);
 			bool ExtractDataFile(const std::filesystem::path &data_file_path);
 			bool ExtractDataFiles(const utilities::file::Paths &data_file_paths);
 
@@ -140,6 +186,30 @@ namespace ion::assets
 				data_file_extension_ = std::move(data_file_extension);
 			}
 
+			///@brief Sets how files in data files are accessed
+			///@details If memory mapped, each data file is mapped once when extracted, and files can be viewed without copying (zero-copy).
+			///Mapped data files are kept for as long as this loader (or any file entry referencing it) lives
+			inline void DataFileAccess(asset_loader::DataFileAccess data_file_access) noexcept
+			{
+				data_file_access_ = data_file_access;
+			}
+
+			///@brief Sets the format of the table of contents in compiled data files
+			///@details A binary table of contents has fixed-width records (with checksums) that can be looked up directly.
+			///Data files with either format can be extracted, regardless of this setting
+			inline void DataFileFormat(asset_loader::DataFileFormat data_file_format) noexcept
+			{
+				data_file_format_ = data_file_format;
+			}
+
+			///@brief Sets if files in compiled data files should be compressed or not
+			///@details Each file is compressed individually (if that makes it smaller), and is decompressed on demand when its file data is retrieved.
+			///Compression requires the binary data file format, and is ignored otherwise
+			inline void DataFileCompression(asset_loader::DataFileCompression data_file_compression) noexcept
+			{
+				data_file_compression_ = data_file_compression;
+			}
+
 			///@}
 
 			/**
@@ -153,6 +223,24 @@ namespace ion::assets
 				return data_file_extension_;
 			}
 
+			///@brief Returns how files in data files are accessed
+			[[nodiscard]] inline auto DataFileAccess() const noexcept
+			{
+				return data_file_access_;
+			}
+
+			///@brief Returns the format of the table of contents in compiled data files
+			[[nodiscard]] inline auto DataFileFormat() const noexcept
+			{
+				return data_file_format_;
+			}
+
+			///@brief Returns if files in compiled data files should be compressed or not
+			[[nodiscard]] inline auto DataFileCompression() const noexcept
+			{
+				return data_file_compression_;
+			}
+
 			///@}
 
 			/**
@@ -203,12 +291,25 @@ namespace ion::assets
 
 			///@brief Pulls files from each attached repository and compile them together as a data file
 			///@details If the total size of the compilation exceeds the file split size, the compilation is split into multiple data files.
-			///When multiple data files are created, a numerical suffix is added to the file name
+			///When multiple data files are created, a numerical suffix is added to the file name.
+			///Files are loaded (and compressed) in parallel batches, and saved in order
 			bool CompileDataFile(std::filesystem::path data_file_path,
 				asset_loader::FileSplitSize file_split_size = asset_loader::FileSplitSize::Max4GB) const noexcept;
 
 			///@}
 
+			/**
+				@name Data file entries
+				@{
+			*/
+
+			///@brief Returns the data file entry with the given file path, from all extracted data files with a binary table of contents
+			///@details The entry is looked up directly in each table of contents (by hash), without going through the attached repositories.
+			///Returns nullopt if no entry with the given file path was found
+			[[nodiscard]] std::optional<repositories::file_repository::FileEntry> DataFileEntry(std::string_view file_path) const;
+
+			///@}
+
 			/**
 				@name Detaching
 				@{
@@ -0,0 +1,310 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	assets
+File:	IonDataFileIndex.cpp
+-------------------------------------------
+*/
+
+#include "IonDataFileIndex.h"
+
+#include <algorithm>
+
+#include "utilities/IonCrypto.h"
+#include "utilities/IonFileUtility.h"
+
+namespace ion::assets
+{
+
+using namespace data_file_index;
+
+namespace data_file_index::detail
+{
+
+uint64 read_uint(std::string_view bytes, int size) noexcept
+{
+	auto value = 0_ui64;
+
+	for (auto i = size - 1; i >= 0; --i)
+		value = (value << 8) | static_cast<uint8>(bytes[i]);
+
+	return value;
+}
+
+void write_uint(std::string &bytes, uint64 value, int size)
+{
+	for (auto i = 0; i < size; ++i, value >>= 8)
+		bytes.push_back(static_cast<char>(value & 0xff));
+}
+
+
+std::optional<table_footer> read_footer(std::string_view footer, std::streamsize file_size) noexcept
+{
+	//Control footer content
+	if (std::ssize(footer) != footer_size || footer.substr(16) != table_magic)
+		return {};
+
+	auto version = read_uint(footer.substr(12), 4);
+
+	if (version < 1 || version > table_version)
+		return {};
+
+	auto table_offset = static_cast<std::streamoff>(read_uint(footer, 8));
+	auto count = static_cast<std::streamsize>(read_uint(footer.substr(8), 4));
+	auto table_size = file_size - footer_size - table_offset;
+	auto table_record_size = version == 1 ? record_size_v1 : record_size;
+
+	//Control table bounds
+	if (table_offset < 0 || table_size < count * table_record_size)
+		return {};
+
+	return table_footer{table_offset, table_size, static_cast<int>(count), table_record_size};
+}
+
+} //data_file_index::detail
+
+
+/*
+	Functions
+*/
+
+uint64 data_file_index::Checksum(std::string_view bytes) noexcept
+{
+	return utilities::crypto::FNV1a_64(bytes);
+}
+
+std::string data_file_index::Serialize(const Entries &entries, std::streamoff table_offset)
+{
+	//Sort records by name hash (then name)
+	std::vector<std::pair<uint64, const Entry*>> records;
+	records.reserve(std::size(entries));
+
+	for (auto &entry : entries)
+		records.emplace_back(utilities::crypto::FNV1a_64(entry.Path), &entry);
+
+	std::sort(std::begin(records), std::end(records),
+		[](auto &x, auto &y) noexcept
+		{
+			return x.first < y.first || (x.first == y.first && x.second->Path < y.second->Path);
+		});
+
+	std::string bytes;
+	std::string names;
+
+	for (auto &[hash, entry] : records)
+	{
+		detail::write_uint(bytes, hash, 8);
+		detail::write_uint(bytes, entry->Position, 8);
+		detail::write_uint(bytes, entry->Count, 8);
+		detail::write_uint(bytes, entry->Checksum, 8);
+		detail::write_uint(bytes, std::size(names), 4);
+		detail::write_uint(bytes, std::size(entry->Path), 4);
+		detail::write_uint(bytes, entry->UncompressedCount, 8);
+		names += entry->Path;
+	}
+
+	bytes += names;
+	detail::write_uint(bytes, table_offset, 8);
+	detail::write_uint(bytes, std::size(records), 4);
+	detail::write_uint(bytes, detail::table_version, 4);
+	bytes += detail::table_magic;
+	return bytes;
+}
+
+
+//DataFileIndex
+//Private
+
+std::string_view DataFileIndex::Bytes() const noexcept
+{
+	return mapped_data_file_ ?
+		mapped_data_file_->View() :
+		std::string_view{table_data_};
+}
+
+std::string_view DataFileIndex::Record(int off) const noexcept
+{
+	return Bytes().substr(table_offset_ + off * record_size_, record_size_);
+}
+
+std::string_view DataFileIndex::Name(std::string_view record) const noexcept
+{
+	auto name_offset = detail::read_uint(record.substr(32), 4);
+	auto name_size = detail::read_uint(record.substr(36), 4);
+
+	//Control name bounds
+	return name_offset + name_size <= names_size_ ?
+		Bytes().substr(names_offset_ + name_offset, name_size) :
+		std::string_view{};
+}
+
+
+//Public
+
+/*
+	Static loading
+*/
+
+std::optional<DataFileIndex> DataFileIndex::Load(const std::filesystem::path &data_file_path)
+{
+	std::string footer;
+
+	if (auto file_size = utilities::file::Size(data_file_path);
+		file_size && *file_size >= detail::footer_size &&
+		utilities::file::LoadPartOf(data_file_path, footer,
+			*file_size - detail::footer_size, detail::footer_size,
+			utilities::file::FileLoadMode::Binary))
+	{
+		if (auto table_footer = detail::read_footer(footer, *file_size); table_footer)
+		{
+			DataFileIndex index;
+
+			//Read records and names
+			if (utilities::file::LoadPartOf(data_file_path, index.table_data_,
+				table_footer->table_offset, table_footer->table_size,
+				utilities::file::FileLoadMode::Binary) &&
+				std::ssize(index.table_data_) == table_footer->table_size)
+			{
+				index.names_offset_ = table_footer->count * table_footer->record_size;
+				index.names_size_ = table_footer->table_size - index.names_offset_;
+				index.count_ = table_footer->count;
+				index.record_size_ = table_footer->record_size;
+				index.verified_ = std::make_unique<std::atomic<bool>[]>(index.count_);
+				return index;
+			}
+		}
+	}
+
+	return {};
+}
+
+std::optional<DataFileIndex> DataFileIndex::Load(std::shared_ptr<const utilities::file::MappedFile> mapped_data_file)
+{
+	if (!mapped_data_file)
+		return {};
+
+	if (auto bytes = mapped_data_file->View(); std::ssize(bytes) >= detail::footer_size)
+	{
+		if (auto table_footer = detail::read_footer(bytes.substr(std::size(bytes) - detail::footer_size), std::ssize(bytes));
+			table_footer)
+		{
+			DataFileIndex index;
+			index.mapped_data_file_ = std::move(mapped_data_file);
+			index.table_offset_ = table_footer->table_offset;
+			index.names_offset_ = index.table_offset_ + table_footer->count * table_footer->record_size;
+			index.names_size_ = table_footer->table_size - table_footer->count * table_footer->record_size;
+			index.count_ = table_footer->count;
+			index.record_size_ = table_footer->record_size;
+			index.verified_ = std::make_unique<std::atomic<bool>[]>(index.count_);
+			return index;
+		}
+	}
+
+	return {};
+}
+
+
+/*
+	Entries
+*/
+
+std::optional<Entry> DataFileIndex::At(int off) const
+{
+	if (off < 0 || off >= count_)
+		return {};
+
+	auto record = Record(off);
+	auto name = Name(record);
+
+	if (std::empty(name))
+		return {};
+
+	auto count = static_cast<std::streamsize>(detail::read_uint(record.substr(16), 8));
+	return Entry{
+		std::string{name},
+		static_cast<std::streamoff>(detail::read_uint(record.substr(8), 8)),
+		count,
+		detail::read_uint(record.substr(24), 8),
+		record_size_ == detail::record_size_v1 ?
+			count : //Not compressed
+			static_cast<std::streamsize>(detail::read_uint(record.substr(40), 8))};
+}
+
+std::optional<Entry> DataFileIndex::Find(std::string_view file_path) const
+{
+	if (auto off = OffsetOf(file_path); off)
+		return At(*off);
+	else
+		return {};
+}
+
+std::optional<int> DataFileIndex::OffsetOf(std::string_view file_path) const noexcept
+{
+	auto hash = utilities::crypto::FNV1a_64(file_path);
+	auto first = 0;
+	auto count = count_;
+
+	//Binary search for first record with the same name hash
+	while (count > 0)
+	{
+		auto step = count / 2;
+
+		if (detail::read_uint(Record(first + step), 8) < hash)
+		{
+			first += step + 1;
+			count -= step + 1;
+		}
+		else
+			count = step;
+	}
+
+	//Compare names of all records with the same name hash
+	for (auto off = first; off < count_ && detail::read_uint(Record(off), 8) == hash; ++off)
+	{
+		if (Name(Record(off)) == file_path)
+			return off;
+	}
+
+	return {};
+}
+
+data_file_index::Entries DataFileIndex::Entries() const
+{
+	data_file_index::Entries entries;
+	entries.reserve(count_);
+
+	for (auto off = 0; off < count_; ++off)
+	{
+		if (auto entry = At(off); entry)
+			entries.push_back(std::move(*entry));
+	}
+
+	return entries;
+}
+
+
+/*
+	Verifying
+*/
+
+bool DataFileIndex::Verify(int off, std::string_view bytes) const noexcept
+{
+	if (off < 0 || off >= count_)
+		return false;
+
+	//Already verified
+	if (verified_[off].load(std::memory_order_acquire))
+		return true;
+
+	if (data_file_index::Checksum(bytes) != detail::read_uint(Record(off).substr(24), 8))
+		return false;
+
+	verified_[off].store(true, std::memory_order_release);
+	return true;
+}
+
+} //ion::assets
\ No newline at end of file
@@ -0,0 +1,197 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	assets
+File:	IonDataFileIndex.h
+-------------------------------------------
+*/
+
+#ifndef ION_DATA_FILE_INDEX_H
+#define ION_DATA_FILE_INDEX_H
+
+#include <atomic>
+#include <filesystem>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types/IonTypes.h"
+#include "utilities/IonMappedFile.h"
+
+namespace ion::assets
+{
+	using namespace std::string_view_literals;
+	using namespace types::type_literals;
+
+	namespace data_file_index
+	{
+		struct Entry final
+		{
+			std::string Path;
+			std::streamoff Position = 0;
+			std::streamsize Count = 0;
+			uint64 Checksum = 0;
+			std::streamsize UncompressedCount = 0; //Same as count, if not compressed
+		};
+
+		using Entries = std::vector<Entry>;
+
+
+		namespace detail
+		{
+			/*
+				Binary table of contents (all integers are little endian)
+
+				[record 0] ... [record n-1] [names] [footer]
+				record: name hash (8) | position (8) | count (8) | checksum (8) | name offset (4) | name size (4) | uncompressed count (8)
+				footer: table offset (8) | record count (4) | version (4) | magic (8)
+
+				Records are sorted by name hash (then name), so that entries can be found by binary search.
+				Version 1 records have no uncompressed count (all files are uncompressed)
+			*/
+
+			constexpr auto table_magic = "ion toc\0"sv;
+			constexpr auto table_version = 2_ui32;
+			constexpr auto record_size_v1 = 40;
+			constexpr auto record_size = 48;
+			constexpr auto footer_size = 24;
+
+			struct table_footer
+			{
+				std::streamoff table_offset = 0;
+				std::streamsize table_size = 0; //Records and names
+				int count = 0;
+				int record_size = 0;
+			};
+
+
+			uint64 read_uint(std::string_view bytes, int size) noexcept;
+			void write_uint(std::string &bytes, uint64 value, int size);
+
+			std::optional<table_footer> read_footer(std::string_view footer, std::streamsize file_size) noexcept;
+		} //detail
+
+
+		/**
+			@name Functions
+			@{
+		*/
+
+		///@brief Returns the checksum of the given file bytes
+		///@details The checksum is calculated from the file bytes as stored in the data file (compressed or not)
+		[[nodiscard]] uint64 Checksum(std::string_view bytes) noexcept;
+
+		///@brief Returns a binary table of contents containing all of the given entries
+		///@details The given table offset is the position in the data file where the table will be saved
+		[[nodiscard]] std::string Serialize(const Entries &entries, std::streamoff table_offset);
+
+		///@}
+	} //data_file_index
+
+
+	///@brief A class representing a binary table of contents for a data file
+	///@details Entries are looked up directly in the table (by hash), without parsing every entry first.
+	///The table is either viewed in a memory mapped data file, or loaded from the end of the data file
+	class DataFileIndex final
+	{
+		private:
+
+			std::shared_ptr<const utilities::file::MappedFile> mapped_data_file_;
+			std::string table_data_; //If not mapped
+			std::size_t table_offset_ = 0; //Relative to the viewed bytes
+			std::size_t names_offset_ = 0;
+			std::size_t names_size_ = 0;
+			int count_ = 0;
+			int record_size_ = 0;
+			std::unique_ptr<std::atomic<bool>[]> verified_; //Entries that has matched their checksum
+
+
+			std::string_view Bytes() const noexcept;
+			std::string_view Record(int off) const noexcept;
+			std::string_view Name(std::string_view record) const noexcept;
+
+		public:
+
+			///@brief Default constructor
+			DataFileIndex() = default;
+
+
+			/**
+				@name Static loading
+				@{
+			*/
+
+			///@brief Loads the binary table of contents from the data file at the given path
+			///@details Only the footer and the table itself are read from the data file.
+			///Returns nullopt if the data file does not have a binary table of contents
+			[[nodiscard]] static std::optional<DataFileIndex> Load(const std::filesystem::path &data_file_path);
+
+			///@brief Loads the binary table of contents from the given memory mapped data file (zero-copy)
+			///@details Returns nullopt if the data file does not have a binary table of contents
+			[[nodiscard]] static std::optional<DataFileIndex> Load(std::shared_ptr<const utilities::file::MappedFile> mapped_data_file);
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the number of entries in this index
+			[[nodiscard]] inline auto Count() const noexcept
+			{
+				return count_;
+			}
+
+			///@brief Returns the memory mapped data file this index is viewing
+			///@details Returns nullptr if the index was loaded from the data file
+			[[nodiscard]] inline auto& MappedDataFile() const noexcept
+			{
+				return mapped_data_file_;
+			}
+
+			///@}
+
+			/**
+				@name Entries
+				@{
+			*/
+
+			///@brief Returns the entry at the given offset, in range [0, Count())
+			///@details Returns nullopt if the offset is out of range, or the entry is malformed
+			[[nodiscard]] std::optional<data_file_index::Entry> At(int off) const;
+
+			///@brief Returns the entry with the given file path
+			///@details Returns nullopt if no entry with the given file path was found
+			[[nodiscard]] std::optional<data_file_index::Entry> Find(std::string_view file_path) const;
+
+			///@brief Returns the offset of the entry with the given file path, in range [0, Count())
+			///@details Returns nullopt if no entry with the given file path was found
+			[[nodiscard]] std::optional<int> OffsetOf(std::string_view file_path) const noexcept;
+
+			///@brief Returns all entries in this index
+			[[nodiscard]] data_file_index::Entries Entries() const;
+
+			///@}
+
+			/**
+				@name Verifying
+				@{
+			*/
+
+			///@brief Returns true if the given file bytes matches the checksum of the entry at the given offset
+			///@details Each entry is only verified once, a match is cached and returned directly on later calls
+			[[nodiscard]] bool Verify(int off, std::string_view bytes) const noexcept;
+
+			///@}
+	};
+} //ion::assets
+
+#endif
\ No newline at end of file
@@ -12,6 +12,9 @@ File:	IonFileRepository.cpp
 
 #include "IonFileRepository.h"
 
+#include "assets/IonDataFileIndex.h"
+#include "utilities/IonCompression.h"
+
 namespace ion::assets::repositories
 {
 
@@ -55,9 +58,46 @@ std::string file_path_to_name(const std::filesystem::path &file_path, NamingConv
 		file_path.relative_path().generic_string();
 }
 
+bool verify_checksum(const FileLocation &data_file, std::string_view bytes) noexcept
+{
+	//Verified once, by the binary table of contents
+	if (data_file.Index)
+		return data_file.Index->Verify(data_file.IndexOffset, bytes);
+	else
+		return !data_file.Checksum || data_file_index::Checksum(bytes) == *data_file.Checksum;
+}
+
 } //detail
 
 
+//Private
+
+std::optional<FileEntry> FileRepository::FindDataFileEntry(std::string_view name) const
+{
+	//Only files matching a file extension
+	if (!std::empty(file_extensions_) &&
+		!file_extensions_.contains(std::filesystem::path{name}.extension().generic_string()))
+		return {};
+
+	for (auto &[data_file_path, data_file_index] : data_file_indices_)
+	{
+		if (auto off = data_file_index->OffsetOf(name); off)
+		{
+			if (auto entry = data_file_index->At(*off); entry)
+				return FileEntry{std::move(entry->Path), FileLocation{data_file_path,
+					entry->Position, entry->Count, data_file_index->MappedDataFile(), entry->Checksum,
+					entry->UncompressedCount != entry->Count ?
+						std::make_optional(entry->UncompressedCount) : std::nullopt,
+					data_file_index, *off}};
+		}
+	}
+
+	return {};
+}
+
+
+//Public
+
 FileRepository::FileRepository(NamingConvention naming_convention) noexcept :
 	naming_convention_{naming_convention}
 {
@@ -87,34 +127,73 @@ std::optional<FileEntry> FileRepository::File(std::string_view name) const noexc
 	auto iter = files_.find(name);
 	return iter != std::end(files_) ?
 		std::make_optional(iter->second) :
-		std::nullopt;
+		FindDataFileEntry(name);
 }
 
 std::optional<std::string> FileRepository::FileData(std::string_view name) const noexcept
 {
-	auto iter = files_.find(name);
-
-	if (iter != std::end(files_))
+	if (auto file = File(name); file)
 	{
 		std::string data;
 
 		//File is stored in a data file
-		if (iter->second.DataFile)
+		if (file->DataFile)
 		{
+			auto &data_file = *file->DataFile;
+			auto bytes = std::string_view{};
+
+			//View file in memory mapped data file [position, count)
+			if (data_file.Mapping)
+				bytes = data_file.Mapping->View(data_file.Position, data_file.Count);
 			//Load file from data file [position, count)
-			if (utilities::file::LoadPartOf(iter->second.DataFile->Path, data,
-				iter->second.DataFile->Position, iter->second.DataFile->Count,
+			else if (utilities::file::LoadPartOf(data_file.Path, data,
+				data_file.Position, data_file.Count,
 				ion::utilities::file::FileLoadMode::Binary))
-					return data;
+					bytes = data;
+			else
+				return {};
+
+			//File is corrupt (checksum mismatch)
+			if (!detail::verify_checksum(data_file, bytes))
+				return {};
+
+			//File is compressed
+			if (data_file.UncompressedCount)
+				return utilities::compression::Decompress(bytes, *data_file.UncompressedCount);
+			//Copy file from mapped data file
+			else if (data_file.Mapping)
+				return std::string{bytes};
+			else
+				return data;
 		}
 		//Load file from path
-		else if (utilities::file::Load(iter->second.Path, data, ion::utilities::file::FileLoadMode::Binary))
+		else if (utilities::file::Load(file->Path, data, ion::utilities::file::FileLoadMode::Binary))
 			return data;
 	}
 
 	return {};
 }
 
+std::optional<std::string_view> FileRepository::FileView(std::string_view name) const noexcept
+{
+	//File is stored uncompressed in a memory mapped data file
+	if (auto file = File(name);
+		file && file->DataFile && file->DataFile->Mapping &&
+		!file->DataFile->UncompressedCount)
+	{
+		auto &data_file = *file->DataFile;
+		auto bytes = data_file.Mapping->View(data_file.Position, data_file.Count);
+
+		//File is corrupt (checksum mismatch)
+		if (!detail::verify_checksum(data_file, bytes))
+			return {};
+
+		return bytes;
+	}
+	else
+		return {};
+}
+
 std::optional<std::filesystem::path> FileRepository::FilePath(std::string_view name) const noexcept
 {
 	auto file = File(name);
@@ -233,6 +312,26 @@ bool FileRepository::AddFiles(std::vector<file_repository::FileEntry> files)
 	return files_.insert(file_container);
 }
 
+bool FileRepository::AddDataFileIndex(std::filesystem::path data_file_path, std::shared_ptr<const DataFileIndex> data_file_index)
+{
+	//Entries can only be looked up by file path
+	if (!data_file_index || naming_convention_ != NamingConvention::FilePath)
+		return false;
+
+	//Data file index already added, replace index
+	if (auto iter = std::find_if(std::begin(data_file_indices_), std::end(data_file_indices_),
+			[&](auto &x) noexcept
+			{
+				return x.first == data_file_path;
+			});
+		iter != std::end(data_file_indices_))
+		iter->second = std::move(data_file_index);
+	else
+		data_file_indices_.emplace_back(std::move(data_file_path), std::move(data_file_index));
+
+	return true;
+}
+
 
 /*
 	Adding file extensions
@@ -264,6 +363,8 @@ void FileRepository::ClearFiles() noexcept
 {
 	files_.clear();
 	files_.shrink_to_fit();
+	data_file_indices_.clear();
+	data_file_indices_.shrink_to_fit();
 }
 
 void FileRepository::ClearFileExtensions() noexcept
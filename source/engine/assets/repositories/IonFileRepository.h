@@ -16,6 +16,7 @@ files:	IonFileRepository.h
 #include <algorithm>
 #include <filesystem>
 #include <iosfwd>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -25,11 +26,17 @@ files:	IonFileRepository.h
 #include "adaptors/IonFlatSet.h"
 #include "types/IonTypes.h"
 #include "utilities/IonFileUtility.h"
+#include "utilities/IonMappedFile.h"
 
 #ifdef RemoveDirectory
 #undef RemoveDirectory
 #endif
 
+namespace ion::assets
+{
+	class DataFileIndex;
+}
+
 namespace ion::assets::repositories
 {
 	using namespace std::string_view_literals;
@@ -47,6 +54,11 @@ namespace ion::assets::repositories
 			std::filesystem::path Path;
 			std::streamoff Position = 0;
 			std::streamsize Count = 0;
+			std::shared_ptr<const utilities::file::MappedFile> Mapping; //If data file is memory mapped
+			std::optional<uint64> Checksum; //If data file has a binary table of contents
+			std::optional<std::streamsize> UncompressedCount; //If file is compressed
+			std::shared_ptr<const DataFileIndex> Index; //If data file has a binary table of contents
+			int IndexOffset = 0; //Offset of the entry in the index
 		};
 
 		struct FileEntry final
@@ -60,6 +72,8 @@ namespace ion::assets::repositories
 		{
 			constexpr auto file_extensions_delimiter = "/"sv;
 
+			using data_file_indices = std::vector<std::pair<std::filesystem::path, std::shared_ptr<const DataFileIndex>>>;
+
 
 			template <typename T>
 			inline auto filter_by_file_extensions(utilities::file::Paths file_paths, const T &file_extensions) noexcept
@@ -103,6 +117,7 @@ namespace ion::assets::repositories
 			std::vector<FileEntry> filter_by_file_extension(std::vector<FileEntry> files, std::string_view file_extension) noexcept;
 
 			std::string file_path_to_name(const std::filesystem::path &file_path, NamingConvention naming_convention) noexcept;
+			bool verify_checksum(const FileLocation &data_file, std::string_view bytes) noexcept;
 		} //detail
 	} //file_repository
 
@@ -116,6 +131,10 @@ namespace ion::assets::repositories
 
 			adaptors::FlatMap<std::string, file_repository::FileEntry> files_;
 			adaptors::FlatSet<std::string> file_extensions_;
+			file_repository::detail::data_file_indices data_file_indices_; //Files resolved lazily
+
+
+			std::optional<file_repository::FileEntry> FindDataFileEntry(std::string_view name) const;
 
 		public:
 
@@ -140,11 +159,21 @@ namespace ion::assets::repositories
 			*/
 
 			///@brief Returns the file entry that is stored in this repository with the given name
+			///@details Files in an added data file index are resolved (lazily) if not found among the added files
 			[[nodiscard]] std::optional<file_repository::FileEntry> File(std::string_view name) const noexcept;
 
 			///@brief Returns the file data that is stored in this repository with the given name
+			///@details Compressed files are decompressed on demand.
+			///Returns nullopt if the file is stored in a data file and does not match its checksum.
+			///Each file in a data file with a binary table of contents is only verified once
 			[[nodiscard]] std::optional<std::string> FileData(std::string_view name) const noexcept;
 
+			///@brief Returns a view of the file data that is stored in this repository with the given name
+			///@details Only uncompressed files stored in a memory mapped data file can be viewed (zero-copy), returns nullopt otherwise.
+			///The view is valid for as long as the asset loader (or any file entry) referencing the mapped data file lives.
+			///Returns nullopt if the file does not match its checksum, each file is only verified once per mapping
+			[[nodiscard]] std::optional<std::string_view> FileView(std::string_view name) const noexcept;
+
 			///@brief Returns the file path that is stored in this repository with the given name
 			[[nodiscard]] std::optional<std::filesystem::path> FilePath(std::string_view name) const noexcept;
 
@@ -160,20 +189,35 @@ namespace ion::assets::repositories
 
 			///@}
 
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the naming convention used by this repository
+			[[nodiscard]] inline auto FileNamingConvention() const noexcept
+			{
+				return naming_convention_;
+			}
+
+			///@}
+
 			/**
 				@name Ranges
 				@{
 			*/
 
 			///@brief Returns a mutable range of all files in this repository
-			///@details This can be used directly with a range-based for loop
+			///@details This can be used directly with a range-based for loop.
+			///Files in an added data file index are not included
 			[[nodiscard]] inline auto Files() noexcept
 			{
 				return files_.Elements();
 			}
 
 			///@brief Returns an immutable range of all files in this repository
-			///@details This can be used directly with a range-based for loop
+			///@details This can be used directly with a range-based for loop.
+			///Files in an added data file index are not included
 			[[nodiscard]] inline auto Files() const noexcept
 			{
 				return files_.Elements();
@@ -235,6 +279,12 @@ namespace ion::assets::repositories
 			///@details Files are not filtered against added file extensions
 			bool AddFiles(std::vector<file_repository::FileEntry> files);
 
+			///@brief Adds all files in the given data file index, without reading any entries
+			///@details Files are resolved by file path when looked up, and filtered against added file extensions.
+			///Replaces any index already added for the same data file.
+			///Returns false if this repository does not use the file path naming convention
+			bool AddDataFileIndex(std::filesystem::path data_file_path, std::shared_ptr<const DataFileIndex> data_file_index);
+
 			///@}
 
 			/**
@@ -260,7 +310,7 @@ namespace ion::assets::repositories
 			///@brief Removes all files and file extensions
 			void Clear() noexcept;
 
-			///@brief Removes all files
+			///@brief Removes all files (and data file indices)
 			void ClearFiles() noexcept;
 
 			///@brief Removes all file extensions
@@ -31,7 +31,7 @@ namespace font_manager::detail
 {
 
 std::optional<std::tuple<font::GlyphBitmapData, font::GlyphMetrices, font::GlyphMaxMetric>> prepare_font(
-	const std::string &file_data, int size, int face_index,
+	std::string_view file_data, int size, int face_index,
 	int character_spacing, font::FontCharacterSet character_set)
 {
 	FT_Library library = nullptr;
@@ -230,9 +230,9 @@ void unload_font(const font::GlyphTextureHandle &glyph_handle) noexcept
 
 bool FontManager::PrepareResource(Font &font)
 {
-	if (FileResourceManager::PrepareResource(font))
+	if (FileResourceManager::PrepareResourceView(font))
 	{
-		if (auto font_data = detail::prepare_font(*font.FileData(),
+		if (auto font_data = detail::prepare_font(*font.FileBytes(),
 			font.Size(), font.FaceIndex(), font.CharacterSpacing(), font.CharacterSet()); font_data)
 		{
 			auto &[glyph_data, glyph_metrics, glyph_max_metrics] = *font_data;
@@ -292,6 +292,30 @@ bool FontManager::UnloadResource(Font &font) noexcept
 		return false;
 }
 
+std::size_t FontManager::ResourceSize(const Font &font) const noexcept
+{
+	auto &glyph_metrics = font.GlyphMetrics();
+	auto &glyph_max_metrics = font.GlyphMaxMetrics();
+
+	if (!glyph_metrics || !glyph_max_metrics)
+		return FileResourceManager::ResourceSize(font);
+
+	auto array_texture = font.GlyphHandle() ?
+		font.GlyphHandle()->Type == textures::texture::TextureType::ArrayTexture2D :
+		glyph_texture_type_ == font_manager::GlyphTextureType::ArrayTexture2D;
+
+	auto size = std::size_t{0};
+
+	//Each glyph is stored as RGBA8 (4 bytes per pixel)
+	//Glyphs in an array texture all have the max size
+	for (auto &glyph_metric : *glyph_metrics)
+		size += array_texture ?
+			static_cast<std::size_t>(glyph_max_metrics->ActualWidth) * glyph_max_metrics->ActualHeight * 4 :
+			static_cast<std::size_t>(glyph_metric.ActualWidth) * glyph_metric.ActualHeight * 4;
+
+	return size;
+}
+
 
 void FontManager::ResourceLoaded(Font &font) noexcept
 {
@@ -42,7 +42,7 @@ namespace ion::graphics::fonts
 		namespace detail
 		{
 			std::optional<std::tuple<font::GlyphBitmapData, font::GlyphMetrices, font::GlyphMaxMetric>> prepare_font(
-				const std::string &file_data, int size, int face_index,
+				std::string_view file_data, int size, int face_index,
 				int character_spacing, font::FontCharacterSet character_set);
 
 			std::optional<font::GlyphTextureHandle> load_font(
@@ -75,6 +75,10 @@ namespace ion::graphics::fonts
 			bool LoadResource(Font &font) override;
 			bool UnloadResource(Font &font) noexcept override;
 
+			///@brief See FileResourceManager::ResourceSize for more details
+			///@details Returns the size of the glyph textures, if prepared or loaded
+			std::size_t ResourceSize(const Font &font) const noexcept override;
+
 
 			///@brief See FileResourceManager::ResourceLoaded for more details
 			void ResourceLoaded(Font &font) noexcept override;
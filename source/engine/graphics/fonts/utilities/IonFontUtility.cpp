@@ -765,6 +765,10 @@ Font* get_font(const TypeFace &type_face, const std::optional<text::TextFontStyl
 
 const font::GlyphMetrices* get_glyph_metrics(Font &font)
 {
+	//Keep font resident
+	if (auto owner = font.Owner(); owner)
+		owner->Use(font);
+
 	if (font.IsLoaded() || (font.Owner() && font.Owner()->Load(font)))
 	{
 		if (auto &metrics = font.GlyphMetrics(); metrics)
@@ -143,6 +143,38 @@ std::pair<bool, bool> is_texture_map_repeatable(const Texture &texture,
 		return {false, false};
 }
 
+bool is_texture_map_batchable(const texture_map_type &texture_map, const texture_map_type &other_texture_map) noexcept
+{
+	auto [animation, texture] = get_texture_maps(texture_map);
+	auto [other_animation, other_texture] = get_texture_maps(other_texture_map);
+
+	//Animations need to be the same
+	if (animation || other_animation)
+		return animation == other_animation;
+	//Textures need to be bound to the same texture (page)
+	else if (texture && other_texture)
+		return texture == other_texture ||
+			(texture->PageRegion() && texture->Handle() && texture->Handle() == other_texture->Handle());
+	else
+		return !texture && !other_texture;
+}
+
+
+void exclude_from_texture_packing(const texture_map_type &diffuse_map, const texture_map_type &normal_map,
+	const texture_map_type &specular_map, const texture_map_type &emissive_map) noexcept
+{
+	//All texture maps are sampled with the same tex coords (from the first texture map)
+	//Only a single diffuse map can be packed into a texture page
+	if (get_texture_map(normal_map) || get_texture_map(specular_map) || get_texture_map(emissive_map))
+	{
+		for (auto texture_map : {&diffuse_map, &normal_map, &specular_map, &emissive_map})
+		{
+			if (auto [animation, texture] = get_texture_maps(*texture_map); texture)
+				texture->Packable(false);
+		}
+	}
+}
+
 } //material::detail
 
 
@@ -214,7 +246,7 @@ Material::Material(std::string name, NonOwningPtr<Animation> diffuse_map,
 	specular_map_{specular_map},
 	emissive_map_{emissive_map}
 {
-	//Empty
+	detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 }
 
 Material::Material(std::string name, NonOwningPtr<Texture> diffuse_map,
@@ -232,7 +264,7 @@ Material::Material(std::string name, NonOwningPtr<Texture> diffuse_map,
 	specular_map_{specular_map},
 	emissive_map_{emissive_map}
 {
-	//Empty
+	detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 }
 
 Material::Material(std::string name, NonOwningPtr<Animation> diffuse_map,
@@ -252,7 +284,7 @@ Material::Material(std::string name, NonOwningPtr<Animation> diffuse_map,
 	specular_map_{specular_map},
 	emissive_map_{emissive_map}
 {
-	//Empty
+	detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 }
 
 Material::Material(std::string name, NonOwningPtr<Texture> diffuse_map,
@@ -272,7 +304,7 @@ Material::Material(std::string name, NonOwningPtr<Texture> diffuse_map,
 	specular_map_{specular_map},
 	emissive_map_{emissive_map}
 {
-	//Empty
+	detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 }
 
 
@@ -341,6 +373,25 @@ NonOwningPtr<Texture> Material::EmissiveMap(duration time) const noexcept
 }
 
 
+bool Material::IsBatchableWith(const Material &material) const noexcept
+{
+	return ambient_color_ == material.ambient_color_ &&
+		   diffuse_color_ == material.diffuse_color_ &&
+		   specular_color_ == material.specular_color_ &&
+		   emissive_color_ == material.emissive_color_ &&
+		   shininess_ == material.shininess_ &&
+		   emissive_light_radius_ == material.emissive_light_radius_ &&
+		   lighting_enabled_ == material.lighting_enabled_ &&
+		   receive_shadows_ == material.receive_shadows_ &&
+
+		   //Check texture maps last
+		   detail::is_texture_map_batchable(diffuse_map_, material.diffuse_map_) &&
+		   detail::is_texture_map_batchable(normal_map_, material.normal_map_) &&
+		   detail::is_texture_map_batchable(specular_map_, material.specular_map_) &&
+		   detail::is_texture_map_batchable(emissive_map_, material.emissive_map_);
+}
+
+
 /*
 	Texture coordinates
 */
@@ -111,6 +111,10 @@ namespace ion::graphics::materials
 
 		std::pair<bool, bool> is_texture_map_repeatable(const Texture &texture,
 			const Vector2 &lower_left, const Vector2 &upper_right) noexcept;
+		bool is_texture_map_batchable(const texture_map_type &texture_map, const texture_map_type &other_texture_map) noexcept;
+
+		void exclude_from_texture_packing(const texture_map_type &diffuse_map, const texture_map_type &normal_map,
+			const texture_map_type &specular_map, const texture_map_type &emissive_map) noexcept;
 
 		///@}
 	} //material::detail
@@ -231,12 +235,14 @@ namespace ion::graphics::materials
 			inline void DiffuseMap(NonOwningPtr<Animation> animation) noexcept
 			{
 				diffuse_map_ = animation;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Attaches the given texture as a diffuse map for the material
 			inline void DiffuseMap(NonOwningPtr<Texture> texture) noexcept
 			{
 				diffuse_map_ = texture;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Detaches the diffuse map from the material
@@ -250,12 +256,14 @@ namespace ion::graphics::materials
 			inline void NormalMap(NonOwningPtr<Animation> animation) noexcept
 			{
 				normal_map_ = animation;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Attaches the given texture as a normal map for the material
 			inline void NormalMap(NonOwningPtr<Texture> texture) noexcept
 			{
 				normal_map_ = texture;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Detaches the normal map from the material
@@ -269,12 +277,14 @@ namespace ion::graphics::materials
 			inline void SpecularMap(NonOwningPtr<Animation> animation) noexcept
 			{
 				specular_map_ = animation;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Attaches the given texture as a specular map for the material
 			inline void SpecularMap(NonOwningPtr<Texture> texture) noexcept
 			{
 				specular_map_ = texture;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Detaches the specular map from the material
@@ -291,6 +301,7 @@ namespace ion::graphics::materials
 					emissive_color_ = color::White;
 
 				emissive_map_ = animation;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Attaches the given texture as a emissive map for the material
@@ -300,6 +311,7 @@ namespace ion::graphics::materials
 					emissive_color_ = color::White;
 
 				emissive_map_ = texture;
+				material::detail::exclude_from_texture_packing(diffuse_map_, normal_map_, specular_map_, emissive_map_);
 			}
 
 			///@brief Detaches the emissive map from the material
@@ -448,6 +460,12 @@ namespace ion::graphics::materials
 				return receive_shadows_;
 			}
 
+
+			///@brief Returns true if this material can be drawn in the same batch as the given material
+			///@details Materials are batchable if all properties are equal, and all texture maps are bound to the same texture.
+			///Textures packed into the same texture page are bound to the same texture, even if loaded from different files
+			[[nodiscard]] bool IsBatchableWith(const Material &material) const noexcept;
+
 			///@}
 
 			/**
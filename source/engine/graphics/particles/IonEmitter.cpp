@@ -12,6 +12,11 @@ File:	IonEmitter.cpp
 
 #include "IonEmitter.h"
 
+#include <limits>
+
+#include "parallel/IonTaskScheduler.h"
+#include "utilities/IonSimd.h"
+
 namespace ion::graphics::particles
 {
 
@@ -21,26 +26,122 @@ using namespace ion::utilities;
 namespace emitter::detail
 {
 
-void evolve_particles(container_type<Particle> &particles, duration time) noexcept
+void evolve_particles(ParticleStorage &particles, int first, int last, duration time) noexcept
 {
-	auto end = std::end(particles);
-	auto last = end;
+	auto position_x = particles.PositionX();
+	auto position_y = particles.PositionY();
+	auto direction_x = particles.DirectionX();
+	auto direction_y = particles.DirectionY();
+	auto lifetime = particles.LifetimeTotal();
+
+	simd::ForEach(first, last,
+		[&, seconds = time.count()]<typename Pack>(int i) noexcept
+		{
+			auto t = Pack::Broadcast(seconds);
+			(Pack::Load(lifetime + i) + t).Store(lifetime + i);
+			(Pack::Load(position_x + i) + Pack::Load(direction_x + i) * t).Store(position_x + i);
+			(Pack::Load(position_y + i) + Pack::Load(direction_y + i) * t).Store(position_y + i);
+		});
+}
 
-	for (auto iter = std::begin(particles); iter != last;)
+void remove_ended_particles(ParticleStorage &particles) noexcept
+{
+	auto lifetime = particles.LifetimeTotal();
+	auto lifetime_limit = particles.LifetimeLimit();
+	auto last = particles.Count();
+
+	for (auto i = 0; i < last;)
 	{
 		//Particle lifetime has ended
-		if (!iter->Evolve(time))
-			*iter = std::move(*--last); //Move last active particle
+		if (lifetime[i] >= lifetime_limit[i])
+			particles.Move(--last, i); //Move last active particle
 		else
-			++iter;
+			++i;
 	}
 
-	particles.erase(last, end);
+	particles.Truncate(last);
 }
 
 } //emitter::detail
 
 
+//Private
+
+void Emitter::ElapseParticles(duration time, affectors::AffectorManager *global_affectors) noexcept
+{
+	//Random numbers drawn by local affectors (once per frame) come from this emitter's stream
+	random::StreamScope stream_scope{random_stream_};
+
+	if (emitting_)
+	{
+		if (emission_duration_ && (*emission_duration_ += time))
+			Reset();
+
+		else if (emission_amount_ += emission_rate_ * time.count())
+		{
+			Emit(static_cast<int>(emission_amount_.Total())); //Emit total number of particles (whole part)
+			emission_amount_.Total(math::Fraction(emission_amount_.Total())); //Keep fractional part for next emission
+		}
+	}
+
+	//Elapse local affectors (once per frame)
+	for (auto &affector : Affectors())
+		affector.Elapse(time);
+
+	if (particles_.Empty())
+		return;
+
+	auto &scheduler = parallel::TaskScheduler::Instance();
+
+	//Evolve particles (even when not emitting)
+	if (auto chunk_count = detail::chunk_count(particles_.Count()); chunk_count > 1)
+		scheduler.ParallelFor(0, chunk_count,
+			[&](int chunk) noexcept
+			{
+				detail::evolve_particles(particles_,
+					chunk * detail::particle_chunk_size,
+					std::min((chunk + 1) * detail::particle_chunk_size, particles_.Count()), time);
+			});
+	else
+		detail::evolve_particles(particles_, 0, particles_.Count(), time);
+
+	detail::remove_ended_particles(particles_);
+
+	if (particles_.Empty())
+		return;
+
+	//Each chunk draws random numbers from its own stream, seeded from this emitter's stream
+	//This makes the result independent of the number of threads used
+	auto seed = random_stream_.Number(uint64{0}, std::numeric_limits<uint64>::max());
+	auto affect_chunk =
+		[&](int chunk) noexcept
+		{
+			auto chunk_stream = random::Stream{seed + static_cast<uint64>(chunk)};
+			random::StreamScope chunk_stream_scope{chunk_stream};
+
+			auto particles = ParticleRange{particles_,
+				chunk * detail::particle_chunk_size, (chunk + 1) * detail::particle_chunk_size};
+
+			//Affect particles (even when not emitting)
+			for (auto &affector : Affectors())
+				affector.Affect(particles, time);
+
+			if (global_affectors)
+			{
+				for (auto &affector : global_affectors->Affectors())
+					affector.Affect(particles, time);
+			}
+		};
+
+	if (auto chunk_count = detail::chunk_count(particles_.Count()); chunk_count > 1)
+		scheduler.ParallelFor(0, chunk_count, affect_chunk);
+	else
+		affect_chunk(0);
+}
+
+
+//Public
+
 Emitter::Emitter(std::string name) noexcept :
 	managed::ManagedObject<EmitterManager>{std::move(name)}
 {
@@ -119,6 +220,9 @@ OwningPtr<Emitter> Emitter::Clone() const
 	emitter->particle_lifetime_ = particle_lifetime_;
 	emitter->particle_material_ = particle_material_;
 
+	if (random_seed_)
+		emitter->RandomSeed(*random_seed_);
+
 	//Clone local affectors
 	for (auto &affector : Affectors())
 		emitter->AffectorManager::Adopt(affector.Clone());
@@ -164,25 +268,12 @@ void Emitter::Restart() noexcept
 
 void Emitter::Elapse(duration time) noexcept
 {
-	if (emitting_)
-	{
-		if (emission_duration_ && (*emission_duration_ += time))
-			Reset();
-
-		else if (emission_amount_ += emission_rate_ * time.count())
-		{
-			Emit(static_cast<int>(emission_amount_.Total())); //Emit total number of particles (whole part)
-			emission_amount_.Total(math::Fraction(emission_amount_.Total())); //Keep fractional part for next emission
-		}
-	}
-
-	//Evolve particles (even when not emitting)
-	if (!std::empty(particles_))
-		detail::evolve_particles(particles_, time);
+	ElapseParticles(time, nullptr);
+}
 
-	//Affect particles (even when not emitting)
-	for (auto &affector : Affectors())
-		affector.Affect(Particles(), time);
+void Emitter::Elapse(duration time, affectors::AffectorManager &global_affectors) noexcept
+{
+	ElapseParticles(time, &global_affectors);
 }
 
 
@@ -192,18 +283,21 @@ void Emitter::Elapse(duration time) noexcept
 
 void Emitter::Emit(int particle_count) noexcept
 {
-	for (particle_count = std::min(particle_count, particle_quota_ - std::ssize(particles_));
+	//Draw all random numbers from this emitter's stream, in a fixed order
+	for (particle_count = std::min(particle_count, particle_quota_ - particles_.Count());
 		particle_count > 0; --particle_count)
-
-		particles_.emplace_back(
-			position_ + detail::particle_position(type_, size_ * 0.5_r, inner_size_ * 0.5_r), //Position
-			detail::particle_direction(direction_, emission_angle_, particle_velocity_.first, particle_velocity_.second), //Direction + velocity
-			detail::particle_size(particle_size_.first, particle_size_.second), //Size
-			detail::particle_mass(particle_mass_.first, particle_mass_.second), //Mass
-			detail::particle_color(particle_color_.first, particle_color_.second), //Color
-			detail::particle_lifetime(particle_lifetime_.first, particle_lifetime_.second), //Lifetime
+	{
+		auto position = position_ + detail::particle_position(type_, size_ * 0.5_r, inner_size_ * 0.5_r, random_stream_);
+		auto direction = detail::particle_direction(direction_, emission_angle_, particle_velocity_.first, particle_velocity_.second, random_stream_); //Direction + velocity
+		auto size = detail::particle_size(particle_size_.first, particle_size_.second, random_stream_);
+		auto mass = detail::particle_mass(particle_mass_.first, particle_mass_.second, random_stream_);
+		auto color = detail::particle_color(particle_color_.first, particle_color_.second, random_stream_);
+		auto lifetime = detail::particle_lifetime(particle_lifetime_.first, particle_lifetime_.second, random_stream_);
+
+		particles_.Add(position, direction, size, mass, color, lifetime,
 			direction_ //Initial direction
 		);
+	}
 }
 
 /*
@@ -212,7 +306,7 @@ void Emitter::Emit(int particle_count) noexcept
 
 void Emitter::ClearParticles() noexcept
 {
-	particles_.clear();
+	particles_.Clear();
 }
 
 } //ion::graphics::particles
\ No newline at end of file
@@ -20,7 +20,7 @@ File:	IonEmitter.h
 #include <vector>
 
 #include "IonParticle.h"
-#include "adaptors/ranges/IonIterable.h"
+#include "IonParticleStorage.h"
 #include "affectors/IonAffectorManager.h"
 #include "graphics/utilities/IonColor.h"
 #include "graphics/utilities/IonVector2.h"
@@ -62,6 +62,7 @@ namespace ion::graphics::particles
 		{
 			template <typename T>
 			using container_type = std::vector<T>;
+			using random_stream = ion::utilities::random::Stream;
 
 
 			inline auto box_coordinate(real coord, real rand, real half_size, real half_inner_size1, real half_inner_size2) noexcept
@@ -71,90 +72,101 @@ namespace ion::graphics::particles
 						half_size * rand;
 			}
 
-			inline auto position_inside_box(const Vector2 &half_size, const Vector2 &half_inner_size) noexcept
+			inline auto position_inside_box(const Vector2 &half_size, const Vector2 &half_inner_size, random_stream &stream) noexcept
 			{
-				using namespace ion::utilities;
-
-				if (random::Number(0, 1))
+				if (stream.Number(0, 1))
 				{
-					auto x = half_size.X() * random::Number(-1.0_r, 1.0_r);
-					return Vector2{x, box_coordinate(x, random::Number(-1.0_r, 1.0_r), half_size.Y(), half_inner_size.X(), half_inner_size.Y())};
+					auto x = half_size.X() * stream.Number(-1.0_r, 1.0_r);
+					return Vector2{x, box_coordinate(x, stream.Number(-1.0_r, 1.0_r), half_size.Y(), half_inner_size.X(), half_inner_size.Y())};
 				}
 				else
 				{
-					auto y = half_size.Y() * random::Number(-1.0_r, 1.0_r);
-					return Vector2{box_coordinate(y, random::Number(-1.0_r, 1.0_r), half_size.X(), half_inner_size.Y(), half_inner_size.X()), y};
+					auto y = half_size.Y() * stream.Number(-1.0_r, 1.0_r);
+					return Vector2{box_coordinate(y, stream.Number(-1.0_r, 1.0_r), half_size.X(), half_inner_size.Y(), half_inner_size.X()), y};
 				}
 			}
 
-			inline auto position_inside_ring(const Vector2 &half_size, const Vector2 &half_inner_size) noexcept
+			inline auto position_inside_ring(const Vector2 &half_size, const Vector2 &half_inner_size, random_stream &stream) noexcept
 			{
 				using namespace ion::utilities;
 
-				auto theta = math::TwoPi * random::Number();
-				auto radius = (half_size - half_inner_size) * random::Number() + half_inner_size;
+				auto theta = math::TwoPi * stream.Number(0.0_r, 1.0_r);
+				auto radius = (half_size - half_inner_size) * stream.Number(0.0_r, 1.0_r) + half_inner_size;
 				return Vector2{radius.X() * math::Cos(theta),
 							   radius.Y() * math::Sin(theta)};
 			}
 
 
-			inline auto particle_position(EmitterType emitter_type, const Vector2 &half_size, const Vector2 &half_inner_size) noexcept
+			inline auto particle_position(EmitterType emitter_type, const Vector2 &half_size, const Vector2 &half_inner_size, random_stream &stream) noexcept
 			{
 				switch (emitter_type)
 				{
 					case EmitterType::Box:
-					return position_inside_box(half_size, half_inner_size);
+					return position_inside_box(half_size, half_inner_size, stream);
 
 					case EmitterType::Ring:
-					return position_inside_ring(half_size, half_inner_size);
+					return position_inside_ring(half_size, half_inner_size, stream);
 
 					default: //Point
 					return utilities::vector2::Zero;
 				}
 			}
 
-			inline auto particle_velocity(real min_velocity, real max_velocity)
+			inline auto particle_velocity(real min_velocity, real max_velocity, random_stream &stream)
 			{
-				return ion::utilities::random::Number(min_velocity, max_velocity);
+				return stream.Number(min_velocity, max_velocity);
 			}
 
-			inline auto particle_direction(const Vector2 &direction, real angle)
+			inline auto particle_direction(const Vector2 &direction, real angle, random_stream &stream)
 			{
-				return direction.RandomDeviant(angle);
+				return direction.Deviant(angle * stream.Number(-1.0_r, 1.0_r));
 			}
 
-			inline auto particle_direction(const Vector2 &direction, real angle, real min_velocity, real max_velocity)
+			inline auto particle_direction(const Vector2 &direction, real angle, real min_velocity, real max_velocity, random_stream &stream)
 			{
-				return particle_direction(direction, angle) * particle_velocity(min_velocity, max_velocity);
+				auto deviant_direction = particle_direction(direction, angle, stream);
+				return deviant_direction * particle_velocity(min_velocity, max_velocity, stream);
 			}
 
-			inline auto particle_size(const Vector2 &min_size, const Vector2 &max_size)
+			inline auto particle_size(const Vector2 &min_size, const Vector2 &max_size, random_stream &stream)
 			{
-				using namespace ion::utilities;
-
 				auto [min_x, min_y] = min_size.XY();
 				auto [max_x, max_y] = max_size.XY();
-				return Vector2{random::Number(min_x, max_x),
-							   random::Number(min_y, max_y)};
+				auto x = stream.Number(min_x, max_x);
+				auto y = stream.Number(min_y, max_y);
+				return Vector2{x, y};
 			}
 
-			inline auto particle_mass(real min_mass, real max_mass)
+			inline auto particle_mass(real min_mass, real max_mass, random_stream &stream)
 			{
-				return ion::utilities::random::Number(min_mass, max_mass);
+				return stream.Number(min_mass, max_mass);
 			}
 
-			inline auto particle_color(const Color &from_color, const Color &to_color)
+			inline auto particle_color(const Color &from_color, const Color &to_color, random_stream &stream)
 			{
-				return from_color.MixCopy(to_color, ion::utilities::random::Number());
+				return from_color.MixCopy(to_color, stream.Number(0.0_r, 1.0_r));
 			}
 
-			inline auto particle_lifetime(duration min_lifetime, duration max_lifetime)
+			inline auto particle_lifetime(duration min_lifetime, duration max_lifetime, random_stream &stream)
 			{
-				return duration{ion::utilities::random::Number(min_lifetime.count(), max_lifetime.count())};
+				return duration{stream.Number(min_lifetime.count(), max_lifetime.count())};
 			}
 
 
-			void evolve_particles(container_type<Particle> &particles, duration time) noexcept;
+			constexpr auto particle_chunk_size = 4096; //Particles are evolved and affected in chunks (in parallel)
+
+
+			///@brief Evolves the particles in range [first, last) by the given time in seconds
+			///@details Lifetimes and positions are updated with SIMD instructions (if available)
+			void evolve_particles(ParticleStorage &particles, int first, int last, duration time) noexcept;
+
+			///@brief Removes all particles with ended lifetime, by moving the last active particles in their place
+			void remove_ended_particles(ParticleStorage &particles) noexcept;
+
+			inline auto chunk_count(int particle_count) noexcept
+			{
+				return (particle_count + particle_chunk_size - 1) / particle_chunk_size;
+			}
 		} //detail
 	} //emitter
 
@@ -180,7 +192,9 @@ namespace ion::graphics::particles
 			bool emitting_ = false;
 			Cumulative<real> emission_amount_{1.0_r};
 
-			emitter::detail::container_type<Particle> particles_;
+			ParticleStorage particles_;
+			ion::utilities::random::Stream random_stream_;
+			std::optional<uint64> random_seed_;
 
 
 			//Initial spawn values for each new particle, in range [first, second]
@@ -192,6 +206,9 @@ namespace ion::graphics::particles
 			std::pair<duration, duration> particle_lifetime_;
 			NonOwningPtr<materials::Material> particle_material_;
 
+
+			void ElapseParticles(duration time, affectors::AffectorManager *global_affectors) noexcept;
+
 		public:
 
 			///@brief Constructs a new emitter with the given name
@@ -313,8 +330,17 @@ namespace ion::graphics::particles
 				particle_quota_ = quota > 0 ? quota : 0;
 
 				//Erase all particles that does not fit quota
-				if (particle_quota_ < std::ssize(particles_))
-					particles_.erase(std::begin(particles_) + particle_quota_, std::end(particles_));
+				if (particle_quota_ < particles_.Count())
+					particles_.Truncate(particle_quota_);
+			}
+
+			///@brief Sets the random seed of this emitter to the given value
+			///@details All random numbers used by this emitter and its affectors are drawn from a stream with this seed.
+			///An emitter with a given seed produces the same particles each time, regardless of how many threads are used
+			inline void RandomSeed(uint64 seed) noexcept
+			{
+				random_seed_ = seed;
+				random_stream_.Seed(seed);
 			}
 
 			///@}
@@ -398,6 +424,13 @@ namespace ion::graphics::particles
 				return emitting_;
 			}
 
+			///@brief Returns the random seed of this emitter
+			///@details Returns nullopt if no random seed has been set (seeded from the global random engine)
+			[[nodiscard]] inline auto RandomSeed() const noexcept
+			{
+				return random_seed_;
+			}
+
 			///@}
 
 			/**
@@ -542,9 +575,15 @@ namespace ion::graphics::particles
 			*/
 
 			///@brief Elapses emitter by the given time in seconds
-			///@details This function is typically called each frame, with the time in seconds since last frame
+			///@details This function is typically called each frame, with the time in seconds since last frame.
+			///Large numbers of particles are evolved and affected in chunks, in parallel
 			void Elapse(duration time) noexcept;
 
+			///@brief Elapses emitter by the given time in seconds, and affects its particles with the given global affectors
+			///@details This function is typically called each frame, with the time in seconds since last frame.
+			///Large numbers of particles are evolved and affected in chunks, in parallel
+			void Elapse(duration time, affectors::AffectorManager &global_affectors) noexcept;
+
 			///@}
 
 			/**
@@ -568,7 +607,7 @@ namespace ion::graphics::particles
 			///@brief Returns true if this emitter has any active particles
 			[[nodiscard]] inline auto HasActiveParticles() const noexcept
 			{
-				return !std::empty(particles_);
+				return !particles_.Empty();
 			}
 
 			///@}
@@ -578,18 +617,18 @@ namespace ion::graphics::particles
 				@{
 			*/
 
-			///@brief Returns a mutable range of all particles in this emitter
-			///@details This can be used directly with a range-based for loop
-			[[nodiscard]] inline auto Particles() noexcept
+			///@brief Returns a mutable reference to the storage of all particles in this emitter
+			///@details The particles are stored as a structure of arrays
+			[[nodiscard]] inline auto& Particles() noexcept
 			{
-				return adaptors::ranges::Iterable<emitter::detail::container_type<Particle>&>{particles_};
+				return particles_;
 			}
 
-			///@brief Returns an immutable range of all particles in this emitter
-			///@details This can be used directly with a range-based for loop
-			[[nodiscard]] inline auto Particles() const noexcept
+			///@brief Returns an immutable reference to the storage of all particles in this emitter
+			///@details The particles are stored as a structure of arrays
+			[[nodiscard]] inline auto& Particles() const noexcept
 			{
-				return adaptors::ranges::Iterable<const emitter::detail::container_type<Particle>&>{particles_};
+				return particles_;
 			}
 
 			///@}
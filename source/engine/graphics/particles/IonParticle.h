@@ -115,6 +115,12 @@ namespace ion::graphics::particles
 				lifetime_.Limit(lifetime);
 			}
 
+			///@brief Sets the elapsed lifetime of the particle to the given duration
+			inline void ElapsedLifetime(duration time) noexcept
+			{
+				lifetime_.Total(time);
+			}
+
 			///@}
 
 			/**
@@ -171,6 +177,19 @@ namespace ion::graphics::particles
 				return lifetime_.Limit();
 			}
 
+			///@brief Returns the elapsed lifetime of the particle
+			[[nodiscard]] inline auto ElapsedLifetime() const noexcept
+			{
+				return lifetime_.Total();
+			}
+
+			///@brief Returns the initial direction of the particle
+			///@details Rotation is the angle between the direction and the initial direction
+			[[nodiscard]] inline auto& InitialDirection() const noexcept
+			{
+				return initial_direction_;
+			}
+
 			///@brief Returns the lifetime percent of the particle in range [0.0, 1.0]
 			[[nodiscard]] inline auto LifetimePercent() const noexcept
 			{
@@ -0,0 +1,143 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/particles
+File:	IonParticleStorage.cpp
+-------------------------------------------
+*/
+
+#include "IonParticleStorage.h"
+
+namespace ion::graphics::particles
+{
+
+using namespace particle_storage;
+
+/*
+	Modifiers
+*/
+
+void ParticleStorage::Add(const Vector3 &position, const Vector2 &direction,
+	const Vector2 &size, real mass, const Color &color,
+	duration lifetime, const Vector2 &initial_direction)
+{
+	auto [x, y, z] = position.XYZ();
+	auto [r, g, b, a] = color.RGBA();
+
+	position_x_.push_back(x);
+	position_y_.push_back(y);
+	position_z_.push_back(z);
+	direction_x_.push_back(direction.X());
+	direction_y_.push_back(direction.Y());
+	size_x_.push_back(size.X());
+	size_y_.push_back(size.Y());
+	mass_.push_back(mass);
+	color_r_.push_back(r);
+	color_g_.push_back(g);
+	color_b_.push_back(b);
+	color_a_.push_back(a);
+	lifetime_total_.push_back(0.0_r);
+	lifetime_limit_.push_back(lifetime > duration::zero() ? lifetime.count() : 0.0_r);
+	initial_direction_x_.push_back(initial_direction.X());
+	initial_direction_y_.push_back(initial_direction.Y());
+}
+
+void ParticleStorage::Add(const Particle &particle)
+{
+	Add(particle.Position(), particle.Direction(), particle.Size(), particle.Mass(), particle.FillColor(),
+		particle.Lifetime(), particle.InitialDirection());
+	lifetime_total_.back() = particle.ElapsedLifetime().count();
+}
+
+void ParticleStorage::Set(int index, const Particle &particle) noexcept
+{
+	auto [x, y, z] = particle.Position().XYZ();
+	auto [r, g, b, a] = particle.FillColor().RGBA();
+
+	position_x_[index] = x;
+	position_y_[index] = y;
+	position_z_[index] = z;
+	direction_x_[index] = particle.Direction().X();
+	direction_y_[index] = particle.Direction().Y();
+	size_x_[index] = particle.Size().X();
+	size_y_[index] = particle.Size().Y();
+	mass_[index] = particle.Mass();
+	color_r_[index] = r;
+	color_g_[index] = g;
+	color_b_[index] = b;
+	color_a_[index] = a;
+	lifetime_total_[index] = particle.ElapsedLifetime().count();
+	lifetime_limit_[index] = particle.Lifetime().count();
+	initial_direction_x_[index] = particle.InitialDirection().X();
+	initial_direction_y_[index] = particle.InitialDirection().Y();
+}
+
+void ParticleStorage::Move(int from, int to) noexcept
+{
+	ForEachArray(
+		[&](auto &array) noexcept
+		{
+			array[to] = array[from];
+		});
+}
+
+void ParticleStorage::Truncate(int count) noexcept
+{
+	if (count >= 0 && count < Count())
+		ForEachArray(
+			[&](auto &array) noexcept
+			{
+				array.resize(count);
+			});
+}
+
+void ParticleStorage::Reserve(int count)
+{
+	ForEachArray(
+		[&](auto &array)
+		{
+			array.reserve(count);
+		});
+}
+
+void ParticleStorage::Clear() noexcept
+{
+	ForEachArray(
+		[](auto &array) noexcept
+		{
+			array.clear();
+		});
+}
+
+
+/*
+	Observers
+*/
+
+Particle ParticleStorage::At(int index) const noexcept
+{
+	Particle particle{
+		{position_x_[index], position_y_[index], position_z_[index]},
+		{direction_x_[index], direction_y_[index]},
+		{size_x_[index], size_y_[index]},
+		mass_[index],
+		{color_r_[index], color_g_[index], color_b_[index], color_a_[index]},
+		duration{lifetime_limit_[index]},
+		{initial_direction_x_[index], initial_direction_y_[index]}
+	};
+
+	particle.ElapsedLifetime(duration{lifetime_total_[index]});
+	return particle;
+}
+
+real ParticleStorage::Rotation(int index) const noexcept
+{
+	return Vector2{direction_x_[index], direction_y_[index]}.SignedAngleBetween(
+		{initial_direction_x_[index], initial_direction_y_[index]});
+}
+
+} //ion::graphics::particles
\ No newline at end of file
@@ -0,0 +1,263 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/particles
+File:	IonParticleStorage.h
+-------------------------------------------
+*/
+
+#ifndef ION_PARTICLE_STORAGE_H
+#define ION_PARTICLE_STORAGE_H
+
+#include <algorithm>
+#include <vector>
+
+#include "IonParticle.h"
+#include "graphics/utilities/IonColor.h"
+#include "graphics/utilities/IonVector2.h"
+#include "graphics/utilities/IonVector3.h"
+#include "types/IonTypes.h"
+
+namespace ion::graphics::particles
+{
+	using namespace types::type_literals;
+
+	namespace particle_storage::detail
+	{
+		template <typename T>
+		using container_type = std::vector<T>;
+
+		constexpr auto block_size = 256; //Max particles processed per block, when using temporary (stack) buffers
+	} //particle_storage::detail
+
+
+	///@brief A class representing a structure of arrays (SoA) storage of particles
+	///@details Each particle attribute is stored in its own contiguous array, making it possible to process many particles with SIMD instructions.
+	///Particles can still be added, retrieved and replaced one by one (as a Particle) through the storage.
+	///The rotation of each particle is not stored, but derived from its direction and initial direction when needed
+	class ParticleStorage final
+	{
+		private:
+
+			particle_storage::detail::container_type<real> position_x_;
+			particle_storage::detail::container_type<real> position_y_;
+			particle_storage::detail::container_type<real> position_z_;
+			particle_storage::detail::container_type<real> direction_x_;
+			particle_storage::detail::container_type<real> direction_y_;
+			particle_storage::detail::container_type<real> size_x_;
+			particle_storage::detail::container_type<real> size_y_;
+			particle_storage::detail::container_type<real> mass_;
+			particle_storage::detail::container_type<real> color_r_;
+			particle_storage::detail::container_type<real> color_g_;
+			particle_storage::detail::container_type<real> color_b_;
+			particle_storage::detail::container_type<real> color_a_;
+			particle_storage::detail::container_type<real> lifetime_total_;
+			particle_storage::detail::container_type<real> lifetime_limit_;
+			particle_storage::detail::container_type<real> initial_direction_x_;
+			particle_storage::detail::container_type<real> initial_direction_y_;
+
+
+			template <typename Function>
+			inline void ForEachArray(Function &&function)
+			{
+				for (auto array : {&position_x_, &position_y_, &position_z_,
+								   &direction_x_, &direction_y_, &size_x_, &size_y_, &mass_,
+								   &color_r_, &color_g_, &color_b_, &color_a_,
+								   &lifetime_total_, &lifetime_limit_,
+								   &initial_direction_x_, &initial_direction_y_})
+					function(*array);
+			}
+
+		public:
+
+			///@brief Default constructor
+			ParticleStorage() = default;
+
+
+			/**
+				@name Modifiers
+				@{
+			*/
+
+			///@brief Adds a new particle with the given initial values to the end of this storage
+			void Add(const Vector3 &position, const Vector2 &direction,
+					 const Vector2 &size, real mass, const Color &color,
+					 duration lifetime, const Vector2 &initial_direction);
+
+			///@brief Adds a copy of the given particle to the end of this storage
+			void Add(const Particle &particle);
+
+			///@brief Replaces the particle at the given index with the given particle
+			void Set(int index, const Particle &particle) noexcept;
+
+			///@brief Moves the particle at the given from index to the given to index
+			///@details The particle at the to index is overwritten
+			void Move(int from, int to) noexcept;
+
+			///@brief Removes all particles from the given count and out
+			void Truncate(int count) noexcept;
+
+			///@brief Reserves memory for the given number of particles
+			void Reserve(int count);
+
+			///@brief Removes all particles from this storage
+			void Clear() noexcept;
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the number of particles in this storage
+			[[nodiscard]] inline auto Count() const noexcept
+			{
+				return static_cast<int>(std::size(position_x_));
+			}
+
+			///@brief Returns true if this storage contains no particles
+			[[nodiscard]] inline auto Empty() const noexcept
+			{
+				return std::empty(position_x_);
+			}
+
+			///@brief Returns a copy of the particle at the given index
+			[[nodiscard]] Particle At(int index) const noexcept;
+
+			///@brief Returns the angle of rotation (in radians) of the particle at the given index
+			[[nodiscard]] real Rotation(int index) const noexcept;
+
+			///@brief Returns the lifetime percent of the particle at the given index in range [0.0, 1.0]
+			[[nodiscard]] inline auto LifetimePercent(int index) const noexcept
+			{
+				return lifetime_limit_[index] > 0.0_r ?
+					lifetime_total_[index] / lifetime_limit_[index] :
+					1.0_r;
+			}
+
+			///@}
+
+			/**
+				@name Arrays
+				Direct access to the underlying attribute arrays
+				@{
+			*/
+
+			[[nodiscard]] inline auto PositionX() noexcept { return std::data(position_x_); }
+			[[nodiscard]] inline auto PositionX() const noexcept { return std::data(position_x_); }
+			[[nodiscard]] inline auto PositionY() noexcept { return std::data(position_y_); }
+			[[nodiscard]] inline auto PositionY() const noexcept { return std::data(position_y_); }
+			[[nodiscard]] inline auto PositionZ() noexcept { return std::data(position_z_); }
+			[[nodiscard]] inline auto PositionZ() const noexcept { return std::data(position_z_); }
+
+			[[nodiscard]] inline auto DirectionX() noexcept { return std::data(direction_x_); }
+			[[nodiscard]] inline auto DirectionX() const noexcept { return std::data(direction_x_); }
+			[[nodiscard]] inline auto DirectionY() noexcept { return std::data(direction_y_); }
+			[[nodiscard]] inline auto DirectionY() const noexcept { return std::data(direction_y_); }
+
+			[[nodiscard]] inline auto SizeX() noexcept { return std::data(size_x_); }
+			[[nodiscard]] inline auto SizeX() const noexcept { return std::data(size_x_); }
+			[[nodiscard]] inline auto SizeY() noexcept { return std::data(size_y_); }
+			[[nodiscard]] inline auto SizeY() const noexcept { return std::data(size_y_); }
+
+			[[nodiscard]] inline auto Mass() noexcept { return std::data(mass_); }
+			[[nodiscard]] inline auto Mass() const noexcept { return std::data(mass_); }
+
+			[[nodiscard]] inline auto ColorR() noexcept { return std::data(color_r_); }
+			[[nodiscard]] inline auto ColorR() const noexcept { return std::data(color_r_); }
+			[[nodiscard]] inline auto ColorG() noexcept { return std::data(color_g_); }
+			[[nodiscard]] inline auto ColorG() const noexcept { return std::data(color_g_); }
+			[[nodiscard]] inline auto ColorB() noexcept { return std::data(color_b_); }
+			[[nodiscard]] inline auto ColorB() const noexcept { return std::data(color_b_); }
+			[[nodiscard]] inline auto ColorA() noexcept { return std::data(color_a_); }
+			[[nodiscard]] inline auto ColorA() const noexcept { return std::data(color_a_); }
+
+			[[nodiscard]] inline auto LifetimeTotal() noexcept { return std::data(lifetime_total_); }
+			[[nodiscard]] inline auto LifetimeTotal() const noexcept { return std::data(lifetime_total_); }
+			[[nodiscard]] inline auto LifetimeLimit() noexcept { return std::data(lifetime_limit_); }
+			[[nodiscard]] inline auto LifetimeLimit() const noexcept { return std::data(lifetime_limit_); }
+
+			[[nodiscard]] inline auto InitialDirectionX() noexcept { return std::data(initial_direction_x_); }
+			[[nodiscard]] inline auto InitialDirectionX() const noexcept { return std::data(initial_direction_x_); }
+			[[nodiscard]] inline auto InitialDirectionY() noexcept { return std::data(initial_direction_y_); }
+			[[nodiscard]] inline auto InitialDirectionY() const noexcept { return std::data(initial_direction_y_); }
+
+			///@}
+	};
+
+
+	///@brief A class representing a range [first, last) of particles in a particle storage
+	///@details Affectors are given a particle range, so that a storage can be affected in chunks
+	class ParticleRange final
+	{
+		private:
+
+			ParticleStorage *storage_ = nullptr;
+			int first_ = 0;
+			int last_ = 0;
+
+		public:
+
+			///@brief Constructs a new particle range containing all particles in the given storage
+			ParticleRange(ParticleStorage &storage) noexcept :
+				storage_{&storage},
+				last_{storage.Count()}
+			{
+				//Empty
+			}
+
+			///@brief Constructs a new particle range containing the particles [first, last) in the given storage
+			ParticleRange(ParticleStorage &storage, int first, int last) noexcept :
+				storage_{&storage},
+				first_{std::clamp(first, 0, storage.Count())},
+				last_{std::clamp(last, first_, storage.Count())}
+			{
+				//Empty
+			}
+
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the particle storage of this range
+			[[nodiscard]] inline auto& Storage() const noexcept
+			{
+				return *storage_;
+			}
+
+			///@brief Returns the index of the first particle in this range
+			[[nodiscard]] inline auto First() const noexcept
+			{
+				return first_;
+			}
+
+			///@brief Returns the index one past the last particle in this range
+			[[nodiscard]] inline auto Last() const noexcept
+			{
+				return last_;
+			}
+
+			///@brief Returns the number of particles in this range
+			[[nodiscard]] inline auto Count() const noexcept
+			{
+				return last_ - first_;
+			}
+
+			///@brief Returns true if this range contains no particles
+			[[nodiscard]] inline auto Empty() const noexcept
+			{
+				return first_ == last_;
+			}
+
+			///@}
+	};
+} //ion::graphics::particles
+
+#endif
\ No newline at end of file
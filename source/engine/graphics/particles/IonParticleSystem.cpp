@@ -12,10 +12,16 @@ File:	IonParticleSystem.cpp
 
 #include "IonParticleSystem.h"
 
+#include <limits>
+#include <vector>
+
+#include "parallel/IonTaskScheduler.h"
+
 namespace ion::graphics::particles
 {
 
 using namespace particle_system;
+using namespace ion::utilities;
 
 namespace particle_system::detail
 {
@@ -55,10 +61,28 @@ ParticleSystem ParticleSystem::Clone() const
 	for (auto &affector : Affectors())
 		particle_system.AffectorManager::Adopt(affector.Clone());
 
+	if (random_seed_)
+		particle_system.RandomSeed(*random_seed_);
+
 	return particle_system;
 }
 
 
+/*
+	Modifiers
+*/
+
+void ParticleSystem::RandomSeed(uint64 seed) noexcept
+{
+	random_seed_ = seed;
+	random_stream_.Seed(seed);
+
+	//Reseed all emitters, with seeds drawn from this stream
+	for (auto &emitter : Emitters())
+		emitter.RandomSeed(random_stream_.Number(uint64{0}, std::numeric_limits<uint64>::max()));
+}
+
+
 /*
 	Common functions for controlling the particle system
 */
@@ -94,14 +118,36 @@ void ParticleSystem::RestartAll() noexcept
 
 void ParticleSystem::Elapse(duration time) noexcept
 {
-	//Elapse emitters
+	//Draw all random numbers from this particle system's stream
+	random::StreamScope stream_scope{random_stream_};
+
+	//Elapse global affectors (once per frame)
+	for (auto &affector : Affectors())
+		affector.Elapse(time);
+
+	std::vector<Emitter*> emitters;
+	auto particle_count = 0;
+
 	for (auto &emitter : Emitters())
 	{
-		emitter.Elapse(time);
+		emitters.push_back(&emitter);
+		particle_count += emitter.Particles().Count();
+	}
 
-		//Affect particles (in emitter)
-		for (auto &affector : Affectors())
-			affector.Affect(emitter.Particles(), time);
+	//Elapse emitters and affect particles (in emitter)
+	auto elapse_emitter =
+		[&](int index) noexcept
+		{
+			emitters[index]->Elapse(time, *this);
+		};
+
+	if (auto emitter_count = std::ssize(emitters); emitter_count > 1 &&
+		particle_count >= detail::parallel_particle_threshold)
+		parallel::TaskScheduler::Instance().ParallelFor(0, static_cast<int>(emitter_count), elapse_emitter);
+	else
+	{
+		for (auto i = 0; i < emitter_count; ++i)
+			elapse_emitter(i);
 	}
 }
 
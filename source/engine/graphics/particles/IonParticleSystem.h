@@ -13,9 +13,13 @@ File:	IonParticleSystem.h
 #ifndef ION_PARTICLE_SYSTEM_H
 #define ION_PARTICLE_SYSTEM_H
 
+#include <optional>
+
 #include "IonEmitterManager.h"
 #include "affectors/IonAffectorManager.h"
 #include "managed/IonManagedObject.h"
+#include "types/IonTypes.h"
+#include "utilities/IonRandom.h"
 
 namespace ion::graphics::particles
 {
@@ -31,6 +35,7 @@ namespace ion::graphics::particles
 
 		namespace detail
 		{
+			constexpr auto parallel_particle_threshold = 1024; //Emitters are elapsed in parallel above this number of particles
 		} //detail
 	} //particle_system
 
@@ -44,6 +49,8 @@ namespace ion::graphics::particles
 		private:
 
 			particle_system::ParticlePrimitive particle_primitive_ = particle_system::ParticlePrimitive::Point;
+			ion::utilities::random::Stream random_stream_;
+			std::optional<uint64> random_seed_;
 
 		public:
 
@@ -75,6 +82,10 @@ namespace ion::graphics::particles
 				particle_primitive_ = particle_primitive;
 			}
 
+			///@brief Sets the random seed of this particle system to the given value
+			///@details All emitters (and global affectors) are reseeded from the given seed, making the particle system reproducible
+			void RandomSeed(uint64 seed) noexcept;
+
 			///@}
 
 			/**
@@ -88,6 +99,13 @@ namespace ion::graphics::particles
 				return particle_primitive_;
 			}
 
+			///@brief Returns the random seed of this particle system
+			///@details Returns nullopt if no random seed has been set (seeded from the global random engine)
+			[[nodiscard]] inline auto RandomSeed() const noexcept
+			{
+				return random_seed_;
+			}
+
 			///@}
 
 			/**
@@ -115,7 +133,8 @@ namespace ion::graphics::particles
 			*/
 
 			///@brief Elapses particle system by the given time in seconds
-			///@details This function is typically called each frame, with the time in seconds since last frame
+			///@details This function is typically called each frame, with the time in seconds since last frame.
+			///Emitters are elapsed in parallel, each drawing random numbers from its own stream
 			void Elapse(duration time) noexcept;
 
 			///@}
@@ -26,6 +26,12 @@ Affector::Affector(std::string name) noexcept :
 	Affect particles
 */
 
+void Affector::Elapse(duration time) noexcept
+{
+	if (enabled_)
+		DoElapse(time);
+}
+
 void Affector::Affect(affector::detail::particle_range particles, duration time) noexcept
 {
 	if (enabled_)
@@ -13,16 +13,11 @@ File:	IonAffector.h
 #ifndef ION_AFFECTOR_H
 #define ION_AFFECTOR_H
 
-#include "adaptors/ranges/IonIterable.h"
+#include "graphics/particles/IonParticleStorage.h"
 #include "managed/IonManagedObject.h"
 #include "memory/IonOwningPtr.h"
 #include "types/IonTypes.h"
 
-namespace ion::graphics::particles
-{
-	class Particle;
-}
-
 namespace ion::graphics::particles::affectors
 {
 	class AffectorManager; //Forward declaration
@@ -32,7 +27,7 @@ namespace ion::graphics::particles::affectors
 		template <typename T>
 		using container_type = std::vector<T>;
 
-		using particle_range = adaptors::ranges::Iterable<container_type<Particle>&>;
+		using particle_range = ParticleRange;
 	} //affector::detail
 
 
@@ -57,7 +52,16 @@ namespace ion::graphics::particles::affectors
 			*/
 
 			///@brief Elapses affector by the given time in seconds
-			///@details This function is typically called each frame, with the time in seconds since last frame
+			///@details This function is called once each frame, before any particles are affected.
+			///Override this function to update any state that should change once per frame
+			virtual void DoElapse([[maybe_unused]] duration time) noexcept
+			{
+				//Optional to override
+			}
+
+			///@brief Affects the given range of particles by the given time in seconds
+			///@details This function is typically called each frame, with the time in seconds since last frame.
+			///It can be called concurrently for disjoint ranges, and should therefore not change the state of the affector
 			virtual void DoAffect(affector::detail::particle_range particles, duration time) noexcept = 0;
 
 			///@}
@@ -143,8 +147,13 @@ namespace ion::graphics::particles::affectors
 				@{
 			*/
 
+			///@brief Calls virtual function DoElapse if this affector is enabled
+			///@details This function is typically called once each frame, with the time in seconds since last frame
+			void Elapse(duration time) noexcept;
+
 			///@brief Calls virtual function DoAffect if this affector is enabled
-			///@details This function is typically called each frame, with the time in seconds since last frame
+			///@details This function is typically called each frame, with the time in seconds since last frame.
+			///Can be called concurrently for disjoint ranges of particles
 			void Affect(affector::detail::particle_range particles, duration time) noexcept;
 
 			///@}
@@ -16,15 +16,19 @@ File:	IonColorFader.cpp
 #include <utility>
 
 #include "graphics/particles/IonParticle.h"
+#include "utilities/IonSimd.h"
 
 namespace ion::graphics::particles::affectors
 {
 
 using namespace color_fader;
+using namespace ion::utilities;
 
 namespace color_fader::detail
 {
 
+using particle_storage::detail::block_size;
+
 std::vector<Step> normalize_steps(std::vector<Step> steps) noexcept
 {
 	if (!std::empty(steps))
@@ -97,29 +101,72 @@ void affect_particles(affector::detail::particle_range particles, const color_st
 	static const Step first{0.0_r, {}};
 	static const Step last{1.0_r, {}};
 
-	for (auto &particle : particles)
+	auto &storage = particles.Storage();
+	auto lifetime = storage.LifetimeTotal();
+	auto lifetime_limit = storage.LifetimeLimit();
+	real *channels[] = {storage.ColorR(), storage.ColorG(), storage.ColorB(), storage.ColorA()};
+
+	real percents[block_size];
+	real faded[block_size]; //1.0 if faded, else 0.0
+	real from_channels[4][block_size];
+	real to_channels[4][block_size];
+
+	for (auto block_first = particles.First(); block_first < particles.Last(); block_first += block_size)
 	{
-		auto percent = particle.LifetimePercent();
-		auto [from, to] =
-			[&]() noexcept
+		auto count = std::min(block_size, particles.Last() - block_first);
+
+		//Lifetime percents
+		simd::ForEach(0, count,
+			[&]<typename Pack>(int i) noexcept
 			{
-				if (auto iter = steps.lower_bound(percent); iter != std::end(steps))
-					return std::pair{iter != std::begin(steps) ? &*(iter - 1) : &first, &*iter};
-				else
-					return std::pair{&*(iter - 1), &last};
-			}();
+				auto total = Pack::Load(lifetime + block_first + i);
+				auto limit = Pack::Load(lifetime_limit + block_first + i);
+				Pack::Select(limit > Pack::Broadcast(0.0_r), total / limit, Pack::Broadcast(1.0_r)).Store(percents + i);
+			});
+
+		//Find steps
+		for (auto i = 0; i < count; ++i)
+		{
+			auto percent = percents[i];
+			auto [from, to] =
+				[&]() noexcept
+				{
+					if (auto iter = steps.lower_bound(percent); iter != std::end(steps))
+						return std::pair{iter != std::begin(steps) ? &*(iter - 1) : &first, &*iter};
+					else
+						return std::pair{&*(iter - 1), &last};
+				}();
+
+			auto index = block_first + i;
+			faded[i] = to->ToColor ? 1.0_r : 0.0_r;
+			percents[i] = to->ToColor ? (1.0_r - percent) / (to->Percent - from->Percent) : 0.0_r;
+
+			for (auto j = 0; j < 4; ++j)
+			{
+				//from -> to
+				from_channels[j][i] = from->ToColor && to->ToColor ?
+					from->ToColor->Channels()[j] :
+					channels[j][index]; //current -> to
+				to_channels[j][i] = to->ToColor ?
+					to->ToColor->Channels()[j] :
+					channels[j][index];
+			}
+		}
 
 		//Fade
-		if (to->ToColor)
+		for (auto j = 0; j < 4; ++j)
 		{
-			percent = (1.0_r - percent) / (to->Percent - from->Percent);
-
-			//from -> to
-			if (from->ToColor)
-				particle.FillColor(from->ToColor->MixCopy(*(to->ToColor), percent));
-			//current -> to
-			else
-				particle.FillColor(particle.FillColor().MixCopy(*(to->ToColor), percent));
+			simd::ForEach(0, count,
+				[&]<typename Pack>(int i) noexcept
+				{
+					auto amount = simd::Saturate(Pack::Load(percents + i));
+					auto x = Pack::Load(from_channels[j] + i);
+					auto y = Pack::Load(to_channels[j] + i);
+					auto current = Pack::Load(channels[j] + block_first + i);
+
+					Pack::Select(Pack::Load(faded + i) > Pack::Broadcast(0.0_r),
+						simd::Saturate(x + (y - x) * amount), current).Store(channels[j] + block_first + i);
+				});
 		}
 	}
 }
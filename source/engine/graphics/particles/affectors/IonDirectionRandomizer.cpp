@@ -29,17 +29,25 @@ namespace direction_randomizer::detail
 void affect_particles(affector::detail::particle_range particles, duration time,
 					  real angle, real scope) noexcept
 {
-	for (auto &particle : particles)
+	auto &storage = particles.Storage();
+	auto direction_x = storage.DirectionX();
+	auto direction_y = storage.DirectionY();
+
+	for (auto i = particles.First(); i < particles.Last(); ++i)
 	{
 		if (scope > random::Number())
 		{
-			auto velocity = particle.Velocity();
-			particle.Direction(particle.Direction() + particle.Direction().RandomDeviant(angle) * time.count());
-			auto new_velocity = particle.Velocity();
+			Vector2 direction{direction_x[i], direction_y[i]};
+			auto velocity = direction.Length();
+			direction += direction.RandomDeviant(angle) * time.count();
+			auto new_velocity = direction.Length();
 
 			//Keep velocity
 			if (new_velocity != 0.0_r)
-				particle.Direction(particle.Direction() * (velocity / new_velocity));
+				direction = direction * (velocity / new_velocity);
+
+			direction_x[i] = direction.X();
+			direction_y[i] = direction.Y();
 		}
 	}
 }
@@ -13,6 +13,7 @@ File:	IonGravitation.cpp
 #include "IonGravitation.h"
 
 #include "graphics/particles/IonParticle.h"
+#include "utilities/IonSimd.h"
 
 namespace ion::graphics::particles::affectors
 {
@@ -26,18 +27,32 @@ namespace gravitation::detail
 void affect_particles(affector::detail::particle_range particles, duration time,
 					  const Vector2 &position, real gravity, real mass) noexcept
 {
-	for (auto &particle : particles)
-	{
-		//Newton's law of universal gravitation
-		auto distance = position - particle.Position();
-		auto length = distance.SquaredLength();
-
-		if (length > 0.0_r)
+	auto &storage = particles.Storage();
+	auto position_x = storage.PositionX();
+	auto position_y = storage.PositionY();
+	auto direction_x = storage.DirectionX();
+	auto direction_y = storage.DirectionY();
+	auto particle_mass = storage.Mass();
+	auto gravity_mass = gravity * mass;
+
+	simd::ForEach(particles.First(), particles.Last(),
+		[&, seconds = time.count()]<typename Pack>(int i) noexcept
 		{
-			auto force = gravity * mass * particle.Mass() / length;
-			particle.Direction(particle.Direction() + distance * force * time.count());
-		}
-	}
+			//Newton's law of universal gravitation
+			auto distance_x = Pack::Broadcast(position.X()) - Pack::Load(position_x + i);
+			auto distance_y = Pack::Broadcast(position.Y()) - Pack::Load(position_y + i);
+			auto length = distance_x * distance_x + distance_y * distance_y;
+
+			auto force = Pack::Broadcast(gravity_mass) * Pack::Load(particle_mass + i) / length;
+			auto t = Pack::Broadcast(seconds);
+			auto x = Pack::Load(direction_x + i);
+			auto y = Pack::Load(direction_y + i);
+
+			//Only affect particles with a distance
+			auto affected = length > Pack::Broadcast(0.0_r);
+			Pack::Select(affected, x + distance_x * force * t, x).Store(direction_x + i);
+			Pack::Select(affected, y + distance_y * force * t, y).Store(direction_y + i);
+		});
 }
 
 } //gravitation::detail
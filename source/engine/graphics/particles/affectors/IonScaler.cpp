@@ -16,15 +16,19 @@ File:	IonScaler.cpp
 #include <utility>
 
 #include "graphics/particles/IonParticle.h"
+#include "utilities/IonSimd.h"
 
 namespace ion::graphics::particles::affectors
 {
 
 using namespace scaler;
+using namespace ion::utilities;
 
 namespace scaler::detail
 {
 
+using particle_storage::detail::block_size;
+
 std::vector<Step> normalize_steps(std::vector<Step> steps) noexcept
 {
 	if (!std::empty(steps))
@@ -97,29 +101,75 @@ void affect_particles(affector::detail::particle_range particles, const size_ste
 	static const Step first{0.0_r, {}};
 	static const Step last{1.0_r, {}};
 
-	for (auto &particle : particles)
+	auto &storage = particles.Storage();
+	auto lifetime = storage.LifetimeTotal();
+	auto lifetime_limit = storage.LifetimeLimit();
+	real *components[] = {storage.SizeX(), storage.SizeY()};
+
+	real percents[block_size];
+	real scaled[block_size]; //1.0 if scaled, else 0.0
+	real from_components[2][block_size];
+	real to_components[2][block_size];
+
+	for (auto block_first = particles.First(); block_first < particles.Last(); block_first += block_size)
 	{
-		auto percent = particle.LifetimePercent();
-		auto [from, to] =
-			[&]() noexcept
+		auto count = std::min(block_size, particles.Last() - block_first);
+
+		//Lifetime percents
+		simd::ForEach(0, count,
+			[&]<typename Pack>(int i) noexcept
 			{
-				if (auto iter = steps.lower_bound(percent); iter != std::end(steps))
-					return std::pair{iter != std::begin(steps) ? &*(iter - 1) : &first, &*iter};
-				else
-					return std::pair{&*(iter - 1), &last};
-			}();
+				auto total = Pack::Load(lifetime + block_first + i);
+				auto limit = Pack::Load(lifetime_limit + block_first + i);
+				Pack::Select(limit > Pack::Broadcast(0.0_r), total / limit, Pack::Broadcast(1.0_r)).Store(percents + i);
+			});
+
+		//Find steps
+		for (auto i = 0; i < count; ++i)
+		{
+			auto percent = percents[i];
+			auto [from, to] =
+				[&]() noexcept
+				{
+					if (auto iter = steps.lower_bound(percent); iter != std::end(steps))
+						return std::pair{iter != std::begin(steps) ? &*(iter - 1) : &first, &*iter};
+					else
+						return std::pair{&*(iter - 1), &last};
+				}();
+
+			auto index = block_first + i;
+			scaled[i] = to->Size ? 1.0_r : 0.0_r;
+			percents[i] = to->Size ? (1.0_r - percent) / (to->Percent - from->Percent) : 0.0_r;
+
+			for (auto j = 0; j < 2; ++j)
+			{
+				//from -> to
+				from_components[j][i] = from->Size && to->Size ?
+					from->Size->Components()[j] :
+					components[j][index]; //current -> to
+				to_components[j][i] = to->Size ?
+					to->Size->Components()[j] :
+					components[j][index];
+			}
+		}
 
 		//Scale
-		if (to->Size)
+		for (auto j = 0; j < 2; ++j)
 		{
-			percent = (1.0_r - percent) / (to->Percent - from->Percent);
-
-			//from -> to
-			if (from->Size)
-				particle.Size(from->Size->Lerp(*(to->Size), percent));
-			//current -> to
-			else
-				particle.Size(particle.Size().Lerp(*(to->Size), percent));
+			simd::ForEach(0, count,
+				[&]<typename Pack>(int i) noexcept
+				{
+					auto amount = Pack::Load(percents + i);
+					auto x = Pack::Load(from_components[j] + i);
+					auto y = Pack::Load(to_components[j] + i);
+					auto current = Pack::Load(components[j] + block_first + i);
+
+					//Same as Vector2::Lerp
+					auto size = Pack::Select(amount <= Pack::Broadcast(0.0_r), x,
+						Pack::Select(amount >= Pack::Broadcast(1.0_r), y, x + (y - x) * amount));
+
+					Pack::Select(Pack::Load(scaled + i) > Pack::Broadcast(0.0_r), size, current).Store(components[j] + block_first + i);
+				});
 		}
 	}
 }
@@ -13,6 +13,7 @@ File:	IonSineForce.cpp
 #include "IonSineForce.h"
 
 #include "graphics/particles/IonParticle.h"
+#include "utilities/IonSimd.h"
 
 namespace ion::graphics::particles::affectors
 {
@@ -27,19 +28,27 @@ void affect_particles(affector::detail::particle_range particles, duration time,
 					  ForceType type, const Vector2 &force, real angle) noexcept
 {
 	auto scaled_force = force * (math::Sin(angle) * time.count());
-
-	//Add
-	if (type == ForceType::Add)
-	{
-		for (auto &particle : particles)
-			particle.Direction(particle.Direction() + scaled_force);
-	}
-	//Average
-	else
-	{
-		for (auto &particle : particles)
-			particle.Direction((particle.Direction() + scaled_force) * 0.5_r);
-	}
+	auto &storage = particles.Storage();
+	auto direction_x = storage.DirectionX();
+	auto direction_y = storage.DirectionY();
+
+	simd::ForEach(particles.First(), particles.Last(),
+		[&, average = type == ForceType::Average]<typename Pack>(int i) noexcept
+		{
+			//Add
+			auto x = Pack::Load(direction_x + i) + Pack::Broadcast(scaled_force.X());
+			auto y = Pack::Load(direction_y + i) + Pack::Broadcast(scaled_force.Y());
+
+			//Average
+			if (average)
+			{
+				x = x * Pack::Broadcast(0.5_r);
+				y = y * Pack::Broadcast(0.5_r);
+			}
+
+			x.Store(direction_x + i);
+			y.Store(direction_y + i);
+		});
 }
 
 } //sine_force::detail
@@ -51,15 +60,18 @@ void affect_particles(affector::detail::particle_range particles, duration time,
 	Affect particles
 */
 
-void SineForce::DoAffect(affector::detail::particle_range particles, duration time) noexcept
+void SineForce::DoElapse(duration time) noexcept
 {
 	if (current_angle_ += current_frequency_ * time.count())
 	{
 		current_frequency_ = random::Number(frequency_.first, frequency_.second); //Change frequency
 		current_angle_.ResetWithCarry();
 	}
+}
 
-	detail::affect_particles(particles, time, type_, force_, current_angle_);
+void SineForce::DoAffect(affector::detail::particle_range particles, duration time) noexcept
+{
+	detail::affect_particles(particles, time, type_, force_, current_angle_.Total());
 }
 
 
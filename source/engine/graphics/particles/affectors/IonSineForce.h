@@ -67,6 +67,10 @@ namespace ion::graphics::particles::affectors
 			*/
 
 			///@brief Elapses sine force by the given time in seconds
+			///@details This function is typically called once each frame, with the time in seconds since last frame
+			void DoElapse(duration time) noexcept override;
+
+			///@brief Affects the given range of particles by the given time in seconds
 			///@details This function is typically called each frame, with the time in seconds since last frame
 			void DoAffect(affector::detail::particle_range particles, duration time) noexcept override;
 
@@ -29,10 +29,22 @@ namespace velocity_randomizer::detail
 void affect_particles(affector::detail::particle_range particles, duration time,
 					  const std::pair<real, real> &velocity, real scope) noexcept
 {
-	for (auto &particle : particles)
+	auto &storage = particles.Storage();
+	auto direction_x = storage.DirectionX();
+	auto direction_y = storage.DirectionY();
+
+	for (auto i = particles.First(); i < particles.Last(); ++i)
 	{
 		if (scope > random::Number())
-			particle.Velocity(particle.Velocity() * random::Number(velocity.first, velocity.second) * time.count());
+		{
+			Vector2 direction{direction_x[i], direction_y[i]};
+			auto new_velocity = direction.Length() * random::Number(velocity.first, velocity.second) * time.count();
+			direction.Normalize();
+			direction *= new_velocity;
+
+			direction_x[i] = direction.X();
+			direction_y[i] = direction.Y();
+		}
 	}
 }
 
@@ -12,13 +12,15 @@ File:	IonRenderPrimitive.cpp
 
 #include "IonRenderPrimitive.h"
 
+#include <algorithm>
 #include <cstring>
 #include <utility>
 
 #include "IonRenderer.h"
+#include "graphics/materials/IonMaterial.h"
 #include "graphics/shaders/IonShaderLayout.h"
-#include "graphics/utilities/IonMatrix3.h"
 #include "graphics/utilities/IonVector2.h"
+#include "utilities/IonSimd.h"
 
 namespace ion::graphics::render
 {
@@ -58,40 +60,158 @@ vertex_metrics get_vertex_metrics(const vertex::VertexDeclaration &vertex_declar
 }
 
 
+affine_transform get_affine_transform(const Matrix4 &model_matrix) noexcept
+{
+	auto m = model_matrix.M();
+	auto transform = affine_transform{};
+
+	for (auto i = 0; i < 3; ++i)
+	{
+		for (auto j = 0; j < 4; ++j)
+		{
+			#ifdef ION_ROW_MAJOR
+			//Row-major layout (Direct3D)
+			transform.m[i][j] = m[j][i];
+			#else
+			//Column-major layout (OpenGL)
+			transform.m[i][j] = m[i][j];
+			#endif
+		}
+	}
+
+	transform.inv_w = 1.0_r / m[3][3]; //Same as Matrix4 * Vector3
+	return transform;
+}
+
+
+void transform_positions2(const affine_transform &transform, real *data, int count, int stride) noexcept
+{
+	auto &m = transform.m;
+	real x[block_size];
+	real y[block_size];
+
+	for (auto first = 0; first < count; first += block_size, data += block_size * stride)
+	{
+		auto size = std::min(block_size, count - first);
+
+		//Gather
+		for (auto i = 0, off = 0; i < size; ++i, off += stride)
+		{
+			x[i] = data[off];
+			y[i] = data[off + 1];
+		}
+
+		ion::utilities::simd::ForEach(0, size,
+			[&]<typename Pack>(int i) noexcept
+			{
+				auto px = Pack::Load(x + i);
+				auto py = Pack::Load(y + i);
+
+				(Pack::Broadcast(m[0][0]) * px + Pack::Broadcast(m[0][1]) * py + Pack::Broadcast(m[0][3])).Store(x + i);
+				(Pack::Broadcast(m[1][0]) * px + Pack::Broadcast(m[1][1]) * py + Pack::Broadcast(m[1][3])).Store(y + i);
+			});
+
+		//Scatter
+		for (auto i = 0, off = 0; i < size; ++i, off += stride)
+		{
+			data[off] = x[i];
+			data[off + 1] = y[i];
+		}
+	}
+}
+
+void transform_positions3(const affine_transform &transform, real *data, int count, int stride) noexcept
+{
+	auto &m = transform.m;
+	real x[block_size];
+	real y[block_size];
+	real z[block_size];
+
+	for (auto first = 0; first < count; first += block_size, data += block_size * stride)
+	{
+		auto size = std::min(block_size, count - first);
+
+		//Gather
+		for (auto i = 0, off = 0; i < size; ++i, off += stride)
+		{
+			x[i] = data[off];
+			y[i] = data[off + 1];
+			z[i] = data[off + 2];
+		}
+
+		ion::utilities::simd::ForEach(0, size,
+			[&]<typename Pack>(int i) noexcept
+			{
+				auto px = Pack::Load(x + i);
+				auto py = Pack::Load(y + i);
+				auto pz = Pack::Load(z + i);
+				auto inv_w = Pack::Broadcast(transform.inv_w);
+
+				((Pack::Broadcast(m[0][0]) * px + Pack::Broadcast(m[0][1]) * py + Pack::Broadcast(m[0][2]) * pz + Pack::Broadcast(m[0][3])) * inv_w).Store(x + i);
+				((Pack::Broadcast(m[1][0]) * px + Pack::Broadcast(m[1][1]) * py + Pack::Broadcast(m[1][2]) * pz + Pack::Broadcast(m[1][3])) * inv_w).Store(y + i);
+				((Pack::Broadcast(m[2][0]) * px + Pack::Broadcast(m[2][1]) * py + Pack::Broadcast(m[2][2]) * pz + Pack::Broadcast(m[2][3])) * inv_w).Store(z + i);
+			});
+
+		//Scatter
+		for (auto i = 0, off = 0; i < size; ++i, off += stride)
+		{
+			data[off] = x[i];
+			data[off + 1] = y[i];
+			data[off + 2] = z[i];
+		}
+	}
+}
+
+void multiply_components(real factor, const real *source, real *data, int count, int stride) noexcept
+{
+	real values[block_size];
+
+	for (auto first = 0; first < count; first += block_size, source += block_size * stride, data += block_size * stride)
+	{
+		auto size = std::min(block_size, count - first);
+
+		//Gather
+		for (auto i = 0, off = 0; i < size; ++i, off += stride)
+			values[i] = source[off];
+
+		ion::utilities::simd::ForEach(0, size,
+			[&]<typename Pack>(int i) noexcept
+			{
+				(Pack::Load(values + i) * Pack::Broadcast(factor)).Store(values + i);
+			});
+
+		//Scatter
+		for (auto i = 0, off = 0; i < size; ++i, off += stride)
+			data[off] = values[i];
+	}
+}
+
+
 void transform_positions(const vertex_metrics &metrics, const Matrix4 &model_matrix, VertexContainer &data) noexcept
 {
-	auto size = std::ssize(data);
+	auto size = static_cast<int>(std::ssize(data));
 	auto stride = std::max(metrics.position_components, metrics.position_stride);
 
+	//Number of whole positions with the given components
+	auto count =
+		[&](int components) noexcept
+		{
+			auto last = size - components - metrics.position_offset;
+			return last >= 0 && stride > 0 ? last / stride + 1 : 0;
+		};
+
 	switch (metrics.position_components)
 	{
 		//Two-components (x, y)
 		case 2:
-		{
-			for (auto off = metrics.position_offset; off + 1 < size; off += stride)
-			{
-				auto [x, y] = (Matrix3::Transformation(model_matrix) * Vector2{data[off + 0], data[off + 1]}).XY();
-				data[off + 0] = x;
-				data[off + 1] = y;
-			}
-
-			break;
-		}
+		transform_positions2(get_affine_transform(model_matrix), std::data(data) + metrics.position_offset, count(2), stride);
+		break;
 
 		//Three-components (x, y, z)
 		case 3:
 		case 4: //w is left as is
-		{
-			for (auto off = metrics.position_offset; off + 2 < size; off += stride)
-			{
-				auto [x, y, z] = (model_matrix * Vector3{data[off + 0], data[off + 1], data[off + 2]}).XYZ();
-				data[off + 0] = x;
-				data[off + 1] = y;
-				data[off + 2] = z;
-			}
-
-			break;
-		}
+		transform_positions3(get_affine_transform(model_matrix), std::data(data) + metrics.position_offset, count(3), stride);
+		break;
 	}
 }
 
@@ -99,6 +219,7 @@ void apply_color(const vertex_metrics &metrics, const Color &color, VertexContai
 {
 	auto size = std::ssize(data);
 	auto stride = std::max(metrics.color_components, metrics.color_stride);
+	auto [r, g, b, a] = color.RGBA();
 
 	switch (metrics.color_components)
 	{
@@ -107,7 +228,6 @@ void apply_color(const vertex_metrics &metrics, const Color &color, VertexContai
 		{
 			for (auto off = metrics.color_offset; off + 2 < size; off += stride)
 			{
-				auto [r, g, b] = color.RGB();
 				data[off + 0] = r;
 				data[off + 1] = g;
 				data[off + 2] = b;
@@ -121,7 +241,6 @@ void apply_color(const vertex_metrics &metrics, const Color &color, VertexContai
 		{
 			for (auto off = metrics.color_offset; off + 3 < size; off += stride)
 			{
-				auto [r, g, b, a] = color.RGBA();
 				data[off + 0] = r;
 				data[off + 1] = g;
 				data[off + 2] = b;
@@ -153,7 +272,7 @@ void apply_opacity(const vertex_metrics &metrics, real opacity, VertexContainer
 
 void apply_opacity(const vertex_metrics &metrics, real opacity, const VertexContainer &source_data, VertexContainer &data) noexcept
 {
-	auto size = std::ssize(data);
+	auto size = static_cast<int>(std::min(std::ssize(source_data), std::ssize(data)));
 	auto stride = std::max(metrics.color_components, metrics.color_stride);
 
 	switch (metrics.color_components)
@@ -161,9 +280,12 @@ void apply_opacity(const vertex_metrics &metrics, real opacity, const VertexCont
 		//Four-channels (r, g, b, a)
 		case 4: //Need alpha channel
 		{
-			for (auto off = metrics.color_offset; off + 3 < size; off += stride)
-				data[off + 3] = source_data[off + 3] * opacity;
+			auto last = size - 4 - metrics.color_offset;
+			auto count = last >= 0 && stride > 0 ? last / stride + 1 : 0;
 
+			multiply_components(opacity,
+				std::data(source_data) + metrics.color_offset + 3,
+				std::data(data) + metrics.color_offset + 3, count, stride);
 			break;
 		}
 	}
@@ -301,6 +423,20 @@ bool all_passes_equal(const render_pass::Passes &passes, const render_pass::Pass
 
 void RenderPrimitive::UpdateWorldVertexData()
 {
+	//Streamed, world vertex data is written directly into the parent renderer
+	if (streamed_)
+	{
+		if (data_changed_ || model_matrix_changed_ || opacity_changed_)
+		{
+			data_changed_ = false;
+			world_data_changed_ = true;
+			model_matrix_changed_ = false;
+			opacity_changed_ = false;
+		}
+
+		return;
+	}
+
 	//Vertex data or model matrix has changed
 	if (data_changed_ || model_matrix_changed_)
 	{
@@ -330,7 +466,7 @@ void RenderPrimitive::UpdateWorldZ() noexcept
 	//Vertex data or model matrix has changed
 	if (data_changed_ || model_matrix_changed_)
 	{
-		auto z = detail::get_position_z(vertex_metrics_, vertex_data_);
+		auto z = Z();
 
 		//Check if position z has changed for first vertex
 		if (z = (model_matrix_ * Vector3{0.0_r, 0.0_r, z}).Z(); world_z_ != z)
@@ -344,6 +480,37 @@ void RenderPrimitive::UpdateWorldZ() noexcept
 
 //Protected
 
+void RenderPrimitive::StreamedVertexData(int size, const Aabb &aabb, real z) noexcept
+{
+	if (!std::empty(vertex_data_))
+	{
+		vertex_data_.clear();
+		vertex_data_.shrink_to_fit();
+		world_vertex_data_.clear();
+		world_vertex_data_.shrink_to_fit();
+	}
+
+	streamed_data_size_ = size > 0 ? size : 0;
+	streamed_z_ = z;
+	streamed_ = true;
+	aabb_ = aabb;
+
+	data_changed_ = true;
+	world_data_changed_ = false; //Discard world changes
+	VertexDataChanged();
+}
+
+
+/*
+	Streaming
+*/
+
+void RenderPrimitive::WriteVertexData([[maybe_unused]] real *destination) const noexcept
+{
+	//Optional to override
+}
+
+
 /*
 	Events
 */
@@ -452,6 +619,7 @@ void RenderPrimitive::VertexData(VertexContainer data) noexcept
 	{
 		vertex_data_ = std::move(data);
 		aabb_ = detail::get_aabb(vertex_metrics_, vertex_data_);
+		streamed_ = false;
 
 		data_changed_ = true;
 		world_data_changed_ = false; //Discard world changes
@@ -463,6 +631,13 @@ void RenderPrimitive::AppendVertexData(const render_primitive::VertexContainer &
 {
 	if (!std::empty(data))
 	{
+		//Discard streamed vertex data
+		if (streamed_)
+		{
+			aabb_ = {};
+			streamed_ = false;
+		}
+
 		vertex_data_.insert(std::end(vertex_data_), std::begin(data), std::end(data));
 		aabb_.Merge(detail::get_aabb(vertex_metrics_, data));
 
@@ -536,7 +711,6 @@ bool RenderPrimitive::IsGroupable(const RenderPrimitive &primitive) const noexce
 {
 	return draw_mode_ == primitive.draw_mode_ &&
 		   world_z_ == primitive.world_z_ &&
-		   material_ == primitive.material_ &&
 		   texture_handle_ == primitive.texture_handle_ &&
 		   point_size_ == primitive.point_size_ &&
 		   line_thickness_ == primitive.line_thickness_ &&
@@ -545,7 +719,11 @@ bool RenderPrimitive::IsGroupable(const RenderPrimitive &primitive) const noexce
 
 		   //Check slowest equalities last
 		   vertex_declaration_ == primitive.vertex_declaration_ &&
-		   detail::all_passes_equal(passes_, primitive.passes_);
+		   detail::all_passes_equal(passes_, primitive.passes_) &&
+
+		   //Different materials can share a batch (if bound to the same textures)
+		   (material_ == primitive.material_ ||
+			(material_ && primitive.material_ && material_->IsBatchableWith(*primitive.material_)));
 }
 
 
@@ -585,6 +763,13 @@ void RenderPrimitive::Refresh()
 
 	if (need_refresh_)
 	{
+		//Point sprites are textured using tex coords [0, 1] over the whole bound texture
+		if (point_sprite_ && material_)
+		{
+			if (auto [animation, texture] = material_->DiffuseMap(); texture)
+				texture->Packable(false);
+		}
+
 		if (parent_renderer_)
 			parent_renderer_->RefreshPrimitive(*this);
 
@@ -46,6 +46,9 @@ namespace ion::graphics::render
 
 		namespace detail
 		{
+			constexpr auto block_size = 256; //Max vertices processed per block, when using temporary (stack) buffers
+
+
 			struct vertex_metrics final
 			{
 				int position_components = 0;
@@ -57,10 +60,24 @@ namespace ion::graphics::render
 				int color_stride = 0;
 			};
 
+			///@brief The coefficients of a model matrix, hoisted out so that many positions can be transformed with the same matrix
+			///@details Each transformed component i is given by ((m[i][0] * x + m[i][1] * y) + m[i][2] * z) + m[i][3]
+			struct affine_transform final
+			{
+				real m[3][4] = {};
+				real inv_w = 1.0_r;
+			};
+
 
 			int get_vertex_count(const vertex::VertexDeclaration &vertex_declaration, const vertex::VertexDataView &data_view) noexcept;
 			vertex_metrics get_vertex_metrics(const vertex::VertexDeclaration &vertex_declaration) noexcept;
 
+			affine_transform get_affine_transform(const Matrix4 &model_matrix) noexcept;
+
+			void transform_positions2(const affine_transform &transform, real *data, int count, int stride) noexcept;
+			void transform_positions3(const affine_transform &transform, real *data, int count, int stride) noexcept;
+			void multiply_components(real factor, const real *source, real *data, int count, int stride) noexcept;
+
 			void transform_positions(const vertex_metrics &metrics, const Matrix4 &model_matrix, VertexContainer &data) noexcept;
 			void apply_color(const vertex_metrics &metrics, const Color &color, VertexContainer &data) noexcept;
 			void apply_opacity(const vertex_metrics &metrics, real opacity, VertexContainer &data) noexcept;
@@ -92,6 +109,10 @@ namespace ion::graphics::render
 			real world_z_ = 0.0_r;
 			Aabb aabb_;
 
+			int streamed_data_size_ = 0;
+			real streamed_z_ = 0.0_r; //Local space
+			bool streamed_ = false;
+
 			render_pass::Passes passes_;
 			NonOwningPtr<materials::Material> material_;
 			materials::Material *applied_material_ = nullptr;
@@ -124,6 +145,30 @@ namespace ion::graphics::render
 				return vertex_data_;
 			}
 
+			///@brief Signals that the vertex data returned by VertexData has been modified in place
+			///@details The local bounding box is not recalculated, use VertexData(data) if vertex positions has changed
+			inline void VertexDataModified() noexcept
+			{
+				data_changed_ = true;
+			}
+
+			///@brief Sets the size (in number of reals), local bounding box and local z of the vertex data streamed by this render primitive
+			///@details Makes this a streamed render primitive, where vertex data is not stored in the primitive.
+			///The vertex data is instead written directly into the parent renderer by WriteVertexData, when needed
+			void StreamedVertexData(int size, const Aabb &aabb, real z) noexcept;
+
+
+			/**
+				@name Streaming
+				@{
+			*/
+
+			///@brief Writes vertex data in world space directly into the given destination
+			///@details Called by the parent renderer for streamed render primitives only.
+			///The destination has room for VertexDataSize() reals, and the model matrix and opacity must be applied when writing
+			virtual void WriteVertexData(real *destination) const noexcept;
+
+			///@}
 
 			/**
 				@name Events
@@ -363,19 +408,31 @@ namespace ion::graphics::render
 			///@brief Returns the vertex count of this render primitive
 			[[nodiscard]] inline auto VertexCount() const noexcept
 			{
-				return render_primitive::detail::get_vertex_count(vertex_declaration_, vertex_data_);
+				if (streamed_)
+				{
+					auto vertex_size = vertex_declaration_.VertexSize();
+					return vertex_size > 0 ? streamed_data_size_ * static_cast<int>(sizeof(real)) / vertex_size : 0;
+				}
+				else
+					return render_primitive::detail::get_vertex_count(vertex_declaration_, vertex_data_);
 			}
 
 			///@brief Returns the vertex data size of this render primitive
 			[[nodiscard]] inline auto VertexDataSize() const noexcept
 			{
-				return std::ssize(vertex_data_);
+				return streamed_ ? streamed_data_size_ : static_cast<int>(std::ssize(vertex_data_));
 			}
 
 			///@brief Returns the z of this render primitive
 			[[nodiscard]] inline auto Z() const noexcept
 			{
-				return render_primitive::detail::get_position_z(vertex_metrics_, vertex_data_);
+				return streamed_ ? streamed_z_ : render_primitive::detail::get_position_z(vertex_metrics_, vertex_data_);
+			}
+
+			///@brief Returns true if this render primitive streams its vertex data directly into the parent renderer
+			[[nodiscard]] inline auto IsStreamed() const noexcept
+			{
+				return streamed_;
 			}
 
 			///@brief Returns the z of this render primitive in world space
@@ -512,6 +569,14 @@ namespace ion::graphics::render
 			///This function is typically called each frame
 			[[nodiscard]] bool PrepareVertexData();
 
+			///@brief Streams vertex data in world space directly into the given destination
+			///@details The destination must have room for VertexDataSize() reals.
+			///This function is typically called by the parent renderer, for streamed render primitives only
+			inline void StreamVertexData(real *destination) const noexcept
+			{
+				WriteVertexData(destination);
+			}
+
 			///@}
 	};
 
@@ -13,9 +13,13 @@ File:	IonRenderer.cpp
 #include "IonRenderer.h"
 
 #include <algorithm>
+#include <cassert>
 #include "graphics/IonGraphicsAPI.h"
+#include "graphics/materials/IonMaterial.h"
 #include "graphics/shaders/IonShaderProgram.h"
 #include "graphics/shaders/IonShaderProgramManager.h"
+#include "graphics/textures/IonTextureManager.h"
+#include "timers/IonStopwatch.h"
 
 namespace ion::graphics::render
 {
@@ -123,13 +127,9 @@ void disable_point_sprite() noexcept
 
 NonOwningPtr<renderer::detail::render_batch> Renderer::InsertBatch(renderer::detail::render_batches::iterator where, const RenderPrimitive &primitive)
 {
-	auto offset =
-		where == std::begin(batches_) ? 0 :
-		(*(where - 1))->offset + (*(where - 1))->capacity;
-
 	where = batches_.insert(where,
 		make_owning<renderer::detail::render_batch>(
-			primitive.WorldZ(), offset, 0, primitive.MakeVertexBatch())
+			primitive.WorldZ(), 0, 0, primitive.MakeVertexBatch())
 		);
 
 	auto vertex_data_size = primitive.VertexDataSize();
@@ -189,11 +189,63 @@ void Renderer::GroupWithBatch(RenderPrimitive &primitive, renderer::detail::rend
 
 void Renderer::GrowBatch(renderer::detail::render_batches::iterator where, int size)
 {
-	auto geometric = (*where)->capacity + (*where)->capacity / 2;
-	auto grow_size = geometric < (*where)->capacity + size ? size : geometric - (*where)->capacity;
+	auto &batch = **where;
+	auto geometric = batch.capacity + batch.capacity / 2;
+	auto grow_size = geometric < batch.capacity + size ? size : geometric - batch.capacity;
+	auto capacity = batch.capacity + grow_size;
+
+	auto extend =
+		[&]() noexcept
+		{
+			//Batch is followed by enough free space, grow in place
+			if (batch.capacity > 0 && allocator_.Extend(batch.offset, batch.capacity, grow_size))
+			{
+				batch.capacity = capacity;
+				batch.need_update = detail::update_status::Yes;
+				return true;
+			}
+			else
+				return false;
+		};
+
+	if (extend())
+		return;
+
+	auto offset = allocator_.Allocate(capacity);
 
-	//Reallocate if not enough capacity
-	if (std::ssize(vertex_data_) < used_capacity_ + grow_size)
+	//Not enough free space, reserve more at the end
+	if (!offset)
+	{
+		ReserveVertexData(capacity);
+
+		if (extend())
+			return;
+
+		offset = allocator_.Allocate(capacity);
+	}
+
+	//Move data to the new region (no other batches are affected)
+	if (batch.capacity > 0)
+	{
+		auto used_capacity = std::min(batch.used_capacity, batch.capacity);
+		std::copy(std::begin(vertex_data_) + batch.offset,
+			std::begin(vertex_data_) + batch.offset + used_capacity,
+			std::begin(vertex_data_) + *offset);
+
+		allocator_.Free(batch.offset, batch.capacity);
+	}
+
+	batch.offset = *offset;
+	batch.capacity = capacity;
+	batch.need_update = detail::update_status::Yes;
+}
+
+void Renderer::ReserveVertexData(int size)
+{
+	//Free space at the end can be used
+	auto grow_size = size - allocator_.FreeTailSize();
+
+	if (grow_size > 0)
 	{
 		vertex_data_.insert(std::end(vertex_data_), grow_size, 0.0_r); //Reallocates!
 
@@ -204,25 +256,9 @@ void Renderer::GrowBatch(renderer::detail::render_batches::iterator where, int s
 			vertex_data_.insert(std::end(vertex_data_), size_left, 0.0_r); //Does not reallocate
 		}
 
+		allocator_.Resize(static_cast<int>(std::ssize(vertex_data_)));
 		need_update_ = true; //Vertex data has reallocated
 	}
-
-	//Batch is not last, copy data to the right
-	if (where + 1 != std::end(batches_))
-	{
-		auto iter = where + 1;
-		std::copy_backward(std::begin(vertex_data_) + (*iter)->offset,
-			std::begin(vertex_data_) + used_capacity_,
-			std::begin(vertex_data_) + used_capacity_ + grow_size);
-
-		//Update offset on all succeeding batches
-		for (auto end = std::end(batches_); iter != end; ++iter)
-			(*iter)->offset += grow_size;
-	}
-
-	used_capacity_ += grow_size;
-	(*where)->capacity += grow_size;
-	(*where)->need_update = detail::update_status::YesSuccessive;
 }
 
 detail::groupable_status Renderer::IsGroupable(const RenderPrimitive &primitive, const renderer::detail::render_batch &batch) const noexcept
@@ -399,14 +435,74 @@ void Renderer::UpdateBatches()
 	}
 }
 
+void Renderer::DefragmentVertexData()
+{
+	//Free space is not fragmented enough
+	if (allocator_.FreeSize() == 0 ||
+		allocator_.Fragmentation() <= defragmentation_threshold_ ||
+		defragmentation_budget_ <= 0.0_sec)
+		return;
+
+	auto stopwatch = timers::Stopwatch::StartNew();
+	auto batches = std::vector<detail::render_batch*>{};
+	batches.reserve(std::size(batches_));
+
+	for (auto &batch : batches_)
+	{
+		if (batch->capacity > 0)
+			batches.push_back(batch.get());
+	}
+
+	//Sort by offset (ascending)
+	std::sort(std::begin(batches), std::end(batches),
+		[](auto &batch, auto &batch2) noexcept
+		{
+			return batch->offset < batch2->offset;
+		});
+
+	//Slide each batch down into the first free region before it
+	//Everything below the first free region is then compacted
+	for (auto &batch : batches)
+	{
+		auto &free_regions = allocator_.FreeRegions();
+
+		if (std::empty(free_regions))
+			break;
+
+		//Batch is above the first free region, move it down
+		if (auto offset = free_regions.front().offset; offset < batch->offset)
+		{
+			allocator_.Free(batch->offset, batch->capacity);
+
+			//Not enough free space below the batch, keep it where it is
+			if (!allocator_.AllocateAt(offset, batch->capacity))
+			{
+				[[maybe_unused]] auto restored = allocator_.AllocateAt(batch->offset, batch->capacity);
+				assert(restored); //Region was just freed
+				continue;
+			}
+
+			std::copy(std::begin(vertex_data_) + batch->offset,
+				std::begin(vertex_data_) + batch->offset + std::min(batch->used_capacity, batch->capacity),
+				std::begin(vertex_data_) + offset);
+
+			batch->offset = offset;
+			batch->need_update = detail::update_status::Yes;
+
+			//Continue next frame
+			if (stopwatch.Elapsed() >= defragmentation_budget_)
+				break;
+		}
+	}
+}
+
 void Renderer::PrepareVertexData() noexcept
 {
+	upload_stats_ = {};
+
 	auto out_of_date = false;
 	for (auto &batch : batches_)
 	{
-		auto data_to_upload = std::optional<std::pair<int, int>>{};
-			//A minimal data chunk [offset, size] that must be uploaded to VRAM
-
 		//Prepare all primitives
 		for (auto slot_offset = batch->offset; auto &slot : batch->slots)
 		{
@@ -415,15 +511,17 @@ void Renderer::PrepareVertexData() noexcept
 			//Copy data from primitive to vertex data
 			if (slot.need_update)
 			{
-				auto &vertex_data = slot.primitive->WorldVertexData();
-				std::copy(std::begin(vertex_data), std::end(vertex_data), std::begin(vertex_data_) + slot_offset);
-				slot.need_update = false;
-
-				if (!data_to_upload)
-					data_to_upload = std::pair{slot_offset, 0}; //Upload offset
+				//Primitive writes directly into vertex data (no intermediate copy)
+				if (slot.primitive->IsStreamed())
+					slot.primitive->StreamVertexData(std::data(vertex_data_) + slot_offset);
+				else
+				{
+					auto &vertex_data = slot.primitive->WorldVertexData();
+					std::copy(std::begin(vertex_data), std::end(vertex_data), std::begin(vertex_data_) + slot_offset);
+				}
 
-				data_to_upload->second = //Upload size
-					slot_offset + slot.capacity - data_to_upload->first;
+				slot.need_update = false;
+				batch->dirty_ranges.Add(slot_offset, slot.capacity, upload_coalesce_gap_);
 			}
 
 			slot_offset += slot.capacity;
@@ -442,36 +540,24 @@ void Renderer::PrepareVertexData() noexcept
 			if (!need_update_)
 			{
 				//Has vertex buffer object
-				if (vbo_ && *vbo_ && batch_need_update)
+				if (vbo_ && *vbo_ && !upload_sink_ && batch_need_update)
 					batch->vertex_batch.VertexBuffer( //Update vertex buffer
-						vbo_->SubBuffer(batch->offset * sizeof(real), batch->capacity * sizeof(real))
+						vbo_->SubBuffer(batch->offset * sizeof(real), batch->capacity * sizeof(real)),
+						false //Data uploaded below
 					);
 
 				//Update vertex data
 				batch->vertex_batch.VertexData(
-					{std::data(vertex_data_) + batch->offset, batch->used_capacity}
+					{std::data(vertex_data_) + batch->offset, batch->used_capacity},
+					false //Data uploaded below
 				);
 			}
 
+			//Upload all used data in batch
+			batch->dirty_ranges.Clear();
+			batch->dirty_ranges.Add(batch->offset, batch->used_capacity);
 			batch->need_update = detail::update_status::No;
 		}
-		else if (data_to_upload)
-		{
-			//Vertex data has not reallocated
-			if (!need_update_)
-			{
-				//Has vertex buffer object
-				if (vbo_ && *vbo_)
-					vbo_->Data( //Upload minimal data chunk from RAM to VRAM
-						{std::data(vertex_data_) + data_to_upload->first, data_to_upload->second},
-						data_to_upload->first * sizeof(real)
-					);
-				else //Update vertex data
-					batch->vertex_batch.VertexData(
-						{std::data(vertex_data_) + batch->offset, batch->used_capacity}
-					);
-			}
-		}
 
 		batch->last_used_capacity = batch->used_capacity;
 	}
@@ -479,20 +565,22 @@ void Renderer::PrepareVertexData() noexcept
 	//Vertex data has reallocated
 	if (need_update_)
 	{
-		if (!vbo_)
+		if (!vbo_ && !upload_sink_)
 			vbo_.emplace(render::vertex::vertex_buffer_object::VertexBufferUsage::Dynamic);
-		
-		//Has vertex buffer object
-		if (vbo_ && *vbo_)
-		{
-			vbo_->Data(vertex_data_); //Upload data from RAM to VRAM
 
-			//Update all vertex buffers
-			for (auto &batch : batches_)
+		UploadVertexData(); //Upload all data from RAM to VRAM
+
+		//Update all vertex buffers
+		for (auto &batch : batches_)
+		{
+			//Has vertex buffer object
+			if (vbo_ && *vbo_ && !upload_sink_)
 				batch->vertex_batch.VertexBuffer(
 					vbo_->SubBuffer(batch->offset * sizeof(real), batch->capacity * sizeof(real)),
 					false //Data already uploaded
 				);
+			else if (upload_sink_)
+				batch->vertex_batch.VertexBuffer({}, false);
 		}
 
 		//Update all vertex data
@@ -504,6 +592,69 @@ void Renderer::PrepareVertexData() noexcept
 
 		need_update_ = false;
 	}
+	else if (HasUploadTarget())
+	{
+		auto dirty_size = 0;
+		for (auto &batch : batches_)
+			dirty_size += batch->dirty_ranges.TotalSize();
+
+		//Mostly dirty, upload everything at once (orphans previous data)
+		if (dirty_size > 0 &&
+			dirty_size >= std::ssize(vertex_data_) * full_upload_threshold_)
+			UploadVertexData();
+
+		//Upload dirty ranges only
+		else if (dirty_size > 0)
+		{
+			for (auto &batch : batches_)
+			{
+				batch->dirty_ranges.Reduce(max_upload_ranges_);
+
+				for (auto &range : batch->dirty_ranges.Ranges())
+					UploadVertexData(range.offset, range.size);
+			}
+		}
+	}
+
+	for (auto &batch : batches_)
+		batch->dirty_ranges.Clear();
+}
+
+
+bool Renderer::HasUploadTarget() const noexcept
+{
+	return upload_sink_ || (vbo_ && *vbo_);
+}
+
+void Renderer::UploadVertexData() noexcept
+{
+	if (!HasUploadTarget())
+		return;
+
+	if (upload_sink_)
+		upload_sink_->Upload(vertex_data_);
+	else
+		vbo_->Data(vertex_data_); //Replaces (orphans) previous data
+
+	++upload_stats_.Uploads;
+	++upload_stats_.FullUploads;
+	upload_stats_.Bytes += std::ssize(vertex_data_) * static_cast<int64>(sizeof(real));
+}
+
+void Renderer::UploadVertexData(int offset, int size) noexcept
+{
+	if (!HasUploadTarget() || size <= 0)
+		return;
+
+	auto vertex_data = vertex::VertexDataView{std::data(vertex_data_) + offset, size};
+
+	if (upload_sink_)
+		upload_sink_->Upload(vertex_data, offset * sizeof(real));
+	else
+		vbo_->Data(vertex_data, offset * sizeof(real)); //Upload data chunk from RAM to VRAM
+
+	++upload_stats_.Uploads;
+	upload_stats_.Bytes += size * static_cast<int64>(sizeof(real));
 }
 
 
@@ -566,6 +717,7 @@ void Renderer::ClearBatches() noexcept
 	ClearPrimitives();
 	batches_.clear();
 	batches_.shrink_to_fit();
+	allocator_.Clear();
 }
 
 
@@ -737,6 +889,7 @@ void Renderer::Prepare()
 	{
 		vertex_data_.reserve(initial_vertex_data_size_);
 		vertex_data_.insert(std::end(vertex_data_), initial_vertex_data_size_, 0.0_r);
+		allocator_.Resize(initial_vertex_data_size_);
 	}
 
 	RefreshPrimitives();
@@ -744,6 +897,7 @@ void Renderer::Prepare()
 	UpdateBatchSlots();
 	CompressBatches();
 	UpdateBatches();
+	DefragmentVertexData();
 	PrepareVertexData();
 
 	//Prepare all batches
@@ -751,7 +905,37 @@ void Renderer::Prepare()
 	{
 		//Has one or more primitives
 		if (batch->used_capacity > 0)
+		{
+			//Primitives with batchable materials can share a batch,
+			//make sure the batch material is taken from one of its current primitives
+			if (auto iter =
+				std::find_if(std::begin(batch->slots), std::end(batch->slots),
+					[](auto &slot) noexcept
+					{
+						return !!slot.primitive;
+					}); iter != std::end(batch->slots))
+				batch->vertex_batch.BatchMaterial(iter->primitive->RenderMaterial());
+
+			//Only the batch material is used when drawing,
+			//keep the (packed) textures of all other materials in the batch resident
+			for (auto &slot : batch->slots)
+			{
+				if (slot.primitive)
+				{
+					if (auto material = slot.primitive->RenderMaterial();
+						material && material != batch->vertex_batch.BatchMaterial())
+					{
+						if (auto [animation, texture] = material->DiffuseMap(); texture)
+						{
+							if (auto owner = texture->Owner(); owner)
+								owner->Use(*texture);
+						}
+					}
+				}
+			}
+
 			batch->vertex_batch.Prepare();
+		}
 	}
 }
 
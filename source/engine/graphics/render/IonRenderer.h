@@ -13,11 +13,14 @@ File:	IonRenderer.h
 #ifndef ION_RENDERER_H
 #define ION_RENDERER_H
 
+#include <algorithm>
 #include <optional>
 #include <utility>
 #include <vector>
 
 #include "IonRenderPrimitive.h"
+#include "IonVertexDataAllocator.h"
+#include "IonVertexUpload.h"
 #include "memory/IonNonOwningPtr.h"
 #include "memory/IonOwningPtr.h"
 #include "types/IonTypes.h"
@@ -37,6 +40,13 @@ namespace ion::graphics::render
 			constexpr auto default_batch_data_size = default_primitive_size * 32;
 			constexpr auto default_vertex_data_size = default_batch_data_size * 64;
 
+			constexpr auto default_upload_coalesce_gap = default_primitive_size * 2; //Coalesce ranges closer than two sprites
+			constexpr auto default_max_upload_ranges = 8; //Per batch
+			constexpr auto default_full_upload_threshold = 0.5_r; //Upload everything if more than half is dirty
+
+			constexpr auto default_defragmentation_threshold = 0.5_r; //Defragment if less than half of the free space is in one region
+			constexpr auto default_defragmentation_budget = 0.0005_sec; //Max time spent defragmenting each frame
+
 			using render_primitives = std::vector<RenderPrimitive*>;
 
 			enum class update_status
@@ -78,6 +88,7 @@ namespace ion::graphics::render
 				render_batch_slots slots;
 				vertex::VertexBatch vertex_batch;
 				update_status need_update = update_status::YesSuccessive;
+				DirtyRanges dirty_ranges;
 
 				///@brief Constructor
 				render_batch(real z, int offset, int capacity, vertex::VertexBatch vertex_batch) noexcept;
@@ -111,9 +122,13 @@ namespace ion::graphics::render
 	{
 		private:
 
-			int used_capacity_ = 0;
 			int initial_vertex_data_size_ = renderer::detail::default_vertex_data_size;
 			int initial_batch_data_size_ = renderer::detail::default_batch_data_size;
+			int upload_coalesce_gap_ = renderer::detail::default_upload_coalesce_gap;
+			int max_upload_ranges_ = renderer::detail::default_max_upload_ranges;
+			real full_upload_threshold_ = renderer::detail::default_full_upload_threshold;
+			real defragmentation_threshold_ = renderer::detail::default_defragmentation_threshold;
+			duration defragmentation_budget_ = renderer::detail::default_defragmentation_budget;
 
 			renderer::detail::render_batches batches_;
 			renderer::detail::render_primitives added_primitives_;
@@ -121,13 +136,17 @@ namespace ion::graphics::render
 			renderer::detail::render_primitives pending_primitives_;
 
 			render_primitive::VertexContainer vertex_data_; //Data (RAM)
+			VertexDataAllocator allocator_; //Batch regions in vertex data
 			std::optional<vertex::VertexBufferObject> vbo_; //Stream buffer (VRAM)
+			VertexUploadSink *upload_sink_ = nullptr;
+			vertex_upload::VertexUploadStats upload_stats_;
 			bool need_update_ = true;
 
 
 			NonOwningPtr<renderer::detail::render_batch> InsertBatch(renderer::detail::render_batches::iterator where, const RenderPrimitive &primitive);
 			void GroupWithBatch(RenderPrimitive &primitive, renderer::detail::render_batch &batch);
 			void GrowBatch(renderer::detail::render_batches::iterator where, int size);
+			void ReserveVertexData(int size);
 			renderer::detail::groupable_status IsGroupable(const RenderPrimitive &primitive, const renderer::detail::render_batch &batch) const noexcept;
 
 			void RefreshPrimitives();
@@ -135,8 +154,13 @@ namespace ion::graphics::render
 			void UpdateBatchSlots();
 			void CompressBatches() noexcept;
 			void UpdateBatches();
+			void DefragmentVertexData();
 			void PrepareVertexData() noexcept;
 
+			bool HasUploadTarget() const noexcept;
+			void UploadVertexData() noexcept;
+			void UploadVertexData(int offset, int size) noexcept;
+
 		public:
 
 			///@brief Default constructor
@@ -182,6 +206,52 @@ namespace ion::graphics::render
 				initial_batch_data_size_ = size > 0 ? size : 0;
 			}
 
+
+			///@brief Sets the max gap (in number of reals) between two dirty ranges, for them to be uploaded as one range
+			inline void UploadCoalesceGap(int gap) noexcept
+			{
+				upload_coalesce_gap_ = gap > 0 ? gap : 0;
+			}
+
+			///@brief Sets the max number of uploads (dirty ranges) per batch for each frame
+			///@details If a batch has more dirty ranges, the ranges closest to each other are coalesced
+			inline void MaxUploadRanges(int count) noexcept
+			{
+				max_upload_ranges_ = count > 1 ? count : 1;
+			}
+
+			///@brief Sets the fraction of dirty vertex data, in range [0.0, 1.0], that triggers a full upload
+			///@details A full upload replaces (orphans) all previous data, instead of uploading many smaller ranges
+			inline void FullUploadThreshold(real threshold) noexcept
+			{
+				full_upload_threshold_ = std::clamp(threshold, 0.0_r, 1.0_r);
+			}
+
+			///@brief Sets the fragmentation of free vertex data, in range [0.0, 1.0], that triggers defragmentation
+			inline void DefragmentationThreshold(real threshold) noexcept
+			{
+				defragmentation_threshold_ = std::clamp(threshold, 0.0_r, 1.0_r);
+			}
+
+			///@brief Sets the max time spent defragmenting vertex data each frame
+			///@details Defragmentation continues next frame, if not completed within the given time
+			inline void DefragmentationBudget(duration budget) noexcept
+			{
+				defragmentation_budget_ = std::max(budget, 0.0_sec);
+			}
+
+			///@brief Sets the upload sink used by this renderer to the given sink
+			///@details All vertex data is uploaded to the given sink instead of to a vertex buffer object.
+			///Pass nullptr to upload to a vertex buffer object (default)
+			inline void UploadSink(VertexUploadSink *sink) noexcept
+			{
+				if (upload_sink_ != sink)
+				{
+					upload_sink_ = sink;
+					need_update_ = true; //Upload everything to the new target
+				}
+			}
+
 			///@}
 
 			/**
@@ -201,6 +271,56 @@ namespace ion::graphics::render
 				return initial_batch_data_size_;
 			}
 
+
+			///@brief Returns the max gap (in number of reals) between two dirty ranges, for them to be uploaded as one range
+			[[nodiscard]] inline auto UploadCoalesceGap() const noexcept
+			{
+				return upload_coalesce_gap_;
+			}
+
+			///@brief Returns the max number of uploads (dirty ranges) per batch for each frame
+			[[nodiscard]] inline auto MaxUploadRanges() const noexcept
+			{
+				return max_upload_ranges_;
+			}
+
+			///@brief Returns the fraction of dirty vertex data, in range [0.0, 1.0], that triggers a full upload
+			[[nodiscard]] inline auto FullUploadThreshold() const noexcept
+			{
+				return full_upload_threshold_;
+			}
+
+			///@brief Returns the fragmentation of free vertex data, in range [0.0, 1.0], that triggers defragmentation
+			[[nodiscard]] inline auto DefragmentationThreshold() const noexcept
+			{
+				return defragmentation_threshold_;
+			}
+
+			///@brief Returns the max time spent defragmenting vertex data each frame
+			[[nodiscard]] inline auto DefragmentationBudget() const noexcept
+			{
+				return defragmentation_budget_;
+			}
+
+			///@brief Returns the allocator used to place batches in the vertex data of this renderer
+			[[nodiscard]] inline auto& VertexDataLayout() const noexcept
+			{
+				return allocator_;
+			}
+
+			///@brief Returns the upload sink used by this renderer
+			///@details Returns nullptr if vertex data is uploaded to a vertex buffer object (default)
+			[[nodiscard]] inline auto UploadSink() const noexcept
+			{
+				return upload_sink_;
+			}
+
+			///@brief Returns statistics about vertex data uploaded by this renderer, in the last prepare
+			[[nodiscard]] inline auto& UploadStats() const noexcept
+			{
+				return upload_stats_;
+			}
+
 			///@brief Returns the z range of all batches in this renderer
 			[[nodiscard]] inline auto ZRange() const noexcept
 				-> std::optional<std::pair<real, real>>
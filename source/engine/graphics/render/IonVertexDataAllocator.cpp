@@ -0,0 +1,197 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/render
+File:	IonVertexDataAllocator.cpp
+-------------------------------------------
+*/
+
+#include "IonVertexDataAllocator.h"
+
+#include <algorithm>
+
+namespace ion::graphics::render
+{
+
+using namespace vertex_data_allocator;
+
+//Private
+
+void VertexDataAllocator::Insert(detail::free_region region)
+{
+	if (region.size <= 0)
+		return;
+
+	//Find first free region after the given region
+	auto iter = std::upper_bound(std::begin(free_regions_), std::end(free_regions_), region.offset,
+		[](auto offset, auto &free_region) noexcept
+		{
+			return offset < free_region.offset;
+		});
+
+	//Coalesce with next
+	if (iter != std::end(free_regions_) && region.end() == iter->offset)
+	{
+		region.size += iter->size;
+		iter = free_regions_.erase(iter);
+	}
+
+	//Coalesce with previous
+	if (iter != std::begin(free_regions_) && (iter - 1)->end() == region.offset)
+		(iter - 1)->size += region.size;
+	else
+		free_regions_.insert(iter, region);
+}
+
+void VertexDataAllocator::Take(detail::free_regions::iterator where, int offset, int size)
+{
+	auto head = detail::free_region{where->offset, offset - where->offset};
+	auto tail = detail::free_region{offset + size, where->end() - (offset + size)};
+
+	//Split free region into [head, allocated, tail]
+	if (head.size > 0 && tail.size > 0)
+	{
+		*where = head;
+		free_regions_.insert(where + 1, tail);
+	}
+	else if (head.size > 0)
+		*where = head;
+	else if (tail.size > 0)
+		*where = tail;
+	else
+		free_regions_.erase(where);
+
+	used_size_ += size;
+}
+
+
+//Public
+
+VertexDataAllocator::VertexDataAllocator(int size)
+{
+	Resize(size);
+}
+
+
+/*
+	Modifiers
+*/
+
+void VertexDataAllocator::Resize(int size)
+{
+	if (size > size_)
+	{
+		Insert({size_, size - size_});
+		size_ = size;
+	}
+}
+
+void VertexDataAllocator::Clear() noexcept
+{
+	free_regions_.clear();
+	used_size_ = 0;
+
+	if (size_ > 0)
+		free_regions_.push_back({0, size_});
+}
+
+
+/*
+	Observers
+*/
+
+int VertexDataAllocator::LargestFreeRegion() const noexcept
+{
+	auto size = 0;
+
+	for (auto &region : free_regions_)
+		size = std::max(size, region.size);
+
+	return size;
+}
+
+int VertexDataAllocator::FreeTailSize() const noexcept
+{
+	return !std::empty(free_regions_) && free_regions_.back().end() == size_ ?
+		free_regions_.back().size : 0;
+}
+
+real VertexDataAllocator::Fragmentation() const noexcept
+{
+	auto free_size = FreeSize();
+	return free_size > 0 ?
+		1.0_r - static_cast<real>(LargestFreeRegion()) / free_size :
+		0.0_r;
+}
+
+
+/*
+	Allocating
+*/
+
+std::optional<int> VertexDataAllocator::Allocate(int size)
+{
+	if (size <= 0)
+		return {};
+
+	auto best = std::end(free_regions_);
+
+	//Best fit
+	for (auto iter = std::begin(free_regions_), end = std::end(free_regions_); iter != end; ++iter)
+	{
+		if (iter->size >= size && (best == std::end(free_regions_) || iter->size < best->size))
+		{
+			best = iter;
+
+			//Exact fit
+			if (iter->size == size)
+				break;
+		}
+	}
+
+	if (best == std::end(free_regions_))
+		return {};
+
+	auto offset = best->offset;
+	Take(best, offset, size);
+	return offset;
+}
+
+bool VertexDataAllocator::AllocateAt(int offset, int size)
+{
+	if (size <= 0)
+		return false;
+
+	//Find free region containing offset
+	auto iter = std::upper_bound(std::begin(free_regions_), std::end(free_regions_), offset,
+		[](auto offset, auto &free_region) noexcept
+		{
+			return offset < free_region.offset;
+		});
+
+	if (iter == std::begin(free_regions_) || (iter - 1)->end() < offset + size)
+		return false;
+
+	Take(iter - 1, offset, size);
+	return true;
+}
+
+bool VertexDataAllocator::Extend(int offset, int size, int grow_size)
+{
+	return grow_size > 0 && AllocateAt(offset + size, grow_size);
+}
+
+void VertexDataAllocator::Free(int offset, int size)
+{
+	if (size > 0)
+	{
+		Insert({offset, size});
+		used_size_ -= size;
+	}
+}
+
+} //ion::graphics::render
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/render
+File:	IonVertexDataAllocator.h
+-------------------------------------------
+*/
+
+#ifndef ION_VERTEX_DATA_ALLOCATOR_H
+#define ION_VERTEX_DATA_ALLOCATOR_H
+
+#include <optional>
+#include <vector>
+
+#include "types/IonTypes.h"
+
+namespace ion::graphics::render
+{
+	using namespace types::type_literals;
+
+	namespace vertex_data_allocator::detail
+	{
+		struct free_region final
+		{
+			int offset = 0;
+			int size = 0;
+
+			[[nodiscard]] inline auto end() const noexcept
+			{
+				return offset + size;
+			}
+		};
+
+		using free_regions = std::vector<free_region>;
+	} //vertex_data_allocator::detail
+
+
+	///@brief A class representing an allocator of regions (batches) inside of one shared vertex data buffer
+	///@details Free regions are kept in a free list sorted by offset, and are coalesced with their neighbors when freed.
+	///Allocations uses best fit, and regions can be extended in place if followed by a free region.
+	///The allocator only keeps track of offsets and sizes (in number of reals), the data itself is owned by the caller
+	class VertexDataAllocator final
+	{
+		private:
+
+			vertex_data_allocator::detail::free_regions free_regions_;
+			int size_ = 0;
+			int used_size_ = 0;
+
+
+			void Insert(vertex_data_allocator::detail::free_region region);
+			void Take(vertex_data_allocator::detail::free_regions::iterator where, int offset, int size);
+
+		public:
+
+			///@brief Default constructor
+			VertexDataAllocator() = default;
+
+			///@brief Constructs a new allocator managing the given size, with everything free
+			explicit VertexDataAllocator(int size);
+
+
+			/**
+				@name Modifiers
+				@{
+			*/
+
+			///@brief Grows the managed size to the given size
+			///@details The new space is added as free, at the end
+			void Resize(int size);
+
+			///@brief Frees everything
+			void Clear() noexcept;
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the managed size
+			[[nodiscard]] inline auto Size() const noexcept
+			{
+				return size_;
+			}
+
+			///@brief Returns the allocated size
+			[[nodiscard]] inline auto UsedSize() const noexcept
+			{
+				return used_size_;
+			}
+
+			///@brief Returns the free size
+			[[nodiscard]] inline auto FreeSize() const noexcept
+			{
+				return size_ - used_size_;
+			}
+
+			///@brief Returns all free regions, sorted by offset
+			[[nodiscard]] inline auto& FreeRegions() const noexcept
+			{
+				return free_regions_;
+			}
+
+			///@brief Returns the size of the largest free region
+			[[nodiscard]] int LargestFreeRegion() const noexcept;
+
+			///@brief Returns the size of the free region at the end, if any
+			[[nodiscard]] int FreeTailSize() const noexcept;
+
+			///@brief Returns the fragmentation of the free space, in range [0.0, 1.0]
+			///@details Returns 0.0 if all free space is in one region, and close to 1.0 if scattered in many small regions
+			[[nodiscard]] real Fragmentation() const noexcept;
+
+			///@}
+
+			/**
+				@name Allocating
+				@{
+			*/
+
+			///@brief Allocates a region with the given size, using best fit
+			///@details Returns the offset of the region, or nullopt if no free region is large enough
+			[[nodiscard]] std::optional<int> Allocate(int size);
+
+			///@brief Allocates the region [offset, offset + size), if that region is entirely free
+			[[nodiscard]] bool AllocateAt(int offset, int size);
+
+			///@brief Extends the allocated region [offset, offset + size) in place, by the given grow size
+			///@details Returns true if the region was followed by enough free space
+			[[nodiscard]] bool Extend(int offset, int size, int grow_size);
+
+			///@brief Frees the allocated region [offset, offset + size)
+			void Free(int offset, int size);
+
+			///@}
+	};
+} //ion::graphics::render
+
+#endif
\ No newline at end of file
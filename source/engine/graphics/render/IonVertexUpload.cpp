@@ -0,0 +1,103 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/render
+File:	IonVertexUpload.cpp
+-------------------------------------------
+*/
+
+#include "IonVertexUpload.h"
+
+#include <algorithm>
+
+namespace ion::graphics::render
+{
+
+using namespace vertex_upload;
+
+/*
+	Modifiers
+*/
+
+void DirtyRanges::Add(int offset, int size, int coalesce_gap)
+{
+	if (size <= 0)
+		return;
+
+	auto range = detail::dirty_range{offset, size};
+	coalesce_gap = std::max(coalesce_gap, 0);
+
+	//Ranges are usually added in ascending order, check last range first
+	if (std::empty(ranges_) || ranges_.back().offset <= offset)
+	{
+		if (!std::empty(ranges_) && offset <= ranges_.back().end() + coalesce_gap)
+			ranges_.back().size = std::max(ranges_.back().end(), range.end()) - ranges_.back().offset;
+		else
+			ranges_.push_back(range);
+
+		return;
+	}
+
+	//Insert sorted by offset
+	auto iter = ranges_.insert(
+		std::upper_bound(std::begin(ranges_), std::end(ranges_), offset,
+			[](auto offset, auto &range) noexcept
+			{
+				return offset < range.offset;
+			}), range);
+
+	//Coalesce with previous range
+	if (iter != std::begin(ranges_) && iter->offset <= (iter - 1)->end() + coalesce_gap)
+	{
+		auto prev = iter - 1;
+		prev->size = std::max(prev->end(), iter->end()) - prev->offset;
+		iter = ranges_.erase(iter) - 1;
+	}
+
+	//Coalesce with all succeeding ranges
+	auto last = iter + 1;
+	for (; last != std::end(ranges_) && last->offset <= iter->end() + coalesce_gap; ++last)
+		iter->size = std::max(iter->end(), last->end()) - iter->offset;
+
+	ranges_.erase(iter + 1, last);
+}
+
+void DirtyRanges::Reduce(int max_count) noexcept
+{
+	max_count = std::max(max_count, 1);
+
+	while (std::ssize(ranges_) > max_count)
+	{
+		//Find neighboring ranges with the smallest gap
+		auto smallest = std::begin(ranges_);
+		for (auto iter = std::begin(ranges_) + 1, end = std::end(ranges_) - 1; iter != end; ++iter)
+		{
+			if ((iter + 1)->offset - iter->end() < (smallest + 1)->offset - smallest->end())
+				smallest = iter;
+		}
+
+		smallest->size = (smallest + 1)->end() - smallest->offset;
+		ranges_.erase(smallest + 1);
+	}
+}
+
+
+/*
+	Observers
+*/
+
+int DirtyRanges::TotalSize() const noexcept
+{
+	auto size = 0;
+
+	for (auto &range : ranges_)
+		size += range.size;
+
+	return size;
+}
+
+} //ion::graphics::render
\ No newline at end of file
@@ -0,0 +1,150 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/render
+File:	IonVertexUpload.h
+-------------------------------------------
+*/
+
+#ifndef ION_VERTEX_UPLOAD_H
+#define ION_VERTEX_UPLOAD_H
+
+#include <vector>
+
+#include "types/IonTypes.h"
+#include "vertex/IonVertexDataView.h"
+
+namespace ion::graphics::render
+{
+	using namespace types::type_literals;
+
+	namespace vertex_upload
+	{
+		///@brief Statistics about vertex data uploaded from RAM to VRAM (for one frame)
+		struct VertexUploadStats final
+		{
+			int Uploads = 0; //Number of uploads (including full uploads)
+			int FullUploads = 0; //Number of full uploads (previous data orphaned)
+			int64 Bytes = 0; //Number of bytes uploaded
+		};
+
+
+		namespace detail
+		{
+			struct dirty_range final
+			{
+				int offset = 0;
+				int size = 0;
+
+				[[nodiscard]] inline auto end() const noexcept
+				{
+					return offset + size;
+				}
+			};
+
+			using dirty_ranges = std::vector<dirty_range>;
+		} //detail
+	} //vertex_upload
+
+
+	///@brief A class representing a sorted set of dirty (changed) ranges [offset, offset + size) of vertex data
+	///@details Ranges that overlaps, or that are closer than a given gap, are coalesced into one range when added.
+	///The number of ranges can later be reduced to a maximum, by coalescing the ranges with the smallest gaps first
+	class DirtyRanges final
+	{
+		private:
+
+			vertex_upload::detail::dirty_ranges ranges_;
+
+		public:
+
+			///@brief Default constructor
+			DirtyRanges() = default;
+
+
+			/**
+				@name Modifiers
+				@{
+			*/
+
+			///@brief Adds the given range as dirty
+			///@details The range is coalesced with any ranges that overlaps or are closer than the given gap
+			void Add(int offset, int size, int coalesce_gap = 0);
+
+			///@brief Reduces the number of ranges to the given max count
+			///@details Neighboring ranges with the smallest gaps are coalesced first
+			void Reduce(int max_count) noexcept;
+
+			///@brief Clears all dirty ranges
+			inline void Clear() noexcept
+			{
+				ranges_.clear();
+			}
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns all dirty ranges, sorted by offset
+			[[nodiscard]] inline auto& Ranges() const noexcept
+			{
+				return ranges_;
+			}
+
+			///@brief Returns the number of dirty ranges
+			[[nodiscard]] inline auto Count() const noexcept
+			{
+				return static_cast<int>(std::size(ranges_));
+			}
+
+			///@brief Returns true if there are no dirty ranges
+			[[nodiscard]] inline auto Empty() const noexcept
+			{
+				return std::empty(ranges_);
+			}
+
+			///@brief Returns the total size of all dirty ranges
+			[[nodiscard]] int TotalSize() const noexcept;
+
+			///@}
+	};
+
+
+	///@brief A class representing a sink that receives vertex data uploads from a renderer
+	///@details Derive from this class to receive uploads somewhere else than in a vertex buffer object.
+	///This makes it possible to inspect what a renderer uploads, without having a graphics context
+	class VertexUploadSink
+	{
+		public:
+
+			///@brief Default constructor
+			VertexUploadSink() = default;
+
+			///@brief Virtual destructor
+			virtual ~VertexUploadSink() = default;
+
+
+			/**
+				@name Uploading
+				@{
+			*/
+
+			///@brief Uploads the given vertex data, replacing all previous data
+			///@details Any previous data should be orphaned, so that the upload does not wait for pending draws
+			virtual void Upload(const vertex::VertexDataView &vertex_data) noexcept = 0;
+
+			///@brief Uploads the given vertex data at the given offset (in bytes)
+			virtual void Upload(const vertex::VertexDataView &vertex_data, int offset) noexcept = 0;
+
+			///@}
+	};
+} //ion::graphics::render
+
+#endif
\ No newline at end of file
@@ -22,6 +22,7 @@ File:	IonVertexBatch.cpp
 #include "graphics/shaders/IonShaderProgram.h"
 #include "graphics/shaders/IonShaderProgramManager.h"
 #include "graphics/textures/IonAnimation.h"
+#include "graphics/textures/IonTextureManager.h"
 #include "types/IonTypeTraits.h"
 
 namespace ion::graphics::render::vertex
@@ -87,17 +88,24 @@ std::tuple<NonOwningPtr<textures::Animation>, NonOwningPtr<textures::Texture>, s
 	}, some_texture);
 }
 
+std::optional<textures::texture::TextureHandle> use_texture(NonOwningPtr<textures::Texture> texture) noexcept
+{
+	if (!texture)
+		return {};
+
+	//Keep texture resident (or load it back in if evicted)
+	if (auto owner = texture->Owner(); owner)
+		owner->Use(*texture);
+
+	return texture->Handle();
+}
+
 std::optional<textures::texture::TextureHandle> get_texture_handle(const texture_type &some_texture, duration time) noexcept
 {
 	if (auto [animation, texture, texture_handle] = get_textures(some_texture); animation)
-	{
-		if (auto frame = animation->Owner() ? animation->FrameAt(time) : animation->CurrentFrame(); frame)
-			return frame->Handle();
-		else
-			return {};
-	}
+		return use_texture(animation->Owner() ? animation->FrameAt(time) : animation->CurrentFrame());
 	else if (texture)
-		return texture->Handle();
+		return use_texture(texture);
 	else
 		return texture_handle;
 }
@@ -376,11 +384,11 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 	
 	if (auto diffuse_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_DiffuseMap); diffuse_map)
 	{
-		if (auto texture = material->DiffuseMap(time); texture && texture->Handle())
+		if (auto texture_handle = use_texture(material->DiffuseMap(time)); texture_handle)
 		{
 			if (auto texture_unit = diffuse_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
-				bind_texture(*texture->Handle(), texture_unit);
+				bind_texture(*texture_handle, texture_unit);
 				diffuse_map_activated = true;
 			}
 		}
@@ -388,11 +396,11 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 	
 	if (auto normal_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_NormalMap); normal_map)
 	{
-		if (auto texture = material->NormalMap(time); texture && texture->Handle())
+		if (auto texture_handle = use_texture(material->NormalMap(time)); texture_handle)
 		{
 			if (auto texture_unit = normal_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
-				bind_texture(*texture->Handle(), texture_unit);
+				bind_texture(*texture_handle, texture_unit);
 				normal_map_activated = true;
 			}
 		}
@@ -400,11 +408,11 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 
 	if (auto specular_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_SpecularMap); specular_map)
 	{
-		if (auto texture = material->SpecularMap(time); texture && texture->Handle())
+		if (auto texture_handle = use_texture(material->SpecularMap(time)); texture_handle)
 		{
 			if (auto texture_unit = specular_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
-				bind_texture(*texture->Handle(), texture_unit);
+				bind_texture(*texture_handle, texture_unit);
 				specular_map_activated = true;
 			}
 		}
@@ -412,11 +420,11 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 
 	if (auto emissive_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_EmissiveMap); emissive_map)
 	{
-		if (auto texture = material->EmissiveMap(time); texture && texture->Handle())
+		if (auto texture_handle = use_texture(material->EmissiveMap(time)); texture_handle)
 		{
 			if (auto texture_unit = emissive_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
-				bind_texture(*texture->Handle(), texture_unit);
+				bind_texture(*texture_handle, texture_unit);
 				emissive_map_activated = true;
 			}
 		}
@@ -650,8 +658,8 @@ void VertexBatch::Draw(shaders::ShaderProgram *shader_program) noexcept
 		if (material_)
 		{
 			//Enable diffuse texture
-			if (auto diffuse_map = material_->DiffuseMap(time_); diffuse_map && diffuse_map->Handle())
-				detail::bind_texture(*diffuse_map->Handle());
+			if (auto texture_handle = detail::use_texture(material_->DiffuseMap(time_)); texture_handle)
+				detail::bind_texture(*texture_handle);
 		}
 		//Has texture
 		else if (texture_.index() > 0)
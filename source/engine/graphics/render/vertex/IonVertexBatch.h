@@ -78,6 +78,7 @@ namespace ion::graphics::render::vertex
 
 			std::tuple<NonOwningPtr<textures::Animation>, NonOwningPtr<textures::Texture>, std::optional<textures::texture::TextureHandle>>
 				get_textures(const texture_type &some_texture) noexcept;
+			std::optional<textures::texture::TextureHandle> use_texture(NonOwningPtr<textures::Texture> texture) noexcept;
 			std::optional<textures::texture::TextureHandle> get_texture_handle(const texture_type &some_texture, duration time) noexcept;
 
 
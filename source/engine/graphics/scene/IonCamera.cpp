@@ -85,6 +85,7 @@ void Camera::PrepareBoundingVolumes() noexcept
 	aabb_ = Aabb::Size({right - left, top - bottom}, position_).RotateCopy(rotation_);
 	obb_ = aabb_;
 	sphere_ = {aabb_.ToHalfSize().Max(), aabb_.Center()};
+	NotifyBoundingVolumesChanged();
 }
 
 
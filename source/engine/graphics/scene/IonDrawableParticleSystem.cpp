@@ -12,6 +12,8 @@ File:	IonDrawableParticleSystem.cpp
 
 #include "IonDrawableParticleSystem.h"
 
+#include <algorithm>
+
 #include "query/IonSceneQuery.h"
 
 namespace ion::graphics::scene
@@ -25,6 +27,23 @@ namespace drawable_particle_system::detail
 
 //Protected
 
+/*
+	Streaming
+*/
+
+void particle_emitter_primitive::WriteVertexData(real *destination) const noexcept
+{
+	auto size = VertexDataSize();
+	auto count = particles ? std::min(particles->Count(), size / vertex_components) : 0;
+
+	if (count > 0)
+		get_particle_vertices(*particles, count, node_rotation, node_point_scaling, ModelMatrix(), Opacity(), destination);
+
+	//Particles has been removed since last reload
+	std::fill(destination + count * vertex_components, destination + size, 0.0_r);
+}
+
+
 /*
 	Events
 */
@@ -46,47 +65,75 @@ particle_emitter_primitive::particle_emitter_primitive(NonOwningPtr<materials::M
 }
 
 
-vertex_metrics get_vertex_metrics(const render::vertex::VertexDeclaration &vertex_declaration) noexcept
+void particle_emitter_primitive::Stream(const particles::ParticleStorage &particles, real node_rotation, real node_point_scaling) noexcept
 {
-	auto metrics = vertex_metrics{};
-
-	for (auto &element : vertex_declaration.Elements())
-	{
-		if (element.Name == shaders::shader_layout::AttributeName::Vertex_Rotation)
-			metrics.rotation_offset = element.Offset / static_cast<int>(sizeof(real));
-		else if (element.Name == shaders::shader_layout::AttributeName::Vertex_PointSize)
-			metrics.point_size_offset = element.Offset / static_cast<int>(sizeof(real));
-	}
+	this->particles = &particles;
+	this->node_rotation = node_rotation;
+	this->node_point_scaling = node_point_scaling;
 
-	return metrics;
+	StreamedVertexData(particles.Count() * vertex_components, get_particle_aabb(particles),
+		!particles.Empty() ? particles.PositionZ()[0] : 0.0_r);
 }
 
+
 /*
 	Rendering
 */
 
-void apply_node_rotation(const vertex_metrics &metrics, real node_rotation, render::render_primitive::VertexContainer &data) noexcept
+Aabb get_particle_aabb(const particles::ParticleStorage &particles) noexcept
 {
-	auto size = std::ssize(data);
-	auto stride = sizeof(particles::Particle);
+	if (particles.Empty())
+		return {};
+
+	auto count = particles.Count();
+	auto position_x = particles.PositionX();
+	auto position_y = particles.PositionY();
 
-	for (auto off = metrics.rotation_offset; off < size; off += stride)
-		data[off] += node_rotation;
+	auto [min_x, max_x] = std::minmax_element(position_x, position_x + count);
+	auto [min_y, max_y] = std::minmax_element(position_y, position_y + count);
+	return {{*min_x, *min_y}, {*max_x, *max_y}};
 }
 
-void apply_node_scaling(const vertex_metrics &metrics, const Vector2 &node_scaling, render::render_primitive::VertexContainer &data) noexcept
+void get_particle_vertices(const particles::ParticleStorage &particles, int count,
+	real node_rotation, real node_point_scaling, const Matrix4 &model_matrix, real opacity, real *destination) noexcept
 {
-	auto size = std::ssize(data);
-	auto stride = sizeof(particles::Particle);
-
-	for (auto off = metrics.point_size_offset; off < size; off += stride)
-		data[off] *= (node_scaling.X() + node_scaling.Y()) * 0.5_r; //Average
+	auto position_x = particles.PositionX();
+	auto position_y = particles.PositionY();
+	auto position_z = particles.PositionZ();
+	auto size_x = particles.SizeX();
+	auto color_r = particles.ColorR();
+	auto color_g = particles.ColorG();
+	auto color_b = particles.ColorB();
+	auto color_a = particles.ColorA();
+
+	auto transform = render::render_primitive::detail::get_affine_transform(model_matrix);
+	auto &m = transform.m;
+
+	for (auto i = 0; i < count; ++i, destination += vertex_components)
+	{
+		auto x = position_x[i];
+		auto y = position_y[i];
+		auto z = position_z[i];
+		destination[position_offset] = (m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3]) * transform.inv_w;
+		destination[position_offset + 1] = (m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3]) * transform.inv_w;
+		destination[position_offset + 2] = (m[2][0] * x + m[2][1] * y + m[2][2] * z + m[2][3]) * transform.inv_w;
+		destination[rotation_offset] = particles.Rotation(i) + node_rotation;
+		destination[point_size_offset] = size_x[i] * node_point_scaling;
+		destination[color_offset] = color_r[i];
+		destination[color_offset + 1] = color_g[i];
+		destination[color_offset + 2] = color_b[i];
+		destination[color_offset + 3] = color_a[i] * opacity;
+	}
 }
 
-
-void get_emitter_primitives(const particles::ParticleSystem &particle_system,  const vertex_metrics &metrics,
+void get_emitter_primitives(const particles::ParticleSystem &particle_system,
 	real node_rotation, const Vector2 &node_scaling, particle_emitter_primitives &emitter_primitives)
 {
+	auto node_point_scaling = (node_scaling.X() + node_scaling.Y()) * 0.5_r; //Average
+
+	for (auto &primitive : emitter_primitives)
+		primitive->particles = nullptr;
+
 	for (auto off = 0; auto &emitter : particle_system.Emitters())
 	{
 		if (!emitter.HasActiveParticles())
@@ -104,16 +151,7 @@ void get_emitter_primitives(const particles::ParticleSystem &particle_system,  c
 					return *emitter_primitives.emplace_back(make_owning<particle_emitter_primitive>(emitter.ParticleMaterial()));
 			}();
 
-		auto size = std::size(emitter.Particles()) * sizeof(particles::Particle);
-		primitive.vertex_data.resize(size / sizeof(real), 0.0_r);
-		std::memcpy(std::data(primitive.vertex_data), std::data(emitter.Particles()), size);
-
-		if (node_rotation != 0.0_r)
-			apply_node_rotation(metrics, node_rotation, primitive.vertex_data);
-
-		if (node_scaling != vector2::UnitScale)
-			apply_node_scaling(metrics, node_scaling, primitive.vertex_data);
-
+		primitive.Stream(emitter.Particles(), node_rotation, node_point_scaling);
 		++off;
 	}
 }
@@ -133,18 +171,17 @@ void DrawableParticleSystem::ReloadPrimitives()
 		auto node_rotation = parent_node ? parent_node->Rotation() : 0.0_r;
 		auto node_scaling = parent_node ? parent_node->Scaling() : vector2::UnitScale;
 
-		detail::get_emitter_primitives(*particle_system_, vertex_metrics_,
+		detail::get_emitter_primitives(*particle_system_,
 			node_rotation, node_scaling, emitter_primitives_);
 	}
 
 	std::erase_if(emitter_primitives_,
 		[&](auto &primitive) noexcept
 		{
-			if (!std::empty(primitive->vertex_data))
+			if (primitive->particles)
 			{
 				primitive->owner = this;
-				primitive->VertexData(std::move(primitive->vertex_data));
-				AddPrimitive(*primitive);		
+				AddPrimitive(*primitive);
 				return false; //Keep
 			}
 			else
@@ -161,7 +198,6 @@ DrawableParticleSystem::DrawableParticleSystem(std::optional<std::string> name,
 	particle_system_{particle_system ? std::make_optional(particle_system->Clone()) : std::nullopt},
 	initial_particle_system_{particle_system},
 
-	vertex_metrics_{detail::get_vertex_metrics(detail::get_vertex_declaration())},
 	reload_primitives_{!!particle_system_}
 {
 	query_type_flags_ |= query::scene_query::QueryType::ParticleSystem;
@@ -176,6 +212,9 @@ void DrawableParticleSystem::Revert()
 {
 	if (initial_particle_system_)
 	{
+		for (auto &primitive : emitter_primitives_)
+			primitive->particles = nullptr; //Stop streaming until reloaded
+
 		particle_system_ = initial_particle_system_->Clone();
 		reload_primitives_ = true;
 	}
@@ -211,6 +250,7 @@ void DrawableParticleSystem::Prepare()
 		sphere_ = {aabb_.ToHalfSize().Max(), aabb_.Center()};
 
 		update_bounding_volumes_ = false;
+		NotifyBoundingVolumesChanged();
 	}
 
 	DrawableObject::Prepare();
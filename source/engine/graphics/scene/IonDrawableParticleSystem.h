@@ -13,7 +13,6 @@ File:	IonDrawableParticleSystem.h
 #ifndef ION_MOVABLE_PARTICLE_SYSTEM_H
 #define ION_MOVABLE_PARTICLE_SYSTEM_H
 
-#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -24,6 +23,8 @@ File:	IonDrawableParticleSystem.h
 #include "graphics/render/vertex/IonVertexBatch.h"
 #include "graphics/render/vertex/IonVertexDeclaration.h"
 #include "graphics/shaders/IonShaderLayout.h"
+#include "graphics/utilities/IonAabb.h"
+#include "graphics/utilities/IonMatrix4.h"
 #include "graphics/utilities/IonVector2.h"
 #include "memory/IonNonOwningPtr.h"
 #include "memory/IonOwningPtr.h"
@@ -43,17 +44,27 @@ namespace ion::graphics::scene
 
 	namespace drawable_particle_system::detail
 	{
-		struct vertex_metrics final
-		{
-			int rotation_offset = 0;
-			int point_size_offset = 0;
-		};
+		//Interleaved vertex layout (in number of reals)
+		constexpr auto position_offset = 0; //x, y, z
+		constexpr auto rotation_offset = 3; //Radians
+		constexpr auto point_size_offset = 4;
+		constexpr auto color_offset = 5; //r, g, b, a
+		constexpr auto vertex_components = 9;
 
 
 		struct particle_emitter_primitive final : render::RenderPrimitive
 		{
 			protected:
 
+				/**
+					@name Streaming
+					@{
+				*/
+
+				void WriteVertexData(real *destination) const noexcept override;
+
+				///@}
+
 				/**
 					@name Events
 					@{
@@ -66,9 +77,14 @@ namespace ion::graphics::scene
 			public:
 
 				DrawableParticleSystem *owner = nullptr;
-				render::render_primitive::VertexContainer vertex_data;
+				const particles::ParticleStorage *particles = nullptr; //Streamed from
+				real node_rotation = 0.0_r;
+				real node_point_scaling = 1.0_r;
 
 				particle_emitter_primitive(NonOwningPtr<materials::Material> particle_material);
+
+				///@brief Streams the given particles directly into the parent renderer, with the given node rotation and point scaling
+				void Stream(const particles::ParticleStorage &particles, real node_rotation, real node_point_scaling) noexcept;
 		};
 
 		using particle_emitter_primitives = std::vector<OwningPtr<particle_emitter_primitive>>;
@@ -76,47 +92,45 @@ namespace ion::graphics::scene
 
 		inline auto get_vertex_declaration() noexcept
 		{
-			static const auto particle = particles::Particle{};
 			return
 				render::vertex::VertexDeclaration
 				{
 					{
 						{shaders::shader_layout::AttributeName::Vertex_Position,
 							render::vertex::vertex_declaration::VertexElementType::Float3,
-							reinterpret_cast<const std::byte*>(particle.Position().Components()) - reinterpret_cast<const std::byte*>(&particle),
-							sizeof(particles::Particle)},
+							position_offset * static_cast<int>(sizeof(real)), vertex_components * static_cast<int>(sizeof(real))},
 
 						{shaders::shader_layout::AttributeName::Vertex_Rotation,
 							render::vertex::vertex_declaration::VertexElementType::Float1,
-							reinterpret_cast<const std::byte*>(&particle.Rotation()) - reinterpret_cast<const std::byte*>(&particle),
-							sizeof(particles::Particle)},
+							rotation_offset * static_cast<int>(sizeof(real)), vertex_components * static_cast<int>(sizeof(real))},
 
 						{shaders::shader_layout::AttributeName::Vertex_PointSize,
 							render::vertex::vertex_declaration::VertexElementType::Float1,
-							reinterpret_cast<const std::byte*>(particle.Size().Components()) - reinterpret_cast<const std::byte*>(&particle),
-							sizeof(particles::Particle)},
+							point_size_offset * static_cast<int>(sizeof(real)), vertex_components * static_cast<int>(sizeof(real))},
 
 						{shaders::shader_layout::AttributeName::Vertex_Color,
 							render::vertex::vertex_declaration::VertexElementType::Float4,
-							reinterpret_cast<const std::byte*>(particle.FillColor().Channels()) - reinterpret_cast<const std::byte*>(&particle),
-							sizeof(particles::Particle)}
+							color_offset * static_cast<int>(sizeof(real)), vertex_components * static_cast<int>(sizeof(real))}
 					},
-					sizeof(particles::Particle)
+					vertex_components * static_cast<int>(sizeof(real))
 				};
 		}
 
-		vertex_metrics get_vertex_metrics(const render::vertex::VertexDeclaration &vertex_declaration) noexcept;
-
 
 		/**
 			@name Rendering
 			@{
 		*/
 
-		void apply_node_rotation(const vertex_metrics &metrics, real node_rotation, render::render_primitive::VertexContainer &data) noexcept;
-		void apply_node_scaling(const vertex_metrics &metrics, const Vector2 &node_scaling, render::render_primitive::VertexContainer &data) noexcept;
+		///@brief Returns the axis aligned bounding box of the given particles (in local space)
+		[[nodiscard]] Aabb get_particle_aabb(const particles::ParticleStorage &particles) noexcept;
 
-		void get_emitter_primitives(const particles::ParticleSystem &particle_system, const vertex_metrics &metrics,
+		///@brief Interleaves the given number of particles (stored as a structure of arrays) directly into the given destination
+		///@details Model matrix, node rotation, node scaling and opacity are applied in the same pass, so each vertex is written once
+		void get_particle_vertices(const particles::ParticleStorage &particles, int count,
+			real node_rotation, real node_point_scaling, const Matrix4 &model_matrix, real opacity, real *destination) noexcept;
+
+		void get_emitter_primitives(const particles::ParticleSystem &particle_system,
 			real node_rotation, const Vector2 &node_scaling, particle_emitter_primitives &emitter_primitives);
 
 		///@}
@@ -131,7 +145,6 @@ namespace ion::graphics::scene
 			std::optional<particles::ParticleSystem> particle_system_;
 			NonOwningPtr<particles::ParticleSystem> initial_particle_system_;
 
-			drawable_particle_system::detail::vertex_metrics vertex_metrics_;
 			drawable_particle_system::detail::particle_emitter_primitives emitter_primitives_;
 
 			bool reload_primitives_ = false;
@@ -166,6 +179,11 @@ namespace ion::graphics::scene
 			[[nodiscard]] auto& Get() noexcept
 			{
 				reload_primitives_ = true; //Particle system could be changed
+
+				//Stop streaming until reloaded
+				for (auto &primitive : emitter_primitives_)
+					primitive->particles = nullptr;
+
 				return particle_system_;
 			}
 
@@ -192,6 +210,12 @@ namespace ion::graphics::scene
 			///@details This function is typically called each frame
 			void Prepare() override;
 
+			///@brief Returns true if the bounding volumes of this particle system are going to change when prepared
+			[[nodiscard]] inline bool HasPendingBoundingVolumes() const noexcept override
+			{
+				return reload_primitives_ || update_bounding_volumes_;
+			}
+
 			///@}
 
 			/**
@@ -18,6 +18,7 @@ File:	IonDrawableText.cpp
 
 #include "IonEngine.h"
 #include "graphics/fonts/IonFont.h"
+#include "graphics/fonts/IonFontManager.h"
 #include "graphics/fonts/IonTypeFace.h"
 #include "graphics/fonts/utilities/IonFontUtility.h"
 #include "graphics/render/vertex/IonVertexBatch.h"
@@ -198,6 +199,28 @@ fonts::Font* get_default_font(const fonts::text::TextBlock &text_block, const fo
 		return nullptr;
 }
 
+bool use_fonts(const fonts::Text &text)
+{
+	auto reloaded = false;
+
+	if (auto type_face = text.Lettering(); type_face)
+	{
+		for (auto &font : {type_face->RegularFont(), type_face->BoldFont(), type_face->ItalicFont(), type_face->BoldItalicFont()})
+		{
+			if (font && font->Owner())
+			{
+				//Font has been evicted, load it back in
+				if (font->IsUnloaded() && font->Owner()->MaxResidentSize())
+					reloaded |= font->Owner()->Load(*font);
+
+				font->Owner()->Use(*font); //Keep font resident
+			}
+		}
+	}
+
+	return reloaded;
+}
+
 
 real get_glyph_horizontal_position(const std::optional<Vector2> &area_size, const Vector2 &padding,
 	fonts::text::TextAlignment horizontal_alignment, real line_width, const Vector3 &position) noexcept
@@ -733,6 +756,10 @@ void DrawableText::Revert()
 
 void DrawableText::Prepare()
 {
+	//Glyph handles has changed
+	if (text_ && detail::use_fonts(*text_))
+		reload_primitives_ = true;
+
 	if (reload_primitives_)
 	{
 		ReloadPrimitives();
@@ -763,6 +790,7 @@ void DrawableText::Prepare()
 		}
 
 		update_bounding_volumes_ = false;
+		NotifyBoundingVolumesChanged();
 	}
 
 	DrawableObject::Prepare();
@@ -151,6 +151,7 @@ namespace ion::graphics::scene
 
 		fonts::Font* get_default_font(const fonts::Text &text) noexcept;
 		fonts::Font* get_default_font(const fonts::text::TextBlock &text_block, const fonts::Text &text) noexcept;
+		bool use_fonts(const fonts::Text &text);
 		
 		real get_glyph_horizontal_position(const std::optional<Vector2> &area_size, const Vector2 &padding,
 			fonts::text::TextAlignment horizontal_alignment, real line_width, const Vector3 &position) noexcept;
@@ -294,6 +295,12 @@ namespace ion::graphics::scene
 			///@details This function is typically called each frame
 			void Prepare() override;
 
+			///@brief Returns true if the bounding volumes of this text are going to change when prepared
+			[[nodiscard]] inline bool HasPendingBoundingVolumes() const noexcept override
+			{
+				return reload_primitives_ || update_bounding_volumes_;
+			}
+
 			///@}
 	};
 } //ion::graphics::scene
@@ -262,6 +262,7 @@ void Light::PrepareBoundingVolumes() noexcept
 
 	obb_ = aabb_;
 	sphere_ = {aabb_.ToHalfSize().Max(), aabb_.Center()};
+	NotifyBoundingVolumesChanged();
 }
 
 
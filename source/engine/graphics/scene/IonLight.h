@@ -428,6 +428,12 @@ namespace ion::graphics::scene
 			///@details This function is typically called each frame
 			void Prepare() override;
 
+			///@brief Returns true if the bounding volumes of this light are going to change when prepared
+			[[nodiscard]] inline bool HasPendingBoundingVolumes() const noexcept override
+			{
+				return update_bounding_volumes_;
+			}
+
 			///@}
 	};
 } //ion::graphics::scene
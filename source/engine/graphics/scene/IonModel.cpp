@@ -197,6 +197,7 @@ void Model::Prepare()
 		sphere_ = {aabb_.ToHalfSize().Max(), aabb_.Center()};
 
 		update_bounding_volumes_ = false;
+		NotifyBoundingVolumesChanged();
 	}
 
 	if (update_emissive_lights_)
@@ -217,6 +218,21 @@ void Model::Prepare()
 	DrawableObject::Prepare();
 }
 
+bool Model::HasPendingBoundingVolumes() const noexcept
+{
+	if (update_bounding_volumes_)
+		return true;
+
+	//Mesh vertices are generated when prepared
+	for (auto &mesh : Meshes())
+	{
+		if (mesh.HasPendingVertices())
+			return true;
+	}
+
+	return false;
+}
+
 
 /*
 	Elapse time
@@ -156,6 +156,10 @@ namespace ion::graphics::scene
 			///@details This function is typically called each frame
 			void Prepare() override;
 
+			///@brief Returns true if the bounding volumes of this model are going to change when prepared
+			///@details Returns true if one or more meshes have pending vertices
+			[[nodiscard]] bool HasPendingBoundingVolumes() const noexcept override;
+
 			///@}
 
 			/**
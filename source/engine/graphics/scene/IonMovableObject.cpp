@@ -182,6 +182,9 @@ void MovableObject::Detach() noexcept
 
 void MovableObject::AttachedToNode()
 {
+	if (auto scene_manager = Owner(); scene_manager)
+		scene_manager->ObjectIndex(false).Insert(*this);
+
 	if (auto renderer = ParentRenderer(); renderer && AttachedToSceneGraph())
 	{
 		for (auto &primitive : AllRenderPrimitives())
@@ -196,6 +199,9 @@ void MovableObject::DetachedFromNode() noexcept
 		for (auto &primitive : AllRenderPrimitives())
 			renderer->RemovePrimitive(*primitive);
 	}
+
+	if (auto scene_manager = Owner(); scene_manager)
+		scene_manager->ObjectIndex(false).Remove(*this);
 }
 
 
@@ -251,6 +257,17 @@ LightRange MovableObject::AllEmissiveLights() noexcept
 }
 
 
+/*
+	Notifying
+*/
+
+void MovableObject::NotifyBoundingVolumesChanged() noexcept
+{
+	if (auto scene_manager = Owner(); scene_manager)
+		scene_manager->ObjectIndex(false).Invalidate(*this);
+}
+
+
 /*
 	Rendering
 */
@@ -260,6 +277,12 @@ void MovableObject::Prepare()
 	//Optional to override
 }
 
+bool MovableObject::HasPendingBoundingVolumes() const noexcept
+{
+	//Optional to override
+	return false;
+}
+
 
 /*
 	Drawing
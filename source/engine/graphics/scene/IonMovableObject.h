@@ -199,6 +199,7 @@ namespace ion::graphics::scene
 			inline void BoundingVolumeExtent(const Aabb &extent) noexcept
 			{
 				bounding_volume_extent_ = extent;
+				NotifyBoundingVolumesChanged();
 			}
 
 			///@brief Sets the preferred bounding volume for this movable object to the given type
@@ -206,6 +207,7 @@ namespace ion::graphics::scene
 			inline void PreferredBoundingVolume(movable_object::PreferredBoundingVolumeType type) noexcept
 			{
 				preferred_bounding_volume_ = type;
+				NotifyBoundingVolumesChanged();
 			}
 
 
@@ -482,6 +484,17 @@ namespace ion::graphics::scene
 
 			///@}
 
+			/**
+				@name Notifying
+				@{
+			*/
+
+			///@brief Called when the local or world bounding volumes of this movable object has changed
+			///@details Marks this object as changed in the spatial index of the owning scene manager
+			void NotifyBoundingVolumesChanged() noexcept;
+
+			///@}
+
 			/**
 				@name Preparing
 				@{
@@ -491,6 +504,10 @@ namespace ion::graphics::scene
 			///@details This function is typically called each frame
 			virtual void Prepare();
 
+			///@brief Returns true if the bounding volumes of this movable object are going to change when prepared
+			///@details Objects outside of view are only prepared (for culling) if their bounding volumes are pending
+			[[nodiscard]] virtual bool HasPendingBoundingVolumes() const noexcept;
+
 			///@}
 
 			/**
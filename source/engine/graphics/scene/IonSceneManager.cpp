@@ -33,6 +33,18 @@ SceneManager::SceneManager(std::optional<std::string> name) noexcept :
 	//Empty
 }
 
+SceneManager::~SceneManager() noexcept
+{
+	//Destroy all objects while the spatial index is still alive
+	CameraBase::Tidy();
+	LightBase::Tidy();
+	ModelBase::Tidy();
+	ParticleSystemBase::Tidy();
+	TextBase::Tidy();
+	SoundBase::Tidy();
+	SoundListenerBase::Tidy();
+}
+
 
 /*
 	Default shader program - Adding
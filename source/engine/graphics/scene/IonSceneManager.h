@@ -24,6 +24,7 @@ File:	IonSceneManager.h
 #include "IonModel.h"
 #include "IonMovableSound.h"
 #include "IonMovableSoundListener.h"
+#include "IonSpatialIndex.h"
 #include "adaptors/ranges/IonIterable.h"
 #include "events/IonListenable.h"
 #include "events/listeners/IonCameraListener.h"
@@ -105,6 +106,7 @@ namespace ion::graphics::scene
 
 
 			scene_manager::detail::default_shader_programs default_shader_programs_;
+			SpatialIndex spatial_index_;
 
 		public:
 
@@ -114,11 +116,12 @@ namespace ion::graphics::scene
 			///@brief Deleted copy constructor
 			SceneManager(const SceneManager&) = delete;
 
-			///@brief Default move constructor
-			SceneManager(SceneManager&&) = default;
+			///@brief Deleted move constructor
+			///@details The spatial index refers to objects (and their owner) by address
+			SceneManager(SceneManager&&) = delete;
 
 			///@brief Destructor
-			~SceneManager() = default;
+			~SceneManager() noexcept;
 
 
 			/**
@@ -129,8 +132,8 @@ namespace ion::graphics::scene
 			///@brief Deleted copy assignment
 			SceneManager& operator=(const SceneManager&) = delete;
 
-			///@brief Default move assignment
-			SceneManager& operator=(SceneManager&&) = default;
+			///@brief Deleted move assignment
+			SceneManager& operator=(SceneManager&&) = delete;
 
 			///@}
 
@@ -296,6 +299,30 @@ namespace ion::graphics::scene
 
 			///@}
 
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns a mutable reference to the spatial index of all objects attached to a scene node
+			///@details The index is refreshed first, so all changed objects has up-to-date bounds
+			[[nodiscard]] inline auto& ObjectIndex(bool refresh = true)
+			{
+				if (refresh)
+					spatial_index_.Refresh();
+
+				return spatial_index_;
+			}
+
+			///@brief Returns an immutable reference to the spatial index of all objects attached to a scene node
+			///@details Changed objects may have out-of-date bounds until the index is refreshed
+			[[nodiscard]] inline auto& ObjectIndex() const noexcept
+			{
+				return spatial_index_;
+			}
+
+			///@}
+
 			/**
 				@name Default shader program - Adding
 				@{
@@ -0,0 +1,439 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/scene
+File:	IonSpatialIndex.cpp
+-------------------------------------------
+*/
+
+#include "IonSpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "IonMovableObject.h"
+
+namespace ion::graphics::scene
+{
+
+using namespace spatial_index;
+
+namespace spatial_index::detail
+{
+
+Aabb fatten(const Aabb &aabb) noexcept
+{
+	auto [width, height] = aabb.ToSize().XY();
+	auto margin = std::max(width, height) * fat_margin_factor;
+	return {aabb.Min() - margin, aabb.Max() + margin};
+}
+
+bool ray_overlaps(const Ray &ray, const Aabb &aabb) noexcept
+{
+	//Slab test (inclusive)
+	auto t_min = 0.0_r;
+	auto t_max = std::numeric_limits<real>::max();
+
+	for (auto axis = 0; axis < 2; ++axis)
+	{
+		auto origin = axis == 0 ? ray.Origin().X() : ray.Origin().Y();
+		auto direction = axis == 0 ? ray.Direction().X() : ray.Direction().Y();
+		auto min = axis == 0 ? aabb.Min().X() : aabb.Min().Y();
+		auto max = axis == 0 ? aabb.Max().X() : aabb.Max().Y();
+
+		if (direction == 0.0_r)
+		{
+			if (origin < min || origin > max)
+				return false;
+		}
+		else
+		{
+			auto t1 = (min - origin) / direction;
+			auto t2 = (max - origin) / direction;
+
+			if (t1 > t2)
+				std::swap(t1, t2);
+
+			t_min = std::max(t_min, t1);
+			t_max = std::min(t_max, t2);
+
+			if (t_min > t_max)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+Aabb indexed_bounds(const MovableObject &object) noexcept
+{
+	//Enclose both with and without extent applied (queries vs. culling)
+	auto aabb = merge(object.WorldAxisAlignedBoundingBox(), object.WorldAxisAlignedBoundingBox(true, false));
+
+	if (object.PreferredBoundingVolume() == movable_object::PreferredBoundingVolumeType::BoundingSphere)
+	{
+		auto &sphere = object.WorldBoundingSphere();
+		aabb = merge(aabb, Aabb::HalfSize({sphere.Radius(), sphere.Radius()}, sphere.Center()));
+	}
+
+	return aabb;
+}
+
+} //spatial_index::detail
+
+
+//Private
+
+/*
+	Tree
+*/
+
+int SpatialIndex::AllocateNode()
+{
+	if (free_list_ == detail::null_node)
+	{
+		nodes_.emplace_back();
+		return static_cast<int>(std::size(nodes_)) - 1;
+	}
+	else
+	{
+		auto index = free_list_;
+		free_list_ = nodes_[index].parent; //Free list is linked through parent
+		nodes_[index] = {};
+		return index;
+	}
+}
+
+void SpatialIndex::FreeNode(int index) noexcept
+{
+	nodes_[index] = {};
+	nodes_[index].parent = free_list_;
+	nodes_[index].height = -1;
+	free_list_ = index;
+}
+
+
+void SpatialIndex::InsertLeaf(int leaf)
+{
+	nodes_[leaf].linked = true;
+
+	if (root_ == detail::null_node)
+	{
+		root_ = leaf;
+		nodes_[root_].parent = detail::null_node;
+		return;
+	}
+
+	//Find the best sibling (surface area heuristic, based on perimeter in 2D)
+	auto leaf_aabb = nodes_[leaf].aabb;
+	auto index = root_;
+
+	while (!nodes_[index].IsLeaf())
+	{
+		auto left = nodes_[index].left;
+		auto right = nodes_[index].right;
+
+		auto perimeter = detail::perimeter(nodes_[index].aabb);
+		auto combined_perimeter = detail::perimeter(detail::merge(nodes_[index].aabb, leaf_aabb));
+
+		//Cost of creating a new parent for this node and the new leaf
+		auto cost = 2.0_r * combined_perimeter;
+		//Minimum cost of pushing the leaf further down the tree
+		auto inheritance_cost = 2.0_r * (combined_perimeter - perimeter);
+
+		auto child_cost =
+			[&](int child) noexcept
+			{
+				auto merged_perimeter = detail::perimeter(detail::merge(leaf_aabb, nodes_[child].aabb));
+				return nodes_[child].IsLeaf() ?
+					merged_perimeter + inheritance_cost :
+					merged_perimeter - detail::perimeter(nodes_[child].aabb) + inheritance_cost;
+			};
+
+		auto left_cost = child_cost(left);
+		auto right_cost = child_cost(right);
+
+		if (cost < left_cost && cost < right_cost)
+			break;
+
+		index = left_cost < right_cost ? left : right;
+	}
+
+	//Create a new parent
+	auto sibling = index;
+	auto old_parent = nodes_[sibling].parent;
+	auto new_parent = AllocateNode();
+
+	nodes_[new_parent].parent = old_parent;
+	nodes_[new_parent].aabb = detail::merge(leaf_aabb, nodes_[sibling].aabb);
+	nodes_[new_parent].height = nodes_[sibling].height + 1;
+	nodes_[new_parent].left = sibling;
+	nodes_[new_parent].right = leaf;
+	nodes_[sibling].parent = new_parent;
+	nodes_[leaf].parent = new_parent;
+
+	if (old_parent != detail::null_node)
+	{
+		if (nodes_[old_parent].left == sibling)
+			nodes_[old_parent].left = new_parent;
+		else
+			nodes_[old_parent].right = new_parent;
+	}
+	else
+		root_ = new_parent;
+
+	Refit(nodes_[leaf].parent);
+}
+
+void SpatialIndex::RemoveLeaf(int leaf)
+{
+	nodes_[leaf].linked = false;
+
+	if (leaf == root_)
+	{
+		root_ = detail::null_node;
+		return;
+	}
+
+	auto parent = nodes_[leaf].parent;
+	auto grand_parent = nodes_[parent].parent;
+	auto sibling = nodes_[parent].left == leaf ? nodes_[parent].right : nodes_[parent].left;
+
+	if (grand_parent != detail::null_node)
+	{
+		//Replace parent with sibling
+		if (nodes_[grand_parent].left == parent)
+			nodes_[grand_parent].left = sibling;
+		else
+			nodes_[grand_parent].right = sibling;
+
+		nodes_[sibling].parent = grand_parent;
+		FreeNode(parent);
+		Refit(grand_parent);
+	}
+	else
+	{
+		root_ = sibling;
+		nodes_[sibling].parent = detail::null_node;
+		FreeNode(parent);
+	}
+
+	nodes_[leaf].parent = detail::null_node;
+}
+
+int SpatialIndex::Balance(int index) noexcept
+{
+	auto &node = nodes_[index];
+
+	if (node.IsLeaf() || node.height < 2)
+		return index;
+
+	auto left = node.left;
+	auto right = node.right;
+	auto balance = nodes_[right].height - nodes_[left].height;
+
+	//Rotate the taller child up
+	auto rotate =
+		[&](int up, int down) noexcept
+		{
+			auto up_left = nodes_[up].left;
+			auto up_right = nodes_[up].right;
+
+			//Swap index and up
+			nodes_[up].left = index;
+			nodes_[up].parent = nodes_[index].parent;
+			nodes_[index].parent = up;
+
+			if (auto parent = nodes_[up].parent; parent != detail::null_node)
+			{
+				if (nodes_[parent].left == index)
+					nodes_[parent].left = up;
+				else
+					nodes_[parent].right = up;
+			}
+			else
+				root_ = up;
+
+			//Keep the taller grandchild under up
+			auto [keep, give] = nodes_[up_left].height > nodes_[up_right].height ?
+				std::pair{up_left, up_right} : std::pair{up_right, up_left};
+
+			nodes_[up].right = keep;
+
+			if (nodes_[index].left == up)
+				nodes_[index].left = give;
+			else
+				nodes_[index].right = give;
+
+			nodes_[give].parent = index;
+
+			nodes_[index].aabb = detail::merge(nodes_[down].aabb, nodes_[give].aabb);
+			nodes_[up].aabb = detail::merge(nodes_[index].aabb, nodes_[keep].aabb);
+
+			nodes_[index].height = 1 + std::max(nodes_[down].height, nodes_[give].height);
+			nodes_[up].height = 1 + std::max(nodes_[index].height, nodes_[keep].height);
+
+			return up;
+		};
+
+	if (balance > 1)
+		return rotate(right, left);
+	else if (balance < -1)
+		return rotate(left, right);
+	else
+		return index;
+}
+
+void SpatialIndex::Refit(int index) noexcept
+{
+	//Walk back up the tree fixing heights and bounds
+	while (index != detail::null_node)
+	{
+		index = Balance(index);
+
+		auto &node = nodes_[index];
+		node.height = 1 + std::max(nodes_[node.left].height, nodes_[node.right].height);
+		node.aabb = detail::merge(nodes_[node.left].aabb, nodes_[node.right].aabb);
+
+		index = node.parent;
+	}
+}
+
+
+//Public
+
+/*
+	Indexing
+*/
+
+bool SpatialIndex::Insert(MovableObject &object)
+{
+	if (Contains(object))
+		return false;
+
+	auto leaf = AllocateNode();
+	nodes_[leaf].object = &object;
+	nodes_[leaf].dirty = true;
+
+	proxies_.emplace(&object, leaf);
+	dirty_proxies_.push_back(leaf);
+	++object_count_;
+	return true;
+}
+
+bool SpatialIndex::Remove(MovableObject &object) noexcept
+{
+	if (auto iter = proxies_.find(&object); iter != std::end(proxies_))
+	{
+		auto leaf = iter->second;
+		proxies_.erase(iter);
+
+		if (nodes_[leaf].dirty)
+			dirty_proxies_.erase(
+				std::remove(std::begin(dirty_proxies_), std::end(dirty_proxies_), leaf),
+				std::end(dirty_proxies_));
+
+		if (nodes_[leaf].linked)
+			RemoveLeaf(leaf);
+
+		FreeNode(leaf);
+		--object_count_;
+		return true;
+	}
+	else
+		return false;
+}
+
+void SpatialIndex::Invalidate(MovableObject &object) noexcept
+{
+	if (auto iter = proxies_.find(&object); iter != std::end(proxies_))
+	{
+		if (auto &node = nodes_[iter->second]; !node.dirty)
+		{
+			node.dirty = true;
+			dirty_proxies_.push_back(iter->second);
+		}
+	}
+}
+
+void SpatialIndex::Refresh()
+{
+	for (auto leaf : dirty_proxies_)
+	{
+		auto &node = nodes_[leaf];
+		node.dirty = false;
+
+		auto aabb = detail::indexed_bounds(*node.object);
+
+		//Still inside fat aabb, nothing to restructure
+		if (node.linked && detail::contains(node.aabb, aabb))
+			continue;
+
+		if (node.linked)
+			RemoveLeaf(leaf);
+
+		nodes_[leaf].aabb = detail::fatten(aabb);
+		InsertLeaf(leaf);
+	}
+
+	dirty_proxies_.clear();
+}
+
+void SpatialIndex::Clear() noexcept
+{
+	nodes_.clear();
+	proxies_.clear();
+	dirty_proxies_.clear();
+
+	root_ = detail::null_node;
+	free_list_ = detail::null_node;
+	object_count_ = 0;
+}
+
+
+/*
+	Querying
+*/
+
+MovableObjects SpatialIndex::Query(const Aabb &region) const
+{
+	MovableObjects objects;
+	Query(region,
+		[&](MovableObject &object)
+		{
+			objects.push_back(&object);
+		});
+	return objects;
+}
+
+MovableObjects SpatialIndex::Query(const Ray &ray) const
+{
+	MovableObjects objects;
+	Query(ray,
+		[&](MovableObject &object)
+		{
+			objects.push_back(&object);
+		});
+	return objects;
+}
+
+MovableObjects SpatialIndex::AllObjects() const
+{
+	MovableObjects objects;
+	objects.reserve(object_count_);
+
+	for (auto &node : nodes_)
+	{
+		if (node.object)
+			objects.push_back(node.object);
+	}
+
+	return objects;
+}
+
+} //ion::graphics::scene
\ No newline at end of file
@@ -0,0 +1,294 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	graphics/scene
+File:	IonSpatialIndex.h
+-------------------------------------------
+*/
+
+#ifndef ION_SPATIAL_INDEX_H
+#define ION_SPATIAL_INDEX_H
+
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "graphics/utilities/IonAabb.h"
+#include "graphics/utilities/IonRay.h"
+#include "types/IonTypes.h"
+
+namespace ion::graphics::scene
+{
+	class MovableObject; //Forward declaration
+
+	using namespace types::type_literals;
+	using namespace graphics::utilities;
+
+	namespace spatial_index
+	{
+		using MovableObjects = std::vector<MovableObject*>;
+
+
+		namespace detail
+		{
+			constexpr auto null_node = -1;
+			constexpr auto fat_margin_factor = 0.1_r; //10% of the largest extent on each side
+
+
+			struct tree_node final
+			{
+				Aabb aabb; //Fat aabb for leaves
+				MovableObject *object = nullptr; //Leaves only
+
+				int parent = null_node;
+				int left = null_node;
+				int right = null_node;
+				int height = 0; //Leaves has height 0, -1 if free
+
+				bool linked = false; //Leaves only, true if linked into the tree
+				bool dirty = false; //Leaves only
+
+				[[nodiscard]] inline auto IsLeaf() const noexcept
+				{
+					return left == null_node;
+				}
+			};
+
+			using tree_nodes = std::vector<tree_node>;
+			using proxy_map = std::unordered_map<const MovableObject*, int>;
+
+
+			inline auto merge(const Aabb &aabb, const Aabb &aabb2) noexcept
+			{
+				//Does not ignore empty (zero sized) aabbs, unlike Aabb::Merge
+				return Aabb{aabb.Min().FloorCopy(aabb2.Min()), aabb.Max().CeilCopy(aabb2.Max())};
+			}
+
+			inline auto perimeter(const Aabb &aabb) noexcept
+			{
+				return aabb::detail::minmax_to_perimeter(aabb.Min(), aabb.Max());
+			}
+
+			inline auto contains(const Aabb &outer, const Aabb &inner) noexcept
+			{
+				return outer.Min().X() <= inner.Min().X() && outer.Min().Y() <= inner.Min().Y() &&
+					   outer.Max().X() >= inner.Max().X() && outer.Max().Y() >= inner.Max().Y();
+			}
+
+			inline auto overlaps(const Aabb &aabb, const Aabb &aabb2) noexcept
+			{
+				return aabb.Max().X() >= aabb2.Min().X() && aabb.Max().Y() >= aabb2.Min().Y() &&
+					   aabb.Min().X() <= aabb2.Max().X() && aabb.Min().Y() <= aabb2.Max().Y();
+			}
+
+			Aabb fatten(const Aabb &aabb) noexcept;
+			bool ray_overlaps(const Ray &ray, const Aabb &aabb) noexcept;
+
+			///@brief Returns the bounds used when indexing the given object
+			///@details Encloses the world AABB (with and without extent), and the world bounding sphere if that is the preferred bounding volume
+			Aabb indexed_bounds(const MovableObject &object) noexcept;
+		} //detail
+	} //spatial_index
+
+
+	///@brief A class representing a dynamic AABB tree of movable objects
+	///@details Objects are stored in the leaves with a fat AABB, so small movements does not require restructuring the tree.
+	///Changed objects are marked dirty and only reinserted on refresh, if the new bounds are not contained in the fat AABB.
+	///The index is maintained by a scene manager, and can be used for region queries, ray queries and camera culling
+	class SpatialIndex final
+	{
+		private:
+
+			spatial_index::detail::tree_nodes nodes_;
+			spatial_index::detail::proxy_map proxies_;
+			std::vector<int> dirty_proxies_;
+
+			int root_ = spatial_index::detail::null_node;
+			int free_list_ = spatial_index::detail::null_node;
+			int object_count_ = 0;
+
+
+			/**
+				@name Tree
+				@{
+			*/
+
+			int AllocateNode();
+			void FreeNode(int index) noexcept;
+
+			void InsertLeaf(int leaf);
+			void RemoveLeaf(int leaf);
+			int Balance(int index) noexcept;
+			void Refit(int index) noexcept;
+
+			///@}
+
+		public:
+
+			///@brief Default constructor
+			SpatialIndex() = default;
+
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns true if the object with the given address is indexed
+			///@details The given pointer is never dereferenced, and may point to an object that no longer exists
+			[[nodiscard]] inline auto Contains(const MovableObject *object) const noexcept
+			{
+				return proxies_.find(object) != std::end(proxies_);
+			}
+
+			///@brief Returns true if the given object is indexed
+			[[nodiscard]] inline auto Contains(const MovableObject &object) const noexcept
+			{
+				return Contains(&object);
+			}
+
+			///@brief Returns the number of indexed objects
+			[[nodiscard]] inline auto ObjectCount() const noexcept
+			{
+				return object_count_;
+			}
+
+			///@brief Returns the number of indexed objects waiting to be refreshed
+			[[nodiscard]] inline auto DirtyCount() const noexcept
+			{
+				return static_cast<int>(std::size(dirty_proxies_));
+			}
+
+			///@brief Returns the height of the tree
+			[[nodiscard]] inline auto Height() const noexcept
+			{
+				return root_ != spatial_index::detail::null_node ? nodes_[root_].height : 0;
+			}
+
+			///@brief Returns the (fat) bounds of all indexed objects
+			[[nodiscard]] inline auto Bounds() const noexcept
+			{
+				return root_ != spatial_index::detail::null_node ? nodes_[root_].aabb : Aabb{};
+			}
+
+			///@}
+
+			/**
+				@name Indexing
+				@{
+			*/
+
+			///@brief Adds the given object to this index
+			///@details The object is linked into the tree on next refresh
+			bool Insert(MovableObject &object);
+
+			///@brief Removes the given object from this index
+			bool Remove(MovableObject &object) noexcept;
+
+			///@brief Marks the given object as changed
+			///@details The bounds of the object is updated on next refresh
+			void Invalidate(MovableObject &object) noexcept;
+
+			///@brief Updates the bounds of all changed objects
+			///@details Only objects that has moved outside of their fat AABB are reinserted into the tree
+			void Refresh();
+
+			///@brief Removes all objects from this index
+			void Clear() noexcept;
+
+			///@}
+
+			/**
+				@name Querying
+				@{
+			*/
+
+			///@brief Calls the given function for each indexed object with (fat) bounds overlapping the given region
+			template <typename Function>
+			void Query(const Aabb &region, Function &&function) const
+			{
+				static_assert(std::is_invocable_v<Function, MovableObject&>);
+
+				if (root_ == spatial_index::detail::null_node)
+					return;
+
+				std::vector<int> stack;
+				stack.push_back(root_);
+
+				while (!std::empty(stack))
+				{
+					auto &node = nodes_[stack.back()];
+					stack.pop_back();
+
+					if (!spatial_index::detail::overlaps(node.aabb, region))
+						continue;
+
+					if (node.IsLeaf())
+						function(*node.object);
+					else
+					{
+						stack.push_back(node.left);
+						stack.push_back(node.right);
+					}
+				}
+			}
+
+			///@brief Calls the given function for each indexed object with (fat) bounds intersected by the given ray
+			template <typename Function>
+			void Query(const Ray &ray, Function &&function) const
+			{
+				static_assert(std::is_invocable_v<Function, MovableObject&>);
+
+				if (root_ == spatial_index::detail::null_node)
+					return;
+
+				std::vector<int> stack;
+				stack.push_back(root_);
+
+				while (!std::empty(stack))
+				{
+					auto &node = nodes_[stack.back()];
+					stack.pop_back();
+
+					if (!spatial_index::detail::ray_overlaps(ray, node.aabb))
+						continue;
+
+					if (node.IsLeaf())
+						function(*node.object);
+					else
+					{
+						stack.push_back(node.left);
+						stack.push_back(node.right);
+					}
+				}
+			}
+
+			///@brief Calls the given function for each indexed object waiting to be refreshed
+			///@details Objects are waiting to be refreshed when inserted, or when their bounds may have changed
+			template <typename Function>
+			void DirtyObjects(Function &&function) const
+			{
+				static_assert(std::is_invocable_v<Function, MovableObject&>);
+
+				for (auto leaf : dirty_proxies_)
+					function(*nodes_[leaf].object);
+			}
+
+			///@brief Returns all indexed objects with (fat) bounds overlapping the given region
+			[[nodiscard]] spatial_index::MovableObjects Query(const Aabb &region) const;
+
+			///@brief Returns all indexed objects with (fat) bounds intersected by the given ray
+			[[nodiscard]] spatial_index::MovableObjects Query(const Ray &ray) const;
+
+			///@brief Returns all indexed objects
+			[[nodiscard]] spatial_index::MovableObjects AllObjects() const;
+
+			///@}
+	};
+} //ion::graphics::scene
+
+#endif
\ No newline at end of file
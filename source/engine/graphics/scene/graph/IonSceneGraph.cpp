@@ -363,6 +363,23 @@ void pop_gl_matrix() noexcept
 	glPopMatrix();
 }
 
+
+/*
+	Culling
+*/
+
+bool is_in_view(const MovableObject &object, const Aabb &camera_aabb) noexcept
+{
+	return object.AxisAlignedBoundingBox().Empty() || //Cull based on actual geometry
+		   object.WorldAxisAlignedBoundingBox(true, false).Intersects(camera_aabb);
+}
+
+void hide_object(MovableObject &object) noexcept
+{
+	for (auto &primitive : object.AllRenderPrimitives())
+		primitive->WorldVisible(false);
+}
+
 } //scene_graph::detail
 
 
@@ -394,6 +411,42 @@ void SceneGraph::NotifyNodeRenderEnded(SceneNode &node) noexcept
 }
 
 
+/*
+	Culling
+*/
+
+bool SceneGraph::IsIndexed(const MovableObject *object) const noexcept
+{
+	//Object may no longer exist, do not dereference
+	for (auto &scene_manager : SceneManagers())
+	{
+		if (scene_manager.ObjectIndex().Contains(object))
+			return true;
+	}
+
+	return false;
+}
+
+void SceneGraph::AddVisibleObject(MovableObject &object, const Aabb &camera_aabb)
+{
+	visible_objects_.push_back(&object);
+
+	if (lighting_enabled_)
+	{
+		//For each emissive light
+		for (auto &light : object.AllEmissiveLights())
+		{
+			//Emissive light visible and in view
+			if (light->Visible() &&
+				(light->WorldAxisAlignedBoundingBox(true, false).Empty() || //Derive, emissive lights are not pre-cached!
+				 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera_aabb)))
+
+				emissive_lights_.push_back(light);
+		}
+	}
+}
+
+
 //Public
 
 SceneGraph::SceneGraph(std::optional<std::string> name, bool enabled) noexcept :
@@ -455,69 +508,157 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 	/*
 		Scene nodes
 	*/
+
+	auto &camera_aabb = camera->WorldAxisAlignedBoundingBox(false, false);
 	
 	visible_objects_.clear();
+	prepared_objects_.clear();
 	emissive_lights_.clear();
 
+	std::swap(in_view_objects_, last_in_view_objects_);
+	in_view_objects_.clear();
+
 	//For each node
+	//Node animations and node render events does not depend on the view, attached objects are not visited
 	for (auto &node : root_node_.OrderedSceneNodes())
 	{
 		if (!paused_)
 			node.Elapse(time);
 
-		//The node render started/ended events can be called without any attached objects
-		//The visibility of the node is also used as a flag to enable/disable event notifications
-		auto node_visible = node.Visible();
-
-		if (node_visible)
+		//The visibility of the node is used as a flag to enable/disable event notifications
+		if (node.Visible())
+		{
 			NotifyNodeRenderStarted(node);
+			NotifyNodeRenderEnded(node);
+		}
+	}
+
 
-		//For each attached object
-		for (auto &object : node.GetAttachedObjects())
+	/*
+		Objects
+	*/
+
+	auto is_rendered =
+		[&](const MovableObject &object) noexcept
 		{
-			auto object_visible = node_visible && object->Visible();
+			//Object and node needs to be visible, and attached to this scene graph
+			auto parent_node = object.ParentNode();
+			return parent_node && parent_node->Visible() && object.Visible() &&
+				&parent_node->RootNode() == &root_node_;
+		};
+
+	auto elapse_and_prepare =
+		[&](MovableObject &object)
+		{
+			if (!paused_)
+				object.Elapse(time);
+
+			object.Prepare();
+			prepared_objects_.push_back(&object);
+		};
 
-			//Elapse and prepare object
-			if (object_visible)
+	candidate_objects_.clear();
+
+	for (auto &scene_manager : SceneManagers())
+	{
+		//Particle systems and sounds are simulated even when outside view
+		//Particle systems are also prepared, so that their bounds can grow into view
+		for (auto &particle_system : scene_manager.ParticleSystems())
+			candidate_objects_.push_back(&particle_system);
+		for (auto &sound : scene_manager.Sounds())
+			candidate_objects_.push_back(&sound);
+		for (auto &sound_listener : scene_manager.SoundListeners())
+			candidate_objects_.push_back(&sound_listener);
+
+		//Objects that are new, moved or changed since last refresh, may have bounds that are about to change
+		//Prepare them now, so that the index is up-to-date before culling
+		scene_manager.ObjectIndex(false).DirtyObjects(
+			[&](MovableObject &object)
 			{
-				if (!paused_)
-					object->Elapse(time);
+				if (object.HasPendingBoundingVolumes() || object.AxisAlignedBoundingBox().Empty())
+					candidate_objects_.push_back(&object);
+			});
+	}
 
-				object->Prepare();
-			}
+	//Only distinct (sorted)
+	std::sort(std::begin(candidate_objects_), std::end(candidate_objects_));
+	candidate_objects_.erase(
+		std::unique(std::begin(candidate_objects_), std::end(candidate_objects_)),
+		std::end(candidate_objects_));
 
-			//Object visible and in view
-			if (object_visible &&
-				(object->WorldAxisAlignedBoundingBox(true, false).Empty() || //Cull based on actual geometry
-				 object->WorldAxisAlignedBoundingBox(false, false).Intersects(camera->WorldAxisAlignedBoundingBox(false, false))))
-			{	
-				visible_objects_.push_back(object);
-
-				if (lighting_enabled_)
-				{
-					//For each emissive light
-					for (auto &light : object->AllEmissiveLights())
-					{
-						//Emissive light visible and in view
-						if (light->Visible() &&
-							(light->WorldAxisAlignedBoundingBox(true, false).Empty() || //Derive, emissive lights are not pre-cached!
-							 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera->WorldAxisAlignedBoundingBox(false, false))))
-
-							emissive_lights_.push_back(light);
-					}
-				}
-			}
-			else //Not visible or not in view
+	for (auto &object : candidate_objects_)
+	{
+		if (is_rendered(*object))
+			elapse_and_prepare(*object);
+	}
+
+
+	/*
+		Culling
+	*/
+
+	candidate_objects_.clear();
+	auto indexed_object_count = 0;
+
+	//Indexed objects are culled hierarchically, by querying the spatial index of each scene manager
+	//Whole off-screen branches are skipped in one test, and only candidates are visited
+	for (auto &scene_manager : SceneManagers())
+	{
+		scene_manager.ObjectIndex().Query(camera_aabb,
+			[&](MovableObject &object)
 			{
-				for (auto &primitive : object->AllRenderPrimitives())
-					primitive->WorldVisible(false); //Not visible or outside view
-			}
+				candidate_objects_.push_back(&object);
+			});
+
+		indexed_object_count += scene_manager.ObjectIndex(false).ObjectCount();
+	}
+
+	//For each candidate (distinct)
+	for (auto &object : candidate_objects_)
+	{
+		if (!is_rendered(*object))
+			continue;
+
+		//Not already elapsed and prepared (above)
+		if (!std::binary_search(std::begin(prepared_objects_), std::end(prepared_objects_), object))
+		{
+			if (!paused_)
+				object->Elapse(time);
+
+			object->Prepare();
 		}
 
-		if (node_visible)
-			NotifyNodeRenderEnded(node);
+		//Object in view
+		if (detail::is_in_view(*object, camera_aabb))
+			AddVisibleObject(*object, camera_aabb);
 	}
 
+	in_view_objects_ = visible_objects_;
+	std::sort(std::begin(in_view_objects_), std::end(in_view_objects_));
+
+	auto in_view =
+		[&](MovableObject *object) noexcept
+		{
+			return std::binary_search(std::begin(in_view_objects_), std::end(in_view_objects_), object);
+		};
+
+	//Hide objects that were in view last time, but not anymore (not visible or outside view)
+	//Objects that have been removed since, are no longer indexed
+	for (auto &object : last_in_view_objects_)
+	{
+		if (!in_view(object) && IsIndexed(object))
+			detail::hide_object(*object);
+	}
+
+	//Hide objects prepared outside of view
+	for (auto &object : prepared_objects_)
+	{
+		if (!in_view(object))
+			detail::hide_object(*object);
+	}
+
+	culled_object_count_ = indexed_object_count - static_cast<int>(std::size(visible_objects_));
+
 
 	/*
 		Lights
@@ -532,8 +673,8 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 		{
 			//Light visible and in view
 			if (light->Visible() && light->ParentNode()->Visible() &&
-				(light->WorldAxisAlignedBoundingBox(false, false).Empty() ||
-				 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera->WorldAxisAlignedBoundingBox(false, false))))
+				(light->WorldAxisAlignedBoundingBox(true, false).Empty() || //Derive, lights outside view are not prepared
+				 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera_aabb)))
 
 				lights_.push_back(light);
 		}
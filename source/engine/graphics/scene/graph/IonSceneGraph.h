@@ -107,6 +107,16 @@ namespace ion::graphics::scene::graph
 			void pop_gl_matrix() noexcept;
 
 			///@}
+
+			/**
+				@name Culling
+				@{
+			*/
+
+			bool is_in_view(const MovableObject &object, const Aabb &camera_aabb) noexcept;
+			void hide_object(MovableObject &object) noexcept;
+
+			///@}
 		} //detail
 	} //scene_graph
 
@@ -140,6 +150,11 @@ namespace ion::graphics::scene::graph
 			scene_graph::detail::light_pointers emissive_lights_;
 
 			scene_graph::detail::movable_object_pointers visible_objects_;
+			scene_graph::detail::movable_object_pointers candidate_objects_;
+			scene_graph::detail::movable_object_pointers prepared_objects_; //Sorted
+			scene_graph::detail::movable_object_pointers in_view_objects_; //Sorted
+			scene_graph::detail::movable_object_pointers last_in_view_objects_; //Objects in view last time this scene was rendered (sorted)
+			int culled_object_count_ = 0;
 			scene_graph::detail::shader_program_pointers shader_programs_;
 				//Keep these as members so we don't have to reallocate storage for each render call
 
@@ -163,6 +178,16 @@ namespace ion::graphics::scene::graph
 
 			///@}
 
+			/**
+				@name Culling
+				@{
+			*/
+
+			bool IsIndexed(const MovableObject *object) const noexcept;
+			void AddVisibleObject(MovableObject &object, const Aabb &camera_aabb);
+
+			///@}
+
 		public:
 
 			///@brief Constructs a scene graph with the given name and whether or not is should be enabled
@@ -409,6 +434,19 @@ namespace ion::graphics::scene::graph
 				return emissive_light_texture_ ? emissive_light_texture_->handle : std::nullopt;
 			}
 
+
+			///@brief Returns the number of objects that was visible and in view, the last time this scene was rendered
+			[[nodiscard]] inline auto VisibleObjectCount() const noexcept
+			{
+				return static_cast<int>(std::size(visible_objects_));
+			}
+
+			///@brief Returns the number of indexed objects that was culled (not visible or outside view), the last time this scene was rendered
+			[[nodiscard]] inline auto CulledObjectCount() const noexcept
+			{
+				return culled_object_count_;
+			}
+
 			///@}
 
 			/**
@@ -417,7 +455,9 @@ namespace ion::graphics::scene::graph
 			*/
 
 			///@brief Renders this entire scene graph to the given viewport
-			///@details This is called once from the engine, with the time in seconds since last frame
+			///@details This is called once from the engine, with the time in seconds since last frame.
+			///Objects are culled using the spatial index of each scene manager, so only objects created by a scene manager in this scene graph are rendered.
+			///Objects outside of view are not elapsed, except for particle systems and sounds
 			void Render(render::Viewport &viewport, duration time) noexcept;
 
 			///@}
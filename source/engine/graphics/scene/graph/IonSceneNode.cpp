@@ -174,6 +174,14 @@ void SceneNode::NotifyUpdate() noexcept
 {
 	need_update_ = true;
 
+	//World bounding volumes of attached objects are out of date
+	for (auto &object : attached_objects_)
+		std::visit(
+			[&](auto &&object) noexcept
+			{
+				object->NotifyBoundingVolumesChanged();
+			}, object);
+
 	for (auto &child_node : child_nodes_)
 		child_node->NotifyUpdate(); //Recursive
 }
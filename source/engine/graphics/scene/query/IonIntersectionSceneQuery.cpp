@@ -12,6 +12,12 @@ File:	IonIntersectionSceneQuery.cpp
 
 #include "IonIntersectionSceneQuery.h"
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+#include "graphics/scene/IonSceneManager.h"
+
 namespace ion::graphics::scene::query
 {
 
@@ -21,6 +27,165 @@ using namespace types::type_literals;
 namespace intersection_scene_query::detail
 {
 
+/*
+	Broadphase
+*/
+
+Aabb world_bounds(const scene_query::detail::query_object &object) noexcept
+{
+	switch (object.first->PreferredBoundingVolume())
+	{
+		case movable_object::PreferredBoundingVolumeType::BoundingSphere:
+		{
+			auto &sphere = object.first->WorldBoundingSphere(false);
+			return Aabb::HalfSize({sphere.Radius(), sphere.Radius()}, sphere.Center());
+		}
+
+		case movable_object::PreferredBoundingVolumeType::BoundingBox:
+		default:
+		return object.first->WorldAxisAlignedBoundingBox(false);
+	}
+}
+
+std::vector<Aabb> world_bounds(const scene_query::detail::query_objects &objects)
+{
+	std::vector<Aabb> bounds;
+	bounds.reserve(std::size(objects));
+
+	for (auto &object : objects)
+		bounds.push_back(world_bounds(object));
+
+	return bounds;
+}
+
+
+candidate_pairs sort_and_sweep(const std::vector<Aabb> &bounds)
+{
+	auto count = static_cast<int>(std::size(bounds));
+	std::vector<int> order(count);
+
+	for (auto i = 0; i < count; ++i)
+		order[i] = i;
+
+	//Sort on min x
+	std::sort(std::begin(order), std::end(order),
+		[&](auto a, auto b) noexcept
+		{
+			return bounds[a].Min().X() < bounds[b].Min().X();
+		});
+
+	candidate_pairs pairs;
+
+	//Sweep along x
+	for (auto i = 0; i < count; ++i)
+	{
+		auto &aabb = bounds[order[i]];
+
+		for (auto j = i + 1; j < count && bounds[order[j]].Min().X() <= aabb.Max().X(); ++j)
+		{
+			//Overlapping on y
+			if (auto &aabb2 = bounds[order[j]];
+				aabb.Max().Y() >= aabb2.Min().Y() && aabb.Min().Y() <= aabb2.Max().Y())
+				pairs.emplace_back(std::min(order[i], order[j]), std::max(order[i], order[j]));
+		}
+	}
+
+	return pairs;
+}
+
+candidate_pairs uniform_grid(const std::vector<Aabb> &bounds, std::optional<real> cell_size)
+{
+	auto count = static_cast<int>(std::size(bounds));
+	candidate_pairs pairs;
+
+	if (count < 2)
+		return pairs;
+
+	//Derive cell size from the average object size
+	if (!cell_size || *cell_size <= 0.0_r)
+	{
+		auto total = 0.0_r;
+
+		for (auto &aabb : bounds)
+		{
+			auto [width, height] = aabb.ToSize().XY();
+			total += std::max(width, height);
+		}
+
+		cell_size = total > 0.0_r ? total / count : 1.0_r;
+	}
+
+	auto to_cell =
+		[inv_cell_size = 1.0_r / *cell_size](real x) noexcept
+		{
+			return static_cast<int64>(std::floor(x * inv_cell_size));
+		};
+	auto to_key =
+		[](int64 x, int64 y) noexcept
+		{
+			return (x << 32) ^ (y & 0xFFFFFFFF);
+		};
+
+	std::unordered_map<int64, std::vector<int>> cells;
+	std::vector<int> oversized_objects;
+
+	for (auto i = 0; i < count; ++i)
+	{
+		auto &aabb = bounds[i];
+		auto [min_x, min_y] = std::pair{to_cell(aabb.Min().X()), to_cell(aabb.Min().Y())};
+		auto [max_x, max_y] = std::pair{to_cell(aabb.Max().X()), to_cell(aabb.Max().Y())};
+
+		//Object spans too many cells, test against all other objects instead
+		if ((max_x - min_x + 1) * (max_y - min_y + 1) > max_grid_cells_per_object)
+		{
+			oversized_objects.push_back(i);
+			continue;
+		}
+
+		for (auto x = min_x; x <= max_x; ++x)
+		{
+			for (auto y = min_y; y <= max_y; ++y)
+				cells[to_key(x, y)].push_back(i);
+		}
+	}
+
+	for (auto &[key, indices] : cells)
+	{
+		for (auto iter = std::begin(indices), end = std::end(indices); iter != end; ++iter)
+		{
+			for (auto iter2 = iter + 1; iter2 != end; ++iter2)
+			{
+				auto &aabb = bounds[*iter];
+				auto &aabb2 = bounds[*iter2];
+
+				//Only report the pair from the cell containing the min corner of the overlap
+				if (aabb.Intersects(aabb2) &&
+					to_key(to_cell(std::max(aabb.Min().X(), aabb2.Min().X())),
+						to_cell(std::max(aabb.Min().Y(), aabb2.Min().Y()))) == key)
+					pairs.emplace_back(*iter, *iter2); //Inserted in ascending order
+			}
+		}
+	}
+
+	for (auto iter = std::begin(oversized_objects), end = std::end(oversized_objects); iter != end; ++iter)
+	{
+		for (auto i = 0; i < count; ++i)
+		{
+			//Oversized pairs are only reported once (from the lowest index)
+			if (i != *iter && bounds[*iter].Intersects(bounds[i]) &&
+				!(i < *iter && std::binary_search(std::begin(oversized_objects), iter, i)))
+				pairs.emplace_back(std::min(*iter, i), std::max(*iter, i));
+		}
+	}
+
+	return pairs;
+}
+
+
+/*
+	Narrowphase
+*/
+
 bool sphere_sphere_hit(const scene_query::detail::query_object &sphere_object, const scene_query::detail::query_object &sphere_object2) noexcept
 {
 	//Sphere vs Sphere
@@ -64,69 +229,76 @@ bool sphere_box_hit(const scene_query::detail::query_object &sphere_object, scen
 }
 
 
-ResultType intersects(scene_query::detail::query_objects &objects) noexcept
+bool hit(scene_query::detail::query_object &object, scene_query::detail::query_object &object2) noexcept
+{
+	switch (object.first->PreferredBoundingVolume())
+	{
+		case movable_object::PreferredBoundingVolumeType::BoundingSphere:
+		{
+			switch (object2.first->PreferredBoundingVolume())
+			{
+				case movable_object::PreferredBoundingVolumeType::BoundingSphere:
+				return sphere_sphere_hit(object, object2);
+
+				case movable_object::PreferredBoundingVolumeType::BoundingBox:
+				default:
+				return sphere_box_hit(object, object2);
+			}
+		}
+
+		case movable_object::PreferredBoundingVolumeType::BoundingBox:
+		default:
+		{
+			switch (object2.first->PreferredBoundingVolume())
+			{
+				case movable_object::PreferredBoundingVolumeType::BoundingSphere:
+				return sphere_box_hit(object2, object); //Flipped
+
+				case movable_object::PreferredBoundingVolumeType::BoundingBox:
+				default:
+				return box_box_hit(object, object2);
+			}
+		}
+	}
+}
+
+
+ResultType intersects(scene_query::detail::query_objects &objects,
+	BroadphaseType broadphase, std::optional<real> grid_cell_size) noexcept
 {
 	ResultType result;
 
-	for (auto iter = std::begin(objects), end = std::end(objects); iter != end; ++iter)
-	{
-		for (auto iter2 = iter + 1; iter2 != end; ++iter2)
+	auto test_pair =
+		[&](auto &object, auto &object2) noexcept
 		{
-			if (iter->first->QueryFlags().value_or(~0_ui32) &
-				iter2->first->QueryMask().value_or(~0_ui32))
+			if (object.first->QueryFlags().value_or(~0_ui32) &
+				object2.first->QueryMask().value_or(~0_ui32))
 			{
-				switch (iter->first->PreferredBoundingVolume())
-				{
-					case movable_object::PreferredBoundingVolumeType::BoundingSphere:
-					{
-						switch (iter2->first->PreferredBoundingVolume())
-						{
-							case movable_object::PreferredBoundingVolumeType::BoundingSphere:
-							{
-								if (sphere_sphere_hit(*iter, *iter2))
-									result.emplace_back(iter->first, iter2->first);
-								break;
-							}
-
-							case movable_object::PreferredBoundingVolumeType::BoundingBox:
-							default:
-							{
-								if (sphere_box_hit(*iter, *iter2))
-									result.emplace_back(iter->first, iter2->first);
-								break;
-							}
-						}
-
-						break;
-					}
-
-					case movable_object::PreferredBoundingVolumeType::BoundingBox:
-					default:
-					{
-						switch (iter2->first->PreferredBoundingVolume())
-						{
-							case movable_object::PreferredBoundingVolumeType::BoundingSphere:
-							{
-								if (sphere_box_hit(*iter2, *iter)) //Flipped
-									result.emplace_back(iter->first, iter2->first);
-								break;
-							}
-
-							case movable_object::PreferredBoundingVolumeType::BoundingBox:
-							default:
-							{
-								if (box_box_hit(*iter, *iter2))
-									result.emplace_back(iter->first, iter2->first);
-								break;
-							}
-						}
-
-						break;
-					}
-				}
+				if (hit(object, object2))
+					result.emplace_back(object.first, object2.first);
 			}
+		};
+
+	if (broadphase == BroadphaseType::AllPairs)
+	{
+		for (auto iter = std::begin(objects), end = std::end(objects); iter != end; ++iter)
+		{
+			for (auto iter2 = iter + 1; iter2 != end; ++iter2)
+				test_pair(*iter, *iter2);
 		}
 	}
+	else
+	{
+		auto pairs = broadphase == BroadphaseType::UniformGrid ?
+			uniform_grid(world_bounds(objects), grid_cell_size) :
+			sort_and_sweep(world_bounds(objects));
+
+		//Keep the same (deterministic) order as testing all pairs
+		std::sort(std::begin(pairs), std::end(pairs));
+
+		for (auto [i, j] : pairs)
+			test_pair(objects[i], objects[j]);
+	}
 
 	return result;
 }
@@ -147,7 +319,7 @@ ResultType IntersectionSceneQuery::Execute(scene_query::detail::query_objects &o
 	if (query_region_)
 		scene_query::detail::remove_objects_outside_region(objects, *query_region_);
 
-	return detail::intersects(objects);
+	return detail::intersects(objects, broadphase_, grid_cell_size_);
 }
 
 //Public
@@ -174,4 +346,14 @@ ResultType IntersectionSceneQuery::Execute(scene_query::MovableObjects &movable_
 	return Execute(objects);
 }
 
+ResultType IntersectionSceneQuery::Execute(SceneManager &scene_manager) const noexcept
+{
+	auto &index = scene_manager.ObjectIndex();
+	auto movable_objects = query_region_ ?
+		index.Query(*query_region_) : //Only objects overlapping region
+		index.AllObjects();
+
+	return Execute(movable_objects);
+}
+
 } //ion::graphics::scene::query
\ No newline at end of file
@@ -13,10 +13,12 @@ File:	IonIntersectionSceneQuery.h
 #ifndef ION_INTERSECTION_SCENE_QUERY_H
 #define ION_INTERSECTION_SCENE_QUERY_H
 
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "IonSceneQuery.h"
+#include "graphics/utilities/IonAabb.h"
 #include "memory/IonNonOwningPtr.h"
 #include "types/IonTypes.h"
 
@@ -28,29 +30,71 @@ namespace ion::graphics::scene::query
 	{
 		using ResultType = std::vector<std::pair<MovableObject*, MovableObject*>>;
 
+		enum class BroadphaseType
+		{
+			AllPairs,
+			SortAndSweep,
+			UniformGrid
+		};
+
+
 		namespace detail
 		{
+			using candidate_pair = std::pair<int, int>;
+			using candidate_pairs = std::vector<candidate_pair>;
+
+			constexpr auto max_grid_cells_per_object = 64;
+
+
 			inline auto derive_once(bool &derive) noexcept
 			{
 				auto temp = derive;
 				return derive = false, temp;
 			}
 
+
+			/**
+				@name Broadphase
+				@{
+			*/
+
+			Aabb world_bounds(const scene_query::detail::query_object &object) noexcept;
+			std::vector<Aabb> world_bounds(const scene_query::detail::query_objects &objects);
+
+			candidate_pairs sort_and_sweep(const std::vector<Aabb> &bounds);
+			candidate_pairs uniform_grid(const std::vector<Aabb> &bounds, std::optional<real> cell_size);
+
+			///@}
+
+			/**
+				@name Narrowphase
+				@{
+			*/
+
 			bool sphere_sphere_hit(const scene_query::detail::query_object &sphere_object, const scene_query::detail::query_object &sphere_object2) noexcept;
 			bool box_box_hit(scene_query::detail::query_object &box_object, scene_query::detail::query_object &box_object2) noexcept;
 			bool sphere_box_hit(const scene_query::detail::query_object &sphere_object, scene_query::detail::query_object &box_object) noexcept;
+			bool hit(scene_query::detail::query_object &object, scene_query::detail::query_object &object2) noexcept;
 
-			ResultType intersects(scene_query::detail::query_objects &objects) noexcept;
+			///@}
+
+			ResultType intersects(scene_query::detail::query_objects &objects,
+				BroadphaseType broadphase = BroadphaseType::SortAndSweep, std::optional<real> grid_cell_size = {}) noexcept;
 		} //detail
 	} //intersection_scene_query
 
 
 	///@brief A class representing an intersection scene query that queries object in a scene or inside a specific region
 	///@details Queries objects only if a bitwise AND operation between the query mask and the object query flags is non-zero.
-	///Unique pairs of intersected objects are returned in the result type
+	///Unique pairs of intersected objects are returned in the result type.
+	///A broadphase produces candidate pairs from the world AABBs before the bounding volumes are tested
 	class IntersectionSceneQuery final : public SceneQuery<intersection_scene_query::ResultType>
 	{
 		private:
+
+			intersection_scene_query::BroadphaseType broadphase_ = intersection_scene_query::BroadphaseType::SortAndSweep;
+			std::optional<real> grid_cell_size_;
+
 			
 			/**
 				@name Querying
@@ -66,6 +110,47 @@ namespace ion::graphics::scene::query
 			///@brief Default constructor
 			IntersectionSceneQuery() = default;
 
+
+			/**
+				@name Modifiers
+				@{
+			*/
+
+			///@brief Sets the broadphase this intersection scene query is using to find candidate pairs
+			inline void Broadphase(intersection_scene_query::BroadphaseType broadphase) noexcept
+			{
+				broadphase_ = broadphase;
+			}
+
+			///@brief Sets the cell size of the uniform grid broadphase
+			///@details Pass nullopt to derive a cell size from the average size of the queried objects
+			inline void GridCellSize(std::optional<real> cell_size) noexcept
+			{
+				grid_cell_size_ = cell_size;
+			}
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the broadphase this intersection scene query is using to find candidate pairs
+			[[nodiscard]] inline auto Broadphase() const noexcept
+			{
+				return broadphase_;
+			}
+
+			///@brief Returns the cell size of the uniform grid broadphase
+			///@details Returns nullopt if the cell size is derived from the average size of the queried objects
+			[[nodiscard]] inline auto GridCellSize() const noexcept
+			{
+				return grid_cell_size_;
+			}
+
+			///@}
+
 			
 			/**
 				@name Querying
@@ -78,6 +163,9 @@ namespace ion::graphics::scene::query
 			///@brief Returns the result of the intersection scene query amongst the given movable objects
 			[[nodiscard]] intersection_scene_query::ResultType Execute(scene_query::MovableObjects &movable_objects) const noexcept override;
 
+			///@brief Returns the result of the intersection scene query amongst the objects indexed by the given scene manager
+			[[nodiscard]] intersection_scene_query::ResultType Execute(SceneManager &scene_manager) const noexcept override;
+
 			///@}
 	};
 } //ion::graphics::scene::query
@@ -14,6 +14,8 @@ File:	IonRaySceneQuery.cpp
 
 #include <algorithm>
 
+#include "graphics/scene/IonSceneManager.h"
+
 namespace ion::graphics::scene::query
 {
 
@@ -23,7 +25,7 @@ using namespace types::type_literals;
 namespace ray_scene_query::detail
 {
 
-ResultType intersects(scene_query::detail::query_objects &objects, const Ray &ray, uint32 ray_flags) noexcept
+ResultType intersects(scene_query::detail::query_objects &objects, const Ray &ray, uint32 ray_flags)
 {
 	ResultType result;
 
@@ -122,4 +124,11 @@ ResultType RaySceneQuery::Execute(scene_query::MovableObjects &movable_objects)
 	return Execute(objects);
 }
 
+ResultType RaySceneQuery::Execute(SceneManager &scene_manager) const noexcept
+{
+	//Only objects intersected by ray
+	auto movable_objects = scene_manager.ObjectIndex().Query(ray_);
+	return Execute(movable_objects);
+}
+
 } //ion::graphics::scene::query
\ No newline at end of file
@@ -32,7 +32,7 @@ namespace ion::graphics::scene::query
 
 		namespace detail
 		{
-			ResultType intersects(scene_query::detail::query_objects &objects, const Ray &ray, uint32 ray_flags) noexcept;
+			ResultType intersects(scene_query::detail::query_objects &objects, const Ray &ray, uint32 ray_flags);
 		} //detail
 	} //ray_scene_query
 
@@ -127,6 +127,9 @@ namespace ion::graphics::scene::query
 			///@brief Returns the result of the ray scene query amongst the given movable objects
 			[[nodiscard]] ray_scene_query::ResultType Execute(scene_query::MovableObjects &movable_objects) const noexcept override;
 
+			///@brief Returns the result of the ray scene query amongst the objects indexed by the given scene manager
+			[[nodiscard]] ray_scene_query::ResultType Execute(SceneManager &scene_manager) const noexcept override;
+
 			///@}
 	};
 } //ion::graphics::scene::query
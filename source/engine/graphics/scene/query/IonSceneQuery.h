@@ -298,6 +298,10 @@ namespace ion::graphics::scene::query
 			///@brief Returns the result of the scene query amongst the given movable objects
 			[[nodiscard]] virtual ResultT Execute(scene_query::MovableObjects &movable_objects) const noexcept = 0;
 
+			///@brief Returns the result of the scene query amongst the objects indexed by the given scene manager
+			///@details Uses the spatial index of the scene manager to only visit objects that can be part of the result
+			[[nodiscard]] virtual ResultT Execute(SceneManager &scene_manager) const noexcept = 0;
+
 			///@}
 	};
 } //ion::graphics::scene::query
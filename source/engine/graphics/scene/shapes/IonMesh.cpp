@@ -90,7 +90,7 @@ void generate_tex_coords(render_primitive::VertexContainer &vertex_data, const A
 	}
 }
 
-void normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const materials::Material *material) noexcept
+std::pair<Vector2, Vector2> normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const materials::Material *material) noexcept
 {
 	if (auto [s_repeatable, t_repeatable] = material ?
 		material->IsRepeatable() : std::pair{false, false}; !s_repeatable || !t_repeatable)
@@ -139,6 +139,45 @@ void normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const
 		vertex_data[i] = s;
 		vertex_data[i + 1] = t;
 	}
+
+	return {world_lower_left_tex_coord, world_upper_right_tex_coord};
+}
+
+void denormalize_tex_coords(render_primitive::VertexContainer &vertex_data, const std::pair<Vector2, Vector2> &world_tex_coords) noexcept
+{
+	auto &[world_lower_left_tex_coord, world_upper_right_tex_coord] = world_tex_coords;
+	auto [world_lower_left, world_upper_right] =
+		materials::material::detail::get_unflipped_tex_coords(world_lower_left_tex_coord, world_upper_right_tex_coord);
+
+	if (world_lower_left.X() == world_upper_right.X() ||
+		world_lower_left.Y() == world_upper_right.Y())
+		return; //Cannot be restored
+
+	auto [mid_s, mid_t] = world_lower_left.Midpoint(world_upper_right).XY();
+	auto flip_s = materials::material::detail::is_flipped_horizontally(world_lower_left_tex_coord, world_upper_right_tex_coord);
+	auto flip_t = materials::material::detail::is_flipped_vertically(world_lower_left_tex_coord, world_upper_right_tex_coord);
+
+	//Restore each vertex tex coords (s,t) to range [0, 1]
+	for (auto i = detail::tex_coord_offset; i < std::ssize(vertex_data);
+		i += detail::vertex_components)
+	{
+		auto s = vertex_data[i];
+		auto t = vertex_data[i + 1];
+
+		if (flip_s)
+			s = 2.0_r * mid_s - s; //Reflect s back across middle point
+		if (flip_t)
+			t = 2.0_r * mid_t - t; //Reflect t back across middle point
+
+		auto tex_coord =
+			materials::material::detail::get_normalized_tex_coord(
+				{s, t},
+				world_lower_left, world_upper_right,
+				vector2::Zero, vector2::UnitScale);
+
+		vertex_data[i] = tex_coord.X();
+		vertex_data[i + 1] = tex_coord.Y();
+	}
 }
 
 } //detail
@@ -154,6 +193,7 @@ void normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const
 void Mesh::VertexDataChanged() noexcept
 {
 	update_tex_coords_ = true;
+	world_tex_coords_.reset(); //New tex coords are not normalized
 
 	if (auto owner = Owner(); owner)
 		owner->NotifyVertexDataChanged(*this);
@@ -250,16 +290,28 @@ Mesh::Mesh(std::optional<std::string> name, vertex::vertex_batch::VertexDrawMode
 
 void Mesh::Prepare()
 {
+	//Check if the tex coords of the material has changed externally
+	//The texture has been loaded, packed into a texture page or reloaded (into another page region)
+	if (!update_tex_coords_ && world_tex_coords_ && RenderMaterial())
+		update_tex_coords_ = RenderMaterial()->WorldTexCoords() != *world_tex_coords_;
+
 	if (update_tex_coords_)
 	{
 		//Auto generate tex coords
 		if (tex_coord_mode_ == mesh::MeshTexCoordMode::Auto)
 			detail::generate_tex_coords(VertexData(), AxisAlignedBoundingBox());
 
+		//Restore tex coords normalized to previous material tex coords
+		else if (world_tex_coords_)
+			detail::denormalize_tex_coords(VertexData(), *world_tex_coords_);
+
 		//Normalize tex coords
 		if (tex_coord_mode_ == mesh::MeshTexCoordMode::Manual || RenderMaterial())
-			detail::normalize_tex_coords(VertexData(), RenderMaterial().get());
+			world_tex_coords_ = detail::normalize_tex_coords(VertexData(), RenderMaterial().get());
+		else
+			world_tex_coords_.reset();
 
+		VertexDataModified();
 		update_tex_coords_ = false;
 	}
 
@@ -15,6 +15,7 @@ File:	IonMesh.h
 
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "graphics/render/IonRenderPrimitive.h"
@@ -22,6 +23,7 @@ File:	IonMesh.h
 #include "graphics/render/vertex/IonVertexDeclaration.h"
 #include "graphics/shaders/IonShaderLayout.h"
 #include "graphics/utilities/IonColor.h"
+#include "graphics/utilities/IonVector2.h"
 #include "graphics/utilities/IonVector3.h"
 #include "managed/IonManagedObject.h"
 #include "memory/IonNonOwningPtr.h"
@@ -121,7 +123,8 @@ namespace ion::graphics::scene::shapes
 			render_primitive::VertexContainer vertices_to_vertex_data(const Vertices &vertices);
 
 			void generate_tex_coords(render_primitive::VertexContainer &vertex_data, const Aabb &aabb) noexcept;
-			void normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const materials::Material *material) noexcept;
+			std::pair<Vector2, Vector2> normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const materials::Material *material) noexcept;
+			void denormalize_tex_coords(render_primitive::VertexContainer &vertex_data, const std::pair<Vector2, Vector2> &world_tex_coords) noexcept;
 		} //detail
 	} //mesh
 
@@ -137,6 +140,7 @@ namespace ion::graphics::scene::shapes
 			mesh::MeshTexCoordMode tex_coord_mode_ = mesh::MeshTexCoordMode::Auto;
 			bool include_bounding_volumes_ = true;
 			bool update_tex_coords_ = true;
+			std::optional<std::pair<Vector2, Vector2>> world_tex_coords_; //Tex coords are normalized to these (material) tex coords
 
 		protected:
 
@@ -255,6 +259,12 @@ namespace ion::graphics::scene::shapes
 			///@details This function is typically called each frame
 			virtual void Prepare() override;
 
+			///@brief Returns true if new vertices are going to be generated for this mesh when prepared
+			[[nodiscard]] virtual bool HasPendingVertices() const noexcept
+			{
+				return false;
+			}
+
 			///@}
 
 			/**
@@ -151,6 +151,12 @@ namespace ion::graphics::scene::shapes
 			///@details This function is typically called each frame
 			virtual void Prepare() override;
 
+			///@brief Returns true if new vertices are going to be generated for this shape when prepared
+			[[nodiscard]] inline bool HasPendingVertices() const noexcept override
+			{
+				return update_vertices_;
+			}
+
 			///@}
 	};
 } //ion::graphics::scene::shapes
@@ -912,6 +912,8 @@ bool ShaderProgramManager::UnloadResource(ShaderProgram &shader_program) noexcep
 
 void ShaderProgramManager::Created(ShaderProgram &shader_program) noexcept
 {
+	ResourceManager::Created(shader_program);
+
 	//No user defined shader layout
 	if (!shader_program.Layout())
 		shader_program.Layout(GetShaderLayout("")); //Use default shader layout
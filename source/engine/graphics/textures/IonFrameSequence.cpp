@@ -79,6 +79,16 @@ container_type get_frames_from_first_frame(NonOwningPtr<Texture> first_frame, in
 	return frames;
 }
 
+void exclude_from_texture_packing(const container_type &frames) noexcept
+{
+	//Each frame is drawn with the same tex coords
+	for (auto &frame : frames)
+	{
+		if (frame)
+			frame->Packable(false);
+	}
+}
+
 } //frame_sequence::detail
 
 
@@ -89,7 +99,7 @@ FrameSequence::FrameSequence(std::string name, detail::container_type frames) no
 	managed::ManagedObject<FrameSequenceManager>{std::move(name)},
 	frames_{std::move(frames)}
 {
-	//Empty
+	detail::exclude_from_texture_packing(frames_);
 }
 
 FrameSequence::FrameSequence(std::string name, NonOwningPtr<Texture> first_frame, int total_frames)  :
@@ -97,7 +107,7 @@ FrameSequence::FrameSequence(std::string name, NonOwningPtr<Texture> first_frame
 	managed::ManagedObject<FrameSequenceManager>{std::move(name)},
 	frames_{first_frame && total_frames > 0 ? detail::get_frames_from_first_frame(first_frame, total_frames) : decltype(frames_){}}
 {
-	//Empty
+	detail::exclude_from_texture_packing(frames_);
 }
 
 } //ion::graphics::textures
\ No newline at end of file
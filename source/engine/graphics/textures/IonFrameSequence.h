@@ -29,6 +29,7 @@ namespace ion::graphics::textures
 		using container_type = std::vector<NonOwningPtr<Texture>>;
 
 		container_type get_frames_from_first_frame(NonOwningPtr<Texture> first_frame, int total_frames);
+		void exclude_from_texture_packing(const container_type &frames) noexcept;
 	} //frame_sequence::detail
 
 
@@ -125,13 +125,36 @@ Texture::Texture(std::string name, std::string asset_name, const TextureAtlasReg
 }
 
 
+/*
+	Modifiers
+*/
+
+void Texture::Packable(bool packable) noexcept
+{
+	if (packable_ != packable)
+	{
+		packable_ = packable;
+
+		//Already packed, reload texture (lazily) into its own texture
+		if (!packable_ && page_region_)
+		{
+			if (auto owner = Owner(); owner)
+				owner->Reload(*this, resources::resource_manager::EvaluationStrategy::Lazy);
+		}
+	}
+}
+
+
 /*
 	Texture coordinates
 */
 
 std::optional<std::pair<Vector2, Vector2>> Texture::TexCoords() const noexcept
 {
-	if (extents_)
+	//Texture is packed into a texture page
+	if (page_region_)
+		return std::pair{page_region_->LowerLeft, page_region_->UpperRight};
+	else if (extents_)
 	{
 		auto [left, top, right, bottom] =
 			texture_manager::detail::padding(extents_->Width, extents_->Height, extents_->ActualWidth, extents_->ActualHeight);
@@ -90,6 +90,7 @@ namespace ion::graphics::textures
 			int Width = 0, Height = 0;
 			int ActualWidth = 0, ActualHeight = 0;
 			int BitDepth = 0;
+			int MipLevels = 1; //Number of levels in the pixel data (including base level)
 		};
 
 		struct TextureAtlasRegion final
@@ -98,6 +99,13 @@ namespace ion::graphics::textures
 			std::pair<int, int> Position; //Row and column
 		};
 
+		struct TexturePageRegion final
+		{
+			TextureHandle Page;
+			Vector2 LowerLeft, UpperRight; //Tex coords inside of the texture page
+			std::pair<int, int> Position, Size; //Allocated area inside of the texture page (in pixels)
+		};
+
 
 		namespace detail
 		{
@@ -124,6 +132,8 @@ namespace ion::graphics::textures
 			std::optional<std::string> pixel_data_;
 			std::optional<texture::TextureExtents> extents_;
 			std::optional<texture::TextureAtlasRegion> atlas_region_;
+			std::optional<texture::TexturePageRegion> page_region_;
+			bool packable_ = true;
 
 		public:
 
@@ -195,6 +205,18 @@ namespace ion::graphics::textures
 				handle_ = handle;
 			}
 
+			///@brief Sets the page region of the texture to the given region
+			///@details Is set by the owning texture manager when the texture has been packed into a texture page
+			inline void PageRegion(std::optional<texture::TexturePageRegion> page_region) noexcept
+			{
+				page_region_ = page_region;
+			}
+
+			///@brief Sets whether or not the texture can be packed into a texture page
+			///@details Textures used as animation frames, as point sprites or together with other texture maps needs their own tex coords, and should not be packed.
+			///If the texture is already packed, it will be reloaded into its own texture
+			void Packable(bool packable) noexcept;
+
 			///@brief Sets the pixel data of the texture to the given data
 			inline void PixelData(std::string data, const texture::TextureExtents &extents) noexcept
 			{
@@ -208,6 +230,15 @@ namespace ion::graphics::textures
 				pixel_data_.reset();
 			}
 
+			///@brief Releases the pixel data and returns it
+			///@details Can be used to recycle the pixel data (if not needed anymore)
+			[[nodiscard]] inline auto ReleasePixelData() noexcept
+			{
+				auto pixel_data = std::move(pixel_data_);
+				pixel_data_.reset();
+				return pixel_data;
+			}
+
 			///@}
 
 			/**
@@ -243,6 +274,19 @@ namespace ion::graphics::textures
 				return atlas_region_;
 			}
 
+			///@brief Returns the page region of the texture
+			///@details Returns nullopt if the texture is not packed into a texture page
+			[[nodiscard]] inline auto& PageRegion() const noexcept
+			{
+				return page_region_;
+			}
+
+			///@brief Returns true if the texture can be packed into a texture page
+			[[nodiscard]] inline auto Packable() const noexcept
+			{
+				return packable_;
+			}
+
 
 			///@brief Returns the min, mag and mip texture filters
 			[[nodiscard]] inline auto Filter() const noexcept
@@ -296,7 +340,7 @@ namespace ion::graphics::textures
 			*/
 
 			///@brief Returns the lower left and upper right texture coordinates for the texture
-			///@details This is important if one or both of the texture sides are NPOT.
+			///@details This is important if one or both of the texture sides are NPOT, or if the texture is packed into a texture page.
 			///Returns nullopt if the texture is missing extents (not loaded)
 			[[nodiscard]] std::optional<std::pair<Vector2, Vector2>> TexCoords() const noexcept;
 
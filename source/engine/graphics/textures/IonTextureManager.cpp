@@ -13,6 +13,9 @@ File:	IonTextureManager.cpp
 #include "IonTextureManager.h"
 
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
 
 #include "graphics/IonGraphicsAPI.h"
 #include "FreeImage/FreeImage.h"
@@ -150,11 +153,382 @@ void enlarge_canvas(std::string &pixel_data, int left, int bottom, const texture
 }
 
 
+/*
+	Pixel buffers
+*/
+
+std::string acquire_pixel_buffer(pixel_buffer_pool &pool, std::size_t size)
+{
+	{
+		std::lock_guard lock{pool.m};
+
+		//Smallest pooled buffer that fits (best fit)
+		auto iter = std::end(pool.buffers);
+		for (auto it = std::begin(pool.buffers), end = std::end(pool.buffers); it != end; ++it)
+		{
+			if (it->capacity() >= size && (iter == std::end(pool.buffers) || it->capacity() < iter->capacity()))
+				iter = it;
+		}
+
+		if (iter != std::end(pool.buffers))
+		{
+			auto buffer = std::move(*iter);
+			*iter = std::move(pool.buffers.back());
+			pool.buffers.pop_back();
+			pool.size -= buffer.capacity();
+			return buffer; //Empty, with capacity retained
+		}
+	}
+
+	std::string buffer;
+	buffer.reserve(size);
+	return buffer;
+}
+
+void release_pixel_buffer(pixel_buffer_pool &pool, std::string buffer)
+{
+	if (buffer.capacity() == 0)
+		return;
+
+	buffer.clear();
+	std::lock_guard lock{pool.m};
+
+	//Keep buffer for reuse, if within pool size
+	if (pool.size + buffer.capacity() <= pool.max_size)
+	{
+		pool.size += buffer.capacity();
+		pool.buffers.push_back(std::move(buffer));
+	}
+}
+
+
+/*
+	Baked textures
+*/
+
+std::size_t mipmap_chain_size(const texture::TextureExtents &extents, int mip_levels) noexcept
+{
+	auto color_bytes = static_cast<std::size_t>(extents.BitDepth / 8);
+	auto size = std::size_t{0};
+
+	for (auto level = 0, width = extents.ActualWidth, height = extents.ActualHeight; level < mip_levels; ++level)
+	{
+		size += static_cast<std::size_t>(width) * height * color_bytes;
+		width = std::max(width / 2, 1);
+		height = std::max(height / 2, 1);
+	}
+
+	return size;
+}
+
+int generate_mipmaps(std::string &pixel_data, const texture::TextureExtents &extents)
+{
+	auto mip_levels = number_of_mipmap_levels(extents.ActualWidth, extents.ActualHeight) + 1;
+	auto color_bytes = extents.BitDepth / 8;
+
+	pixel_data.resize(mipmap_chain_size(extents, mip_levels));
+	auto data = reinterpret_cast<uint8*>(std::data(pixel_data));
+
+	//Downsample each level from the previous one (2x2 box filter)
+	for (auto level = 1, width = extents.ActualWidth, height = extents.ActualHeight; level < mip_levels; ++level)
+	{
+		auto src = data;
+		auto dst = data + static_cast<std::size_t>(width) * height * color_bytes;
+		auto dst_width = std::max(width / 2, 1);
+		auto dst_height = std::max(height / 2, 1);
+
+		for (auto y = 0; y < dst_height; ++y)
+		{
+			auto row0 = src + static_cast<std::size_t>(std::min(y * 2, height - 1)) * width * color_bytes;
+			auto row1 = src + static_cast<std::size_t>(std::min(y * 2 + 1, height - 1)) * width * color_bytes;
+
+			for (auto x = 0; x < dst_width; ++x)
+			{
+				auto x0 = std::min(x * 2, width - 1) * color_bytes;
+				auto x1 = std::min(x * 2 + 1, width - 1) * color_bytes;
+
+				for (auto c = 0; c < color_bytes; ++c, ++dst)
+					*dst = static_cast<uint8>((row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c] + 2) / 4);
+			}
+		}
+
+		data += static_cast<std::size_t>(width) * height * color_bytes;
+		width = dst_width;
+		height = dst_height;
+	}
+
+	return mip_levels;
+}
+
+
+bool is_baked_texture(std::string_view data) noexcept
+{
+	return std::size(data) >= baked_texture_header_size &&
+		data.substr(0, std::size(baked_texture_magic)) == baked_texture_magic;
+}
+
+std::string bake_texture(std::string_view pixel_data, const texture::TextureExtents &extents, bool mipmaps)
+{
+	auto mip_data = std::string{pixel_data.substr(0,
+		static_cast<std::size_t>(extents.ActualWidth) * extents.ActualHeight * (extents.BitDepth / 8))};
+	auto mip_levels = mipmaps ? generate_mipmaps(mip_data, extents) : 1;
+
+	std::string data(baked_texture_header_size, '\0');
+	std::copy(std::begin(baked_texture_magic), std::end(baked_texture_magic), std::begin(data));
+	data[6] = FreeImage_IsLittleEndian() ? 1 : 0; //Byte order of pixels (BGR or RGB)
+
+	auto header = std::array{
+		baked_texture_version,
+		static_cast<uint32>(extents.Width), static_cast<uint32>(extents.Height),
+		static_cast<uint32>(extents.ActualWidth), static_cast<uint32>(extents.ActualHeight),
+		static_cast<uint32>(extents.BitDepth), static_cast<uint32>(mip_levels)};
+	std::memcpy(std::data(data) + 8, std::data(header), sizeof(header));
+
+	data += mip_data;
+	return data;
+}
+
+std::optional<std::pair<std::string, texture::TextureExtents>> prepare_baked_texture(
+	std::string_view data, pixel_buffer_pool &pixel_buffers)
+{
+	if (!is_baked_texture(data) ||
+		data[6] != (FreeImage_IsLittleEndian() ? 1 : 0)) //Baked on a platform with different byte order
+		return {};
+
+	std::array<uint32, 7> header;
+	std::memcpy(std::data(header), std::data(data) + 8, sizeof(header));
+
+	auto [version, width, height, actual_width, actual_height, bit_depth, mip_levels] = header;
+
+	if (version != baked_texture_version ||
+		(bit_depth != 24 && bit_depth != 32) ||
+		width < 1 || height < 1 || width > actual_width || height > actual_height ||
+		actual_width > static_cast<uint32>(max_texture_size()) || actual_height > static_cast<uint32>(max_texture_size()) ||
+		mip_levels < 1 || mip_levels > 32)
+		return {};
+
+	//Baked without power of two resizing
+	if (!has_support_for_non_power_of_two_textures() &&
+		(!is_power_of_two(actual_width) || !is_power_of_two(actual_height)))
+		return {};
+
+	texture::TextureExtents extents;
+	extents.Width = static_cast<int>(width);
+	extents.Height = static_cast<int>(height);
+	extents.ActualWidth = static_cast<int>(actual_width);
+	extents.ActualHeight = static_cast<int>(actual_height);
+	extents.BitDepth = static_cast<int>(bit_depth);
+	extents.MipLevels = static_cast<int>(mip_levels);
+
+	auto pixels = data.substr(baked_texture_header_size);
+
+	if (std::size(pixels) != mipmap_chain_size(extents, extents.MipLevels))
+		return {};
+
+	auto pixel_data = acquire_pixel_buffer(pixel_buffers, std::size(pixels));
+	pixel_data.assign(pixels);
+	return std::pair{std::move(pixel_data), extents};
+}
+
+
+/*
+	Texture pages
+*/
+
+std::optional<std::pair<int, int>> skyline_allocate(std::vector<skyline_node> &skyline,
+	int page_width, int page_height, int width, int height)
+{
+	if (std::empty(skyline))
+		skyline.push_back({0, 0, page_width});
+
+	auto best_index = -1;
+	auto best_x = 0;
+	auto best_y = page_height;
+	auto best_width = page_width;
+
+	//Find the lowest position (bottom-left), where the rectangle fits
+	for (auto i = 0; i < std::ssize(skyline); ++i)
+	{
+		auto x = skyline[i].x;
+
+		if (x + width > page_width)
+			break; //Nodes are sorted on x
+
+		//Rectangle rests on the highest node it spans
+		auto y = 0;
+		for (auto j = i, remaining_width = width; remaining_width > 0; ++j)
+		{
+			y = std::max(y, skyline[j].y);
+			remaining_width -= skyline[j].width;
+		}
+
+		if (y + height > page_height)
+			continue; //Does not fit
+
+		//Lowest position, or same position with the narrowest node (best fit)
+		if (y < best_y || (y == best_y && skyline[i].width < best_width))
+		{
+			best_index = i;
+			best_x = x;
+			best_y = y;
+			best_width = skyline[i].width;
+		}
+	}
+
+	if (best_index < 0)
+		return {}; //Page is full
+
+	skyline.insert(std::begin(skyline) + best_index, {best_x, best_y + height, width});
+
+	//Shrink or remove nodes covered by the new node
+	for (auto i = best_index + 1; i < std::ssize(skyline);)
+	{
+		auto &previous = skyline[i - 1];
+		auto &node = skyline[i];
+
+		if (auto overlap = previous.x + previous.width - node.x; overlap > 0)
+		{
+			node.x += overlap;
+			node.width -= overlap;
+
+			if (node.width <= 0)
+			{
+				skyline.erase(std::begin(skyline) + i);
+				continue;
+			}
+		}
+
+		break;
+	}
+
+	//Merge neighboring nodes with the same height
+	for (auto i = 0; i + 1 < std::ssize(skyline);)
+	{
+		if (skyline[i].y == skyline[i + 1].y)
+		{
+			skyline[i].width += skyline[i + 1].width;
+			skyline.erase(std::begin(skyline) + i + 1);
+		}
+		else
+			++i;
+	}
+
+	return std::pair{best_x, best_y};
+}
+
+std::optional<std::pair<int, int>> free_area_allocate(std::vector<page_area> &free_areas, int width, int height)
+{
+	auto best_iter = std::end(free_areas);
+
+	//Find the smallest free area, where the rectangle fits (best fit)
+	for (auto iter = std::begin(free_areas), end = std::end(free_areas); iter != end; ++iter)
+	{
+		if (iter->width >= width && iter->height >= height &&
+			(best_iter == end || iter->width * iter->height < best_iter->width * best_iter->height))
+			best_iter = iter;
+	}
+
+	if (best_iter == std::end(free_areas))
+		return {}; //No free area fits
+
+	auto area = *best_iter;
+	free_areas.erase(best_iter);
+
+	//Split the remaining space into a right and a top area
+	if (area.width > width)
+		free_areas.push_back({area.x + width, area.y, area.width - width, height});
+	if (area.height > height)
+		free_areas.push_back({area.x, area.y + height, area.width, area.height - height});
+
+	return std::pair{area.x, area.y};
+}
+
+
+std::optional<texture::TextureHandle> create_texture_page(int width, int height,
+	texture::TextureFilter min_filter, texture::TextureFilter mag_filter) noexcept
+{
+	if (width > max_texture_size() ||
+		height > max_texture_size())
+		return {}; //Max texture limit reached
+
+	texture::TextureHandle texture_handle;
+	glGenTextures(1, reinterpret_cast<unsigned int*>(&texture_handle.Id));
+	glBindTexture(GL_TEXTURE_2D, texture_handle.Id);
+
+	//Texture pages have no mipmaps (packed textures would bleed into each other)
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+		min_filter == texture::TextureFilter::NearestNeighbor ? GL_NEAREST : GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+		mag_filter == texture::TextureFilter::NearestNeighbor ? GL_NEAREST : GL_LINEAR);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	//Allocate empty page in gl
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0,
+		GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return texture_handle;
+}
+
+void pack_texture(const std::string &pixel_data, const texture::TextureExtents &extents,
+	texture::TextureHandle page_handle, int x, int y) noexcept
+{
+	auto [left, top, right, bottom] =
+		padding(extents.Width, extents.Height, extents.ActualWidth, extents.ActualHeight);
+
+	auto format =
+		[&]() noexcept
+		{
+			if (FreeImage_IsLittleEndian())
+				return extents.BitDepth == 32 ? GL_BGRA : GL_BGR;
+			else
+				return extents.BitDepth == 32 ? GL_RGBA : GL_RGB;
+		}();
+
+	//Destination offset, source offset and size for each column/row
+	//Left/bottom border, image and right/top border (edge pixels are extruded into the border)
+	auto columns = std::array{
+		std::tuple{0, 0, texture_page_border},
+		std::tuple{texture_page_border, 0, extents.Width},
+		std::tuple{texture_page_border + extents.Width, extents.Width - 1, texture_page_border}
+	};
+	auto rows = std::array{
+		std::tuple{0, 0, texture_page_border},
+		std::tuple{texture_page_border, 0, extents.Height},
+		std::tuple{texture_page_border + extents.Height, extents.Height - 1, texture_page_border}
+	};
+
+	glBindTexture(GL_TEXTURE_2D, page_handle.Id);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, extents.ActualWidth);
+
+	//Unpack image (without padding) from memory to gl
+	for (auto &[row_to, row_from, row_size] : rows)
+	{
+		for (auto &[column_to, column_from, column_size] : columns)
+		{
+			glPixelStorei(GL_UNPACK_SKIP_PIXELS, left + column_from);
+			glPixelStorei(GL_UNPACK_SKIP_ROWS, bottom + row_from);
+			glTexSubImage2D(GL_TEXTURE_2D, 0, x + column_to, y + row_to, column_size, row_size,
+				format, GL_UNSIGNED_BYTE, std::data(pixel_data));
+		}
+	}
+
+	glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+	glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+	glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+
 std::optional<std::pair<std::string, texture::TextureExtents>> prepare_texture(
-	const std::string &file_data, const std::filesystem::path &file_path,
+	std::string_view file_data, const std::filesystem::path &file_path,
 	texture::TextureFilter min_filter, texture::TextureFilter mag_filter,
 	std::optional<NpotResizing> npot_resizing, NpotSampling npot_sampling,
-	std::optional<NpotResampleFit> npot_resample_fit, NpotResampleFilter npot_resample_filter)
+	std::optional<NpotResampleFit> npot_resample_fit, NpotResampleFilter npot_resample_filter,
+	pixel_buffer_pool &pixel_buffers)
 {
 	auto stream = FreeImage_OpenMemory(
 		reinterpret_cast<BYTE*>(const_cast<char*>(std::data(file_data))),
@@ -283,9 +657,9 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_texture(
 		extents.ActualHeight = upper_power_of_two(new_height);
 	}
 
-	auto pixel_data = std::string{
-		reinterpret_cast<char*>(FreeImage_GetBits(bitmap)),
-		static_cast<size_t>(extents.ActualWidth) * extents.ActualHeight * (bit_depth / 8)};
+	auto size = static_cast<size_t>(extents.ActualWidth) * extents.ActualHeight * (bit_depth / 8);
+	auto pixel_data = acquire_pixel_buffer(pixel_buffers, size);
+	pixel_data.assign(reinterpret_cast<char*>(FreeImage_GetBits(bitmap)), size);
 	FreeImage_Unload(bitmap);
 
 	return std::pair{std::move(pixel_data), extents};
@@ -306,15 +680,19 @@ std::optional<texture::TextureHandle> load_texture(const std::string &pixel_data
 	auto has_latest_generate_mipmap =
 		gl::HasGL(gl::Version::v3_0) ||
 		gl::FrameBufferObject_Support() != gl::Extension::None;
+	auto has_baked_mipmaps = mip_filter && extents.MipLevels > 1;
 
 	//Generate mipmaps
 	if (mip_filter)
 	{
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, number_of_mipmap_levels(extents.ActualWidth, extents.ActualHeight));
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL,
+			has_baked_mipmaps ?
+			extents.MipLevels - 1 :
+			number_of_mipmap_levels(extents.ActualWidth, extents.ActualHeight));
 
 		//Must be enabled before glTexImage2D!
-		if (!has_latest_generate_mipmap)
+		if (!has_latest_generate_mipmap && !has_baked_mipmaps)
 			glTexParameteri(GL_TEXTURE_2D, GL_GENERATE_MIPMAP, GL_TRUE);
 	}
 
@@ -379,20 +757,40 @@ std::optional<texture::TextureHandle> load_texture(const std::string &pixel_data
 	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
 		t_wrap_mode == texture::TextureWrapMode::Clamp ? GL_CLAMP_TO_EDGE : GL_REPEAT);
 
+	auto format =
+		[&]() noexcept
+		{
+			if (FreeImage_IsLittleEndian())
+				return extents.BitDepth == 32 ? GL_BGRA : GL_BGR;
+			else
+				return extents.BitDepth == 32 ? GL_RGBA : GL_RGB;
+		}();
+
 	//Unpack image from memory to gl
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 1); //May increase transfer speed for NPOT
 	glTexImage2D(GL_TEXTURE_2D, 0,
 		extents.BitDepth == 32 ? GL_RGBA8 : GL_RGB8, extents.ActualWidth, extents.ActualHeight, 0,
-			[&]() noexcept
-			{
-				if (FreeImage_IsLittleEndian())
-					return extents.BitDepth == 32 ? GL_BGRA : GL_BGR;
-				else
-					return extents.BitDepth == 32 ? GL_RGBA : GL_RGB;
-			}(), GL_UNSIGNED_BYTE, std::data(pixel_data));
+			format, GL_UNSIGNED_BYTE, std::data(pixel_data));
+
+	//Unpack baked mipmaps from memory to gl
+	if (has_baked_mipmaps)
+	{
+		auto color_bytes = extents.BitDepth / 8;
+		auto offset = static_cast<std::size_t>(extents.ActualWidth) * extents.ActualHeight * color_bytes;
+
+		for (auto level = 1, width = extents.ActualWidth, height = extents.ActualHeight; level < extents.MipLevels; ++level)
+		{
+			width = std::max(width / 2, 1);
+			height = std::max(height / 2, 1);
 
+			glTexImage2D(GL_TEXTURE_2D, level,
+				extents.BitDepth == 32 ? GL_RGBA8 : GL_RGB8, width, height, 0,
+					format, GL_UNSIGNED_BYTE, std::data(pixel_data) + offset);
+			offset += static_cast<std::size_t>(width) * height * color_bytes;
+		}
+	}
 	//Must be called after glTexImage2D!
-	if (has_latest_generate_mipmap)
+	else if (has_latest_generate_mipmap)
 		glGenerateMipmap(GL_TEXTURE_2D);
 
 	glBindTexture(GL_TEXTURE_2D, 0);
@@ -445,7 +843,7 @@ void next_sub_texture_position(std::pair<int, int> &position, int rows, int colu
 
 std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_texture(
 	const TextureAtlas &texture_atlas, const std::pair<int, int> &position,
-	std::optional<NpotResizing> npot_resizing) noexcept
+	std::optional<NpotResizing> npot_resizing, pixel_buffer_pool &pixel_buffers) noexcept
 {
 	auto &atlas_extents = *texture_atlas.Extents();
 	auto color_bytes = atlas_extents.BitDepth / 8;
@@ -473,7 +871,8 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_textu
 	sub_extents.BitDepth = atlas_extents.BitDepth;
 
 	//Allocate required bytes for the sub texture
-	std::string sub_pixel_data(sub_extents.ActualWidth * sub_extents.ActualHeight * color_bytes, '\0');
+	auto sub_pixel_data = acquire_pixel_buffer(pixel_buffers, sub_extents.ActualWidth * sub_extents.ActualHeight * color_bytes);
+	sub_pixel_data.assign(sub_extents.ActualWidth * sub_extents.ActualHeight * color_bytes, '\0');
 
 	auto [atlas_left, atlas_top, atlas_right, atlas_bottom] =
 		npot_resizing || !has_support_for_non_power_of_two_textures() ?
@@ -511,7 +910,8 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_textu
 	else
 	{
 		//Allocate required bytes for the texture atlas
-		std::string atlas_pixel_data(atlas_extents.ActualWidth * atlas_extents.ActualHeight * color_bytes, '\0');
+		auto atlas_pixel_data = acquire_pixel_buffer(pixel_buffers, atlas_extents.ActualWidth * atlas_extents.ActualHeight * color_bytes);
+		atlas_pixel_data.assign(atlas_extents.ActualWidth * atlas_extents.ActualHeight * color_bytes, '\0');
 
 		//Pack image from gl to memory
 		glBindTexture(GL_TEXTURE_2D, texture_atlas.Handle()->Id);
@@ -540,6 +940,8 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_textu
 				std::begin(sub_pixel_data) + to
 			);
 
+		release_pixel_buffer(pixel_buffers, std::move(atlas_pixel_data));
+
 		if (sub_extents.Width * sub_extents.Height <
 			sub_extents.ActualWidth * sub_extents.ActualHeight)
 
@@ -552,6 +954,120 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_textu
 } //texture_manager::detail
 
 
+//Private
+
+bool TextureManager::IsPackable(const Texture &texture) const noexcept
+{
+	auto &extents = texture.Extents();
+
+	//Texture atlases are needed for retrieving sub textures
+	return max_packed_texture_size_ && extents && texture.Packable() &&
+		   extents->MipLevels == 1 && !texture.MipFilter() &&
+		   texture.SWrapMode() == texture::TextureWrapMode::Clamp &&
+		   texture.TWrapMode() == texture::TextureWrapMode::Clamp &&
+		   extents->Width <= *max_packed_texture_size_ &&
+		   extents->Height <= *max_packed_texture_size_ &&
+		   !dynamic_cast<const TextureAtlas*>(&texture);
+}
+
+std::optional<texture::TexturePageRegion> TextureManager::PackTexture(const Texture &texture)
+{
+	if (!IsPackable(texture))
+		return {};
+
+	auto &extents = *texture.Extents();
+	auto width = extents.Width + detail::texture_page_border * 2;
+	auto height = extents.Height + detail::texture_page_border * 2;
+
+	auto pack =
+		[&](detail::texture_page &page) -> std::optional<texture::TexturePageRegion>
+		{
+			if (page.min_filter != texture.MinFilter() ||
+				page.mag_filter != texture.MagFilter())
+				return {};
+
+			//Reuse space freed by unpacked textures first
+			auto position = detail::free_area_allocate(page.free_areas, width, height);
+
+			if (!position)
+				position = detail::skyline_allocate(page.skyline, page.width, page.height, width, height);
+
+			if (position)
+			{
+				auto [x, y] = *position;
+				detail::pack_texture(*texture.PixelData(), extents, page.handle, x, y);
+				++page.textures;
+
+				auto page_width = static_cast<real>(page.width);
+				auto page_height = static_cast<real>(page.height);
+				return texture::TexturePageRegion{
+					page.handle,
+					{(x + detail::texture_page_border) / page_width, (y + detail::texture_page_border) / page_height},
+					{(x + detail::texture_page_border + extents.Width) / page_width, (y + detail::texture_page_border + extents.Height) / page_height},
+					{x, y}, {width, height}
+				};
+			}
+			else
+				return {};
+		};
+
+	//Pack into an existing page
+	for (auto &page : texture_pages_)
+	{
+		if (auto page_region = pack(page); page_region)
+			return page_region;
+	}
+
+	auto page_size = std::min(
+		static_cast<int>(detail::upper_power_of_two(texture_page_size_)), detail::max_texture_size());
+
+	if (width > page_size || height > page_size)
+		return {}; //Texture is larger than a page
+
+	//Pack into a new page
+	if (auto handle = detail::create_texture_page(page_size, page_size, texture.MinFilter(), texture.MagFilter()); handle)
+	{
+		auto &page = texture_pages_.emplace_back();
+		page.handle = *handle;
+		page.width = page_size;
+		page.height = page_size;
+		page.min_filter = texture.MinFilter();
+		page.mag_filter = texture.MagFilter();
+		return pack(page);
+	}
+	else
+		return {};
+}
+
+void TextureManager::UnpackTexture(const Texture &texture) noexcept
+{
+	if (auto &page_region = texture.PageRegion(); page_region)
+	{
+		if (auto iter = std::find_if(std::begin(texture_pages_), std::end(texture_pages_),
+				[&](auto &page) noexcept
+				{
+					return page.handle == page_region->Page;
+				}); iter != std::end(texture_pages_))
+		{
+			//Last texture in page, delete page
+			if (--iter->textures == 0)
+			{
+				detail::unload_texture(iter->handle);
+				texture_pages_.erase(iter);
+			}
+
+			//Reclaim space, so that it can be reused by other textures packed into this page
+			else
+			{
+				auto [x, y] = page_region->Position;
+				auto [width, height] = page_region->Size;
+				iter->free_areas.push_back({x, y, width, height});
+			}
+		}
+	}
+}
+
+
 //Protected
 
 /*
@@ -564,14 +1080,17 @@ bool TextureManager::PrepareResource(Texture &texture)
 	if (auto &atlas_region = texture.AtlasRegion(); atlas_region)
 		return !!atlas_region->Atlas;
 
-	if (FileResourceManager::PrepareResource(texture))
+	if (FileResourceManager::PrepareResourceView(texture))
 	{
 		if (auto texture_data =
+			detail::is_baked_texture(*texture.FileBytes()) ?
+			detail::prepare_baked_texture(*texture.FileBytes(), *pixel_buffers_) : //Straight copy
 			detail::prepare_texture(
-				*texture.FileData(), *texture.FilePath(),
+				*texture.FileBytes(), *texture.FilePath(),
 				texture.MinFilter(), texture.MagFilter(),
 				texture_npot_resizing_, texture_npot_sampling_,
-				texture_npot_resample_fit_, texture_npot_resample_filter_); texture_data)
+				texture_npot_resample_fit_, texture_npot_resample_filter_,
+				*pixel_buffers_); texture_data)
 		{
 			auto &[pixel_data, extents] = *texture_data;
 			texture.PixelData(std::move(pixel_data), extents);
@@ -607,7 +1126,7 @@ bool TextureManager::LoadResource(Texture &texture)
 			if (auto texture_data =
 				detail::prepare_sub_texture(
 					*atlas_region->Atlas, atlas_region->Position,
-					texture_npot_resizing_); texture_data)
+					texture_npot_resizing_, *pixel_buffers_); texture_data)
 			{
 				auto &[pixel_data, extents] = *texture_data;
 				texture.PixelData(std::move(pixel_data), extents);
@@ -627,6 +1146,14 @@ bool TextureManager::LoadResource(Texture &texture)
 
 	if (pixel_data && extents)
 	{
+		//Pack small texture into a shared texture page
+		if (auto page_region = PackTexture(texture); page_region)
+		{
+			texture.PageRegion(page_region);
+			texture.Handle(page_region->Page);
+			return true;
+		}
+
 		texture.Handle(detail::load_texture(*pixel_data, *extents, min_filter, mag_filter, mip_filter, s_wrap_mode, t_wrap_mode));
 		return texture.Handle().has_value();
 	}
@@ -638,7 +1165,15 @@ bool TextureManager::UnloadResource(Texture &texture) noexcept
 {
 	if (auto handle = texture.Handle(); handle)
 	{
-		detail::unload_texture(*handle);
+		//Texture is packed into a texture page
+		if (texture.PageRegion())
+		{
+			UnpackTexture(texture);
+			texture.PageRegion({});
+		}
+		else
+			detail::unload_texture(*handle);
+
 		texture.Handle({});
 		return true;
 	}
@@ -646,19 +1181,39 @@ bool TextureManager::UnloadResource(Texture &texture) noexcept
 		return false;
 }
 
+std::size_t TextureManager::ResourceSize(const Texture &texture) const noexcept
+{
+	return texture.PixelData() ?
+		std::size(*texture.PixelData()) :
+		FileResourceManager::ResourceSize(texture);
+}
+
 
 void TextureManager::ResourceLoaded(Texture &texture) noexcept
 {
 	FileResourceManager::ResourceLoaded(texture);
-	texture.ResetPixelData();
-		//Pixel data not required after texture has been loaded (save memory)
+
+	if (auto pixel_data = texture.ReleasePixelData(); pixel_data)
+		detail::release_pixel_buffer(*pixel_buffers_, std::move(*pixel_data));
+			//Pixel data not required after texture has been loaded (recycle)
+}
+
+void TextureManager::ResourceUnloaded(Texture &texture) noexcept
+{
+	FileResourceManager::ResourceUnloaded(texture);
+
+	if (auto pixel_data = texture.ReleasePixelData(); pixel_data)
+		detail::release_pixel_buffer(*pixel_buffers_, std::move(*pixel_data));
+			//Pixel data not required after texture has been unloaded (recycle)
 }
 
 void TextureManager::ResourceFailed(Texture &texture) noexcept
 {
 	FileResourceManager::ResourceFailed(texture);
-	texture.ResetPixelData();
-		//Pixel data not required after texture has failed (save memory)
+
+	if (auto pixel_data = texture.ReleasePixelData(); pixel_data)
+		detail::release_pixel_buffer(*pixel_buffers_, std::move(*pixel_data));
+			//Pixel data not required after texture has failed (recycle)
 }
 
 
@@ -678,6 +1233,83 @@ TextureManager::~TextureManager() noexcept
 	UnloadAll();
 		//Unload all resources before this manager is destroyed
 		//Virtual functions cannot be called post destruction
+
+	for (auto &page : texture_pages_)
+		detail::unload_texture(page.handle);
+}
+
+
+/*
+	Modifiers
+*/
+
+void TextureManager::MaxPixelBufferPoolSize(std::size_t max_size) noexcept
+{
+	std::lock_guard lock{pixel_buffers_->m};
+	pixel_buffers_->max_size = max_size;
+
+	//Shrink pool to fit
+	while (pixel_buffers_->size > max_size)
+	{
+		pixel_buffers_->size -= pixel_buffers_->buffers.back().capacity();
+		pixel_buffers_->buffers.pop_back();
+	}
+}
+
+
+/*
+	Observers
+*/
+
+std::size_t TextureManager::MaxPixelBufferPoolSize() const noexcept
+{
+	std::lock_guard lock{pixel_buffers_->m};
+	return pixel_buffers_->max_size;
+}
+
+
+/*
+	Textures - Baking
+*/
+
+std::optional<std::string> TextureManager::BakeTexture(const Texture &texture)
+{
+	//Sub textures are not stored in files
+	if (texture.AtlasRegion())
+		return {};
+
+	if (auto file = resources::file_resource_manager::detail::file_data_from_resource_name(Repositories(), texture.AssetName()); file)
+	{
+		auto &[file_data, file_path] = *file;
+
+		//Already baked
+		if (detail::is_baked_texture(file_data))
+			return std::move(file_data);
+
+		if (auto texture_data =
+			detail::prepare_texture(
+				file_data, file_path,
+				texture.MinFilter(), texture.MagFilter(),
+				texture_npot_resizing_, texture_npot_sampling_,
+				texture_npot_resample_fit_, texture_npot_resample_filter_,
+				*pixel_buffers_); texture_data)
+		{
+			auto &[pixel_data, extents] = *texture_data;
+			auto baked_data = detail::bake_texture(pixel_data, extents, texture.MipFilter().has_value());
+			detail::release_pixel_buffer(*pixel_buffers_, std::move(pixel_data));
+			return baked_data;
+		}
+	}
+
+	return {};
+}
+
+bool TextureManager::BakeTexture(const Texture &texture, const std::filesystem::path &file_path)
+{
+	if (auto baked_data = BakeTexture(texture); baked_data)
+		return ion::utilities::file::Save(file_path, *baked_data, ion::utilities::file::FileSaveMode::Binary);
+	else
+		return false;
 }
 
 
@@ -13,14 +13,18 @@ File:	IonTextureManager.h
 #ifndef ION_TEXTURE_MANAGER_H
 #define ION_TEXTURE_MANAGER_H
 
+#include <algorithm>
 #include <cmath>
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include "IonTexture.h"
 #include "IonTextureAtlas.h"
@@ -28,6 +32,7 @@ File:	IonTextureManager.h
 #include "memory/IonNonOwningPtr.h"
 #include "resources/IonFileResourceManager.h"
 #include "types/IonTypes.h"
+#include "utilities/IonFileUtility.h"
 #include "utilities/IonStringUtility.h"
 
 #undef max
@@ -67,6 +72,51 @@ namespace ion::graphics::textures
 
 		namespace detail
 		{
+			using namespace ion::utilities::file::literals;
+			using namespace types::type_literals;
+
+			constexpr auto default_max_pixel_buffer_pool_size = 64_mb;
+			constexpr auto default_texture_page_size = 2048;
+			constexpr auto texture_page_border = 1; //One pixel border around each packed texture (prevents bleeding)
+
+			constexpr auto baked_texture_magic = std::string_view{"IONTEX"};
+			constexpr auto baked_texture_version = 1_ui32;
+			constexpr auto baked_texture_header_size = 40;
+				//Magic (6), byte order (1), reserved (1), version (4),
+				//width, height, actual width, actual height, bit depth, mip levels (6 x 4), reserved (4)
+
+			struct pixel_buffer_pool final
+			{
+				std::vector<std::string> buffers;
+				std::size_t size = 0; //Total capacity of all pooled buffers
+				std::size_t max_size = default_max_pixel_buffer_pool_size;
+				std::mutex m;
+			};
+
+			struct skyline_node final
+			{
+				int x = 0, y = 0;
+				int width = 0;
+			};
+
+			struct page_area final
+			{
+				int x = 0, y = 0;
+				int width = 0, height = 0;
+			};
+
+			struct texture_page final
+			{
+				texture::TextureHandle handle;
+				int width = 0, height = 0;
+				texture::TextureFilter min_filter = texture::TextureFilter::Bilinear;
+				texture::TextureFilter mag_filter = texture::TextureFilter::Bilinear;
+				std::vector<skyline_node> skyline;
+				std::vector<page_area> free_areas; //Areas freed by unpacked textures
+				int textures = 0; //Number of textures packed into this page
+			};
+
+
 			bool has_support_for_non_power_of_two_textures() noexcept;
 			bool has_support_for_array_texture() noexcept;
 
@@ -139,11 +189,53 @@ namespace ion::graphics::textures
 			void enlarge_canvas(std::string &pixel_data, int left, int bottom, const texture::TextureExtents &extents) noexcept;
 
 
+			/**
+				@name Pixel buffers
+				@{
+			*/
+
+			std::string acquire_pixel_buffer(pixel_buffer_pool &pool, std::size_t size);
+			void release_pixel_buffer(pixel_buffer_pool &pool, std::string buffer);
+
+			///@}
+
+			/**
+				@name Baked textures
+				@{
+			*/
+
+			std::size_t mipmap_chain_size(const texture::TextureExtents &extents, int mip_levels) noexcept;
+			int generate_mipmaps(std::string &pixel_data, const texture::TextureExtents &extents);
+
+			bool is_baked_texture(std::string_view data) noexcept;
+			std::string bake_texture(std::string_view pixel_data, const texture::TextureExtents &extents, bool mipmaps);
+			std::optional<std::pair<std::string, texture::TextureExtents>> prepare_baked_texture(
+				std::string_view data, pixel_buffer_pool &pixel_buffers);
+
+			///@}
+
+			/**
+				@name Texture pages
+				@{
+			*/
+
+			std::optional<std::pair<int, int>> skyline_allocate(std::vector<skyline_node> &skyline,
+				int page_width, int page_height, int width, int height);
+			std::optional<std::pair<int, int>> free_area_allocate(std::vector<page_area> &free_areas, int width, int height);
+
+			std::optional<texture::TextureHandle> create_texture_page(int width, int height,
+				texture::TextureFilter min_filter, texture::TextureFilter mag_filter) noexcept;
+			void pack_texture(const std::string &pixel_data, const texture::TextureExtents &extents,
+				texture::TextureHandle page_handle, int x, int y) noexcept;
+
+			///@}
+
 			std::optional<std::pair<std::string, texture::TextureExtents>> prepare_texture(
-				const std::string &file_data, const std::filesystem::path &file_path,
+				std::string_view file_data, const std::filesystem::path &file_path,
 				texture::TextureFilter min_filter, texture::TextureFilter mag_filter,
 				std::optional<NpotResizing> npot_resizing, NpotSampling npot_sampling,
-				std::optional<NpotResampleFit> npot_resample_fit, NpotResampleFilter npot_resample_filter);
+				std::optional<NpotResampleFit> npot_resample_fit, NpotResampleFilter npot_resample_filter,
+				pixel_buffer_pool &pixel_buffers);
 
 			std::optional<texture::TextureHandle> load_texture(const std::string &pixel_data, const texture::TextureExtents &extents,
 				texture::TextureFilter min_filter, texture::TextureFilter mag_filter, std::optional<texture::MipmapFilter> mip_filter,
@@ -161,7 +253,7 @@ namespace ion::graphics::textures
 
 			std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_texture(
 				const TextureAtlas &texture_atlas, const std::pair<int, int> &position,
-				std::optional<NpotResizing> npot_resizing) noexcept;
+				std::optional<NpotResizing> npot_resizing, pixel_buffer_pool &pixel_buffers) noexcept;
 
 			///@}
 		} //detail
@@ -178,6 +270,12 @@ namespace ion::graphics::textures
 			texture_manager::NpotSampling texture_npot_sampling_ = texture_manager::NpotSampling::Nearest;
 			std::optional<texture_manager::NpotResampleFit> texture_npot_resample_fit_;
 			texture_manager::NpotResampleFilter texture_npot_resample_filter_ = texture_manager::NpotResampleFilter::Bilinear;
+			std::unique_ptr<texture_manager::detail::pixel_buffer_pool> pixel_buffers_ =
+				std::make_unique<texture_manager::detail::pixel_buffer_pool>();
+
+			std::optional<int> max_packed_texture_size_;
+			int texture_page_size_ = texture_manager::detail::default_texture_page_size;
+			std::vector<texture_manager::detail::texture_page> texture_pages_;
 
 
 			template <typename... Args>
@@ -201,7 +299,11 @@ namespace ion::graphics::textures
 							texture_atlas->Rows(), texture_atlas->Columns(), texture_atlas->SubTextureOrder());
 					}
 				}
-			}		
+			}
+
+			bool IsPackable(const Texture &texture) const noexcept;
+			std::optional<texture::TexturePageRegion> PackTexture(const Texture &texture);
+			void UnpackTexture(const Texture &texture) noexcept;
 
 		protected:
 
@@ -215,10 +317,17 @@ namespace ion::graphics::textures
 			bool LoadResource(Texture &texture) override;
 			bool UnloadResource(Texture &texture) noexcept override;
 
+			///@brief See FileResourceManager::ResourceSize for more details
+			///@details Returns the size of the pixel data, if prepared
+			std::size_t ResourceSize(const Texture &texture) const noexcept override;
+
 
 			///@brief See FileResourceManager::ResourceLoaded for more details
 			void ResourceLoaded(Texture &texture) noexcept override;
 
+			///@brief See FileResourceManager::ResourceUnloaded for more details
+			void ResourceUnloaded(Texture &texture) noexcept override;
+
 			///@brief See FileResourceManager::ResourceFailed for more details
 			void ResourceFailed(Texture &texture) noexcept override;
 
@@ -302,6 +411,27 @@ namespace ion::graphics::textures
 				texture_npot_resample_filter_ = npot_resample_filter;
 			}
 
+			///@brief Sets the max size (in bytes) of all pixel buffers kept for reuse by this manager
+			///@details Pixel buffers are recycled when textures are loaded, and reused when other textures are prepared.
+			///Pass 0 to not keep any pixel buffers
+			void MaxPixelBufferPoolSize(std::size_t max_size) noexcept;
+
+
+			///@brief Sets the max width and height of textures packed into texture pages by this manager
+			///@details Small textures are packed into shared texture pages when loaded, so that they can be drawn in the same batch.
+			///Only packable textures without mipmaps and with a clamped texture wrap are packed. Pass nullopt to turn off texture packing
+			inline void MaxPackedTextureSize(std::optional<int> max_size) noexcept
+			{
+				max_packed_texture_size_ = max_size;
+			}
+
+			///@brief Sets the width and height of new texture pages created by this manager
+			///@details The page size is rounded up to power of two, and clamped to the max texture size supported
+			inline void TexturePageSize(int size) noexcept
+			{
+				texture_page_size_ = std::max(size, 1);
+			}
+
 			///@}
 
 			/**
@@ -333,7 +463,47 @@ namespace ion::graphics::textures
 			[[nodiscard]] inline auto TextureNpotResampleFilter() const noexcept
 			{
 				return texture_npot_resample_filter_;
-			}		
+			}
+
+			///@brief Returns the max size (in bytes) of all pixel buffers kept for reuse by this manager
+			[[nodiscard]] std::size_t MaxPixelBufferPoolSize() const noexcept;
+
+
+			///@brief Returns the max width and height of textures packed into texture pages by this manager
+			///@details Returns nullopt if texture packing is turned off
+			[[nodiscard]] inline auto MaxPackedTextureSize() const noexcept
+			{
+				return max_packed_texture_size_;
+			}
+
+			///@brief Returns the width and height of new texture pages created by this manager
+			[[nodiscard]] inline auto TexturePageSize() const noexcept
+			{
+				return texture_page_size_;
+			}
+
+			///@brief Returns the number of texture pages currently in use by this manager
+			[[nodiscard]] inline auto TexturePages() const noexcept
+			{
+				return std::ssize(texture_pages_);
+			}
+
+			///@}
+
+			/**
+				@name Textures - Baking
+				@{
+			*/
+
+			///@brief Bakes the given texture into a GPU ready format, and returns the baked data
+			///@details The baked data contains the final (resized) pixel data, and the full mip chain if the texture has a mip filter.
+			///Store it in place of the source image (in a data file), and it is uploaded with a straight copy instead of being decoded.
+			///Returns nullopt if the texture could not be baked (or is a sub texture)
+			[[nodiscard]] std::optional<std::string> BakeTexture(const Texture &texture);
+
+			///@brief Bakes the given texture into a GPU ready format, and saves the baked data to the given file path
+			///@details Returns true if the texture was baked and saved successfully
+			bool BakeTexture(const Texture &texture, const std::filesystem::path &file_path);
 
 			///@}
 
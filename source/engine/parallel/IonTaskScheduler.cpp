@@ -0,0 +1,213 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	parallel
+File:	IonTaskScheduler.cpp
+-------------------------------------------
+*/
+
+#include "IonTaskScheduler.h"
+
+namespace ion::parallel
+{
+
+using namespace task_scheduler;
+
+namespace task_scheduler::detail
+{
+
+thread_local const TaskScheduler *current_scheduler = nullptr;
+thread_local int current_worker_index = -1;
+
+
+//task_deque
+
+void task_deque::push_back(task_ptr task)
+{
+	std::lock_guard lock{m};
+	tasks.push_back(std::move(task));
+}
+
+task_ptr task_deque::pop_back()
+{
+	std::lock_guard lock{m};
+
+	if (std::empty(tasks))
+		return nullptr;
+
+	auto task = std::move(tasks.back());
+	tasks.pop_back();
+	return task;
+}
+
+task_ptr task_deque::steal_front()
+{
+	std::lock_guard lock{m};
+
+	if (std::empty(tasks))
+		return nullptr;
+
+	auto task = std::move(tasks.front());
+	tasks.pop_front();
+	return task;
+}
+
+} //task_scheduler::detail
+
+
+//Private
+
+void TaskScheduler::WorkerMain(int index)
+{
+	detail::current_scheduler = this;
+	detail::current_worker_index = index;
+
+	while (true)
+	{
+		if (auto task = NextTask(index); task)
+		{
+			task->Execute();
+			continue;
+		}
+
+		std::unique_lock lock{m_};
+		cv_.wait(lock,
+			[&]() noexcept
+			{
+				return stopping_ || pending_tasks_.load() > 0;
+			});
+
+		//Finish all scheduled tasks before stopping
+		if (stopping_ && pending_tasks_.load() == 0)
+			break;
+	}
+
+	detail::current_scheduler = nullptr;
+	detail::current_worker_index = -1;
+}
+
+void TaskScheduler::Enqueue(detail::task_ptr task)
+{
+	//Push to own deque if called from a worker thread, else distribute round-robin
+	auto index = CurrentWorkerIndex().value_or(
+		static_cast<int>(next_queue_.fetch_add(1, std::memory_order_relaxed) % std::size(queues_)));
+
+	++pending_tasks_;
+	queues_[index]->push_back(std::move(task));
+
+	{
+		std::lock_guard lock{m_};
+			//Make sure a waiting worker does not miss the notification
+	}
+
+	cv_.notify_one();
+}
+
+detail::task_ptr TaskScheduler::NextTask(std::optional<int> index)
+{
+	auto queue_count = static_cast<int>(std::size(queues_));
+
+	//Pop from own deque first (LIFO)
+	if (index)
+	{
+		if (auto task = queues_[*index]->pop_back(); task)
+		{
+			--pending_tasks_;
+			return task;
+		}
+	}
+
+	//Steal from the other deques (FIFO)
+	for (auto i = 1, start = index.value_or(0); i <= queue_count; ++i)
+	{
+		if (auto victim = (start + i) % queue_count; !index || victim != *index)
+		{
+			if (auto task = queues_[victim]->steal_front(); task)
+			{
+				--pending_tasks_;
+				return task;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool TaskScheduler::ExecuteNextTask()
+{
+	if (auto task = NextTask(CurrentWorkerIndex()); task)
+	{
+		task->Execute();
+		return true;
+	}
+	else
+		return false;
+}
+
+
+//Public
+
+TaskScheduler::TaskScheduler() :
+	TaskScheduler{detail::default_number_of_threads()}
+{
+	//Empty
+}
+
+TaskScheduler::TaskScheduler(int worker_threads)
+{
+	worker_threads = worker_threads < 1 ? 1 : worker_threads;
+	queues_.reserve(worker_threads);
+	threads_.reserve(worker_threads);
+
+	for (auto i = 0; i < worker_threads; ++i)
+		queues_.push_back(std::make_unique<detail::task_deque>());
+
+	for (auto i = 0; i < worker_threads; ++i)
+		threads_.emplace_back(&TaskScheduler::WorkerMain, this, i);
+}
+
+TaskScheduler::~TaskScheduler()
+{
+	{
+		std::lock_guard lock{m_};
+		stopping_ = true;
+	}
+
+	cv_.notify_all();
+
+	for (auto &thread : threads_)
+	{
+		if (thread.joinable())
+			thread.join();
+	}
+}
+
+
+/*
+	Static scheduler instance
+*/
+
+TaskScheduler& TaskScheduler::Instance()
+{
+	static TaskScheduler scheduler;
+	return scheduler;
+}
+
+
+/*
+	Observers
+*/
+
+std::optional<int> TaskScheduler::CurrentWorkerIndex() const noexcept
+{
+	if (detail::current_scheduler == this)
+		return detail::current_worker_index;
+	else
+		return {};
+}
+
+} //ion::parallel
\ No newline at end of file
@@ -0,0 +1,557 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	parallel
+File:	IonTaskScheduler.h
+-------------------------------------------
+*/
+
+#ifndef ION_TASK_SCHEDULER_H
+#define ION_TASK_SCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ion::parallel
+{
+	class TaskScheduler;
+
+	namespace task_scheduler::detail
+	{
+		///@brief Type erased, move only task
+		class task_base
+		{
+			public:
+
+				virtual ~task_base() = default;
+				virtual void Execute() = 0;
+		};
+
+		template <typename Function>
+		class task_impl final : public task_base
+		{
+			private:
+
+				Function function_;
+
+			public:
+
+				explicit task_impl(Function function) :
+					function_{std::move(function)}
+				{
+					//Empty
+				}
+
+				void Execute() override
+				{
+					std::invoke(function_);
+				}
+		};
+
+		using task_ptr = std::unique_ptr<task_base>;
+
+		template <typename Function>
+		inline auto make_task(Function &&function)
+		{
+			return task_ptr{std::make_unique<task_impl<std::decay_t<Function>>>(std::forward<Function>(function))};
+		}
+
+
+		///@brief A double ended task queue owned by a single worker thread
+		///@details The owner pushes and pops at the back (LIFO), while other threads steals from the front (FIFO)
+		struct task_deque final
+		{
+			std::deque<task_ptr> tasks;
+			std::mutex m;
+
+			void push_back(task_ptr task);
+			task_ptr pop_back();
+			task_ptr steal_front();
+		};
+
+
+		///@brief Shared state between a running task and its task handles
+		template <typename T>
+		struct task_state final
+		{
+			using value_type = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+			std::optional<value_type> result;
+			std::exception_ptr exception;
+			std::vector<task_ptr> continuations;
+			bool done = false;
+
+			task_ptr work; //Executed once, by a worker or inline by a waiting thread
+			std::atomic<bool> started = false;
+
+			std::mutex m;
+			std::condition_variable cv;
+
+
+			template <typename Function>
+			void execute(Function &function) noexcept
+			{
+				try
+				{
+					if constexpr (std::is_void_v<T>)
+					{
+						std::invoke(function);
+						result.emplace();
+					}
+					else
+						result.emplace(std::invoke(function));
+				}
+				catch (...)
+				{
+					exception = std::current_exception();
+				}
+
+				complete();
+			}
+
+			bool try_execute() noexcept;
+			void complete() noexcept;
+		};
+
+
+		template <typename T, typename Function>
+		struct continuation_result
+		{
+			using type = std::invoke_result_t<Function, const T&>;
+		};
+
+		template <typename Function>
+		struct continuation_result<void, Function>
+		{
+			using type = std::invoke_result_t<Function>;
+		};
+
+
+		constexpr auto chunks_per_thread = 4;
+
+		inline auto number_of_cores() noexcept
+		{
+			if (auto count = static_cast<int>(std::thread::hardware_concurrency()); count > 0)
+				return count;
+			else
+				return 1;
+		}
+
+		inline auto default_number_of_threads() noexcept
+		{
+			return number_of_cores();
+		}
+
+
+		template <typename Function, typename... Args>
+		inline auto deferred_call(Function &&function, Args &&...args)
+		{
+			return
+				[function = std::forward<Function>(function), ...args = std::forward<Args>(args)]() mutable
+				{
+					return std::invoke(std::move(function), std::move(args)...);
+				};
+		}
+	} //task_scheduler::detail
+
+
+	///@brief A class representing a handle to a task scheduled by a task scheduler
+	///@details The handle can be used to wait for, retrieve the result of or attach continuations to a task.
+	///Multiple handles can refer to the same task
+	template <typename T>
+	class TaskHandle final
+	{
+		private:
+
+			std::shared_ptr<task_scheduler::detail::task_state<T>> state_;
+			TaskScheduler *scheduler_ = nullptr;
+
+		public:
+
+			///@brief Default constructor
+			TaskHandle() = default;
+
+			///@brief Constructs a new task handle from the given shared state and scheduler
+			TaskHandle(std::shared_ptr<task_scheduler::detail::task_state<T>> state, TaskScheduler &scheduler) noexcept :
+				state_{std::move(state)},
+				scheduler_{&scheduler}
+			{
+				//Empty
+			}
+
+
+			/**
+				@name Modifiers
+				@{
+			*/
+
+			///@brief Returns the result once it's available (blocking)
+			///@details If the task threw an exception, the exception is rethrown here.
+			///The handle is empty after this call
+			auto Get()
+			{
+				Wait();
+				auto state = std::move(state_);
+
+				if (state->exception)
+					std::rethrow_exception(state->exception);
+
+				if constexpr (!std::is_void_v<T>)
+					return std::move(*state->result);
+			}
+
+			///@brief Waits for the task to finish (blocking)
+			///@details If the task has not been started yet, it is executed inline by the calling thread (from any thread).
+			///If called from a worker thread of the owning scheduler, other tasks are executed while waiting
+			void Wait() const;
+
+			///@brief Attaches a continuation that is scheduled when this task is done
+			///@details The continuation is called with the result of this task (if any) and returns a new task handle.
+			///The result is passed as a const reference, so it can still be retrieved from this handle afterwards.
+			///If this task threw an exception, the continuation is not called and the exception is propagated
+			template <typename Function>
+			auto Then(Function &&function) const;
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns true if this task handle is empty
+			[[nodiscard]] inline auto IsEmpty() const noexcept
+			{
+				return !state_;
+			}
+
+			///@brief Returns true if the task is done
+			[[nodiscard]] inline auto IsReady() const noexcept
+			{
+				if (!state_)
+					return false;
+
+				std::lock_guard lock{state_->m};
+				return state_->done;
+			}
+
+			///@}
+	};
+
+
+	///@brief A class representing a persistent work-stealing task scheduler
+	///@details A fixed number of worker threads are created once, each owning its own task deque.
+	///Tasks scheduled from a worker thread are pushed to the workers own deque, while idle workers steal from the others.
+	///Tasks scheduled from any other thread are distributed round-robin between the workers
+	class TaskScheduler final
+	{
+		template <typename T>
+		friend class TaskHandle;
+
+		private:
+
+			std::vector<std::unique_ptr<task_scheduler::detail::task_deque>> queues_;
+			std::vector<std::thread> threads_;
+
+			std::atomic<int> pending_tasks_ = 0;
+			std::atomic<unsigned int> next_queue_ = 0;
+			bool stopping_ = false;
+
+			std::mutex m_;
+			std::condition_variable cv_;
+
+
+			void WorkerMain(int index);
+			void Enqueue(task_scheduler::detail::task_ptr task);
+
+			task_scheduler::detail::task_ptr NextTask(std::optional<int> index);
+			bool ExecuteNextTask();
+
+		public:
+
+			///@brief Constructs a task scheduler with a default number of worker threads (based on your system)
+			TaskScheduler();
+
+			///@brief Constructs a task scheduler with the given number of worker threads, in range [1, ...)
+			explicit TaskScheduler(int worker_threads);
+
+			///@brief Deleted copy constructor
+			TaskScheduler(const TaskScheduler&) = delete;
+
+			///@brief Destructor
+			///@details Finishes all scheduled tasks before joining the worker threads
+			~TaskScheduler();
+
+
+			/**
+				@name Operators
+				@{
+			*/
+
+			///@brief Deleted copy assignment
+			TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+			///@}
+
+			/**
+				@name Static scheduler instance
+				@{
+			*/
+
+			///@brief Returns a shared task scheduler instance, created on first use
+			[[nodiscard]] static TaskScheduler& Instance();
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the number of worker threads in this scheduler
+			[[nodiscard]] inline auto WorkerThreads() const noexcept
+			{
+				return static_cast<int>(std::size(threads_));
+			}
+
+			///@brief Returns the number of tasks waiting to be executed
+			[[nodiscard]] inline auto PendingTasks() const noexcept
+			{
+				return pending_tasks_.load(std::memory_order_relaxed);
+			}
+
+			///@brief Returns the index of the calling worker thread, if the caller is a worker thread in this scheduler
+			[[nodiscard]] std::optional<int> CurrentWorkerIndex() const noexcept;
+
+			///@}
+
+			/**
+				@name Tasks
+				@{
+			*/
+
+			///@brief Schedules the given function with the given arguments and returns a task handle
+			template <typename Function, typename... Args>
+			auto Run(Function &&function, Args &&...args)
+			{
+				using result_type = std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>;
+
+				auto state = std::make_shared<task_scheduler::detail::task_state<result_type>>();
+				state->work = task_scheduler::detail::make_task(
+					[state = state.get(), call = task_scheduler::detail::deferred_call(std::forward<Function>(function), std::forward<Args>(args)...)]() mutable
+					{
+						state->execute(call);
+					});
+				Enqueue(task_scheduler::detail::make_task(
+					[state]()
+					{
+						state->try_execute(); //Could already have been executed inline by a waiting thread
+					}));
+
+				return TaskHandle<result_type>{std::move(state), *this};
+			}
+
+			///@brief Calls the given function for each index in range [first, last) in parallel (blocking)
+			///@details The range is split into chunks of at least grain size indices.
+			///The calling thread participates by executing the first chunk.
+			///All chunks are finished before returning, then the first exception thrown (if any) is rethrown
+			template <typename T, typename Function>
+			void ParallelFor(T first, T last, Function &&function, T grain_size = T{1})
+			{
+				static_assert(std::is_integral_v<T>);
+
+				if (last <= first)
+					return;
+
+				auto count = last - first;
+				auto max_chunks = static_cast<T>(WorkerThreads() * task_scheduler::detail::chunks_per_thread);
+				auto chunk_size = std::max(grain_size < T{1} ? T{1} : grain_size,
+					static_cast<T>((count + max_chunks - 1) / max_chunks));
+
+				std::vector<TaskHandle<void>> tasks;
+				std::exception_ptr exception;
+
+				try
+				{
+					tasks.reserve(static_cast<size_t>((count + chunk_size - 1) / chunk_size));
+
+					for (auto begin = first + std::min(chunk_size, count), end = begin; begin < last; begin = end)
+					{
+						end = begin + std::min(chunk_size, last - begin);
+						tasks.push_back(Run(
+							[&function, begin, end]()
+							{
+								for (auto i = begin; i < end; ++i)
+									std::invoke(function, i);
+							}));
+					}
+
+					//First chunk
+					for (auto i = first, end = first + std::min(chunk_size, count); i < end; ++i)
+						std::invoke(function, i);
+				}
+				catch (...)
+				{
+					exception = std::current_exception();
+				}
+
+				//Wait for all chunks, they refer to the function
+				for (auto &task : tasks)
+				{
+					try
+					{
+						task.Get();
+					}
+					catch (...)
+					{
+						if (!exception)
+							exception = std::current_exception();
+					}
+				}
+
+				if (exception)
+					std::rethrow_exception(exception); //Propagates first exception
+			}
+
+			///@}
+	};
+
+
+	/*
+		Task handle
+	*/
+
+	template <typename T>
+	void TaskHandle<T>::Wait() const
+	{
+		if (!state_)
+			return;
+
+		//Execute task inline if not started by a worker yet
+		if (state_->try_execute())
+			return;
+
+		//Help executing other tasks while waiting
+		if (scheduler_ && scheduler_->CurrentWorkerIndex())
+		{
+			while (!IsReady())
+			{
+				if (!scheduler_->ExecuteNextTask())
+					std::this_thread::yield();
+			}
+		}
+		else
+		{
+			std::unique_lock lock{state_->m};
+			state_->cv.wait(lock,
+				[&]() noexcept
+				{
+					return state_->done;
+				});
+		}
+	}
+
+	template <typename T>
+	template <typename Function>
+	auto TaskHandle<T>::Then(Function &&function) const
+	{
+		using result_type = typename task_scheduler::detail::continuation_result<T, std::decay_t<Function>>::type;
+
+		auto next_state = std::make_shared<task_scheduler::detail::task_state<result_type>>();
+		auto continuation = task_scheduler::detail::make_task(
+			[state = state_, next_state, function = std::forward<Function>(function)]() mutable
+			{
+				if (state->exception)
+				{
+					next_state->exception = state->exception;
+					next_state->complete();
+				}
+				else
+				{
+					auto call =
+						[&]() -> result_type
+						{
+							if constexpr (std::is_void_v<T>)
+								return std::invoke(std::move(function));
+							else
+								return std::invoke(std::move(function), std::as_const(*state->result));
+						};
+					next_state->execute(call);
+				}
+			});
+
+		{
+			std::lock_guard lock{state_->m};
+
+			//Schedule when this task completes
+			if (!state_->done)
+			{
+				state_->continuations.push_back(
+					task_scheduler::detail::make_task(
+						[scheduler = scheduler_, continuation = std::move(continuation)]() mutable
+						{
+							scheduler->Enqueue(std::move(continuation));
+						}));
+				return TaskHandle<result_type>{std::move(next_state), *scheduler_};
+			}
+		}
+
+		//Already done, schedule now
+		scheduler_->Enqueue(std::move(continuation));
+		return TaskHandle<result_type>{std::move(next_state), *scheduler_};
+	}
+
+
+	namespace task_scheduler::detail
+	{
+		template <typename T>
+		bool task_state<T>::try_execute() noexcept
+		{
+			if (started.exchange(true, std::memory_order_acq_rel))
+				return false; //Already started
+
+			if (auto task = std::move(work); task)
+			{
+				task->Execute(); //Does not throw (exceptions are stored)
+				return true;
+			}
+			else
+				return false; //Continuation, nothing to execute
+		}
+
+		template <typename T>
+		void task_state<T>::complete() noexcept
+		{
+			std::vector<task_ptr> ready_continuations;
+
+			{
+				std::lock_guard lock{m};
+				done = true;
+				ready_continuations = std::move(continuations);
+			}
+
+			cv.notify_all();
+
+			for (auto &continuation : ready_continuations)
+				continuation->Execute();
+		}
+	} //task_scheduler::detail
+} //ion::parallel
+
+#endif
\ No newline at end of file
@@ -13,34 +13,45 @@ File:	IonWorker.h
 #ifndef ION_WORKER_H
 #define ION_WORKER_H
 
-#include <chrono>
-#include <future>
+#include <utility>
+
+#include "IonTaskScheduler.h"
 
 namespace ion::parallel
 {
 	namespace worker::detail
 	{
 		template <typename Ret>
-		using future_type = std::future<Ret>;
+		using task_handle_type = TaskHandle<Ret>;
 	} //worker::detail
 
 
 	///@brief A class representing an async waitable worker
 	///@details The worker starts on a given task and returns the result when queried.
+	///The task is executed by a persistent task scheduler, no thread is created per worker.
 	///This is the slave class defined by the master/slave model
 	template <typename Ret>
 	class Worker final
 	{
 		private:
 
-			worker::detail::future_type<Ret> task_;
+			worker::detail::task_handle_type<Ret> task_;
 
 		public:
 
 			///@brief Constructs a worker by passing it a function (or something that is invocable) and its arguments
+			///@details The task is scheduled on the shared task scheduler instance
 			template <typename Function, typename... Args>
 			Worker(Function &&function, Args &&...args) :
-				task_{std::async(std::launch::async, std::forward<Function>(function), std::forward<Args>(args)...)}
+				task_{TaskScheduler::Instance().Run(std::forward<Function>(function), std::forward<Args>(args)...)}
+			{
+				//Empty
+			}
+
+			///@brief Constructs a worker by passing it a task scheduler, a function (or something that is invocable) and its arguments
+			template <typename Function, typename... Args>
+			Worker(TaskScheduler &scheduler, Function &&function, Args &&...args) :
+				task_{scheduler.Run(std::forward<Function>(function), std::forward<Args>(args)...)}
 			{
 				//Empty
 			}
@@ -71,22 +82,28 @@ namespace ion::parallel
 			*/
 
 			///@brief Returns the result once it's available (blocking)
-			[[nodiscard]] inline auto Get() noexcept
+			[[nodiscard]] inline auto Get()
 			{
-				return task_.get();
+				return task_.Get();
 			}
 
-			///@brief Returns the future handle, by moving it out of the worker (non-blocking)
-			[[nodiscard]] inline auto GetFuture() noexcept
+			///@brief Returns the task handle, by moving it out of the worker (non-blocking)
+			[[nodiscard]] inline auto GetHandle() noexcept
 			{
 				return std::move(task_);
 			}
 
+			///@brief Returns the task handle, by moving it out of the worker (non-blocking)
+			///@details Same as GetHandle, kept for compatibility
+			[[nodiscard]] inline auto GetFuture() noexcept
+			{
+				return GetHandle();
+			}
+
 			///@brief Wait for the worker to finish its task (blocking)
 			void Wait() noexcept
 			{
-				if (task_.valid())
-					task_.wait();
+				task_.Wait();
 			}
 
 			///@}
@@ -99,13 +116,13 @@ namespace ion::parallel
 			///@brief Returns true if this worker is empty
 			[[nodiscard]] inline auto IsEmpty() const noexcept
 			{
-				return !task_.valid();
+				return task_.IsEmpty();
 			}
 
 			///@brief Returns true if this worker is ready
 			[[nodiscard]] inline auto IsReady() const noexcept
 			{
-				return task_.valid() && task_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+				return task_.IsReady();
 			}
 
 			///@}
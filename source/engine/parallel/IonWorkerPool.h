@@ -64,10 +64,7 @@ namespace ion::parallel
 
 			inline auto number_of_cores() noexcept
 			{
-				if (auto count = static_cast<int>(std::thread::hardware_concurrency()); count > 0)
-					return count;
-				else
-					return 1;
+				return task_scheduler::detail::number_of_cores();
 			}
 
 			inline auto default_number_of_threads() noexcept
@@ -91,6 +88,7 @@ namespace ion::parallel
 
 	///@brief A class representing a pool of workers (with an optional worker id)
 	///@details Each worker runs in parallel and returns the results when done.
+	///Workers are thin facades over tasks executed by the shared task scheduler, max worker threads only limits how many tasks are in flight.
 	///This is the master class defined by the master/slave model
 	template <typename Ret, typename Id = void>
 	class WorkerPool final
@@ -166,7 +164,7 @@ namespace ion::parallel
 				//Empty
 			}
 
-			///@brief Constructs a worker pool with the given max number of worker threads, and either running (default) or not
+			///@brief Constructs a worker pool with the given max number of worker threads (tasks in flight), and either running (default) or not
 			WorkerPool(int max_worker_threads, worker_pool::RunningState running_state = worker_pool::RunningState::NonSuspended) noexcept :
 				running_state_{running_state},
 				max_worker_threads_{max_worker_threads < 1 ? 1 : max_worker_threads}
@@ -208,6 +206,8 @@ namespace ion::parallel
 			*/
 
 			///@brief Sets the max number of worker threads allowed simultaneously, in range [1, ...)
+			///@details Workers are executed by the shared task scheduler, so this only limits how many tasks from this pool are in flight.
+			///It does not change the number of threads used by the scheduler
 			void MaxWorkerThreads(int max_worker_threads) noexcept
 			{
 				std::lock_guard lock{m_};
@@ -347,6 +347,7 @@ namespace ion::parallel
 			}
 
 			///@brief Returns the max number of worker threads allowed simultaneously
+			///@details This is the max number of tasks from this pool in flight, not the number of threads used by the scheduler
 			[[nodiscard]] inline auto MaxWorkerThreads() const noexcept
 			{
 				return max_worker_threads_;
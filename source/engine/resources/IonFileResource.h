@@ -16,6 +16,7 @@ File:	IonFileResource.h
 #include <filesystem>
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "IonResource.h"
 
@@ -29,6 +30,7 @@ namespace ion::resources
 
 			std::string asset_name_;
 			std::optional<std::string> file_data_;
+			std::optional<std::string_view> file_view_;
 			std::optional<std::filesystem::path> file_path_;
 
 		public:
@@ -53,6 +55,16 @@ namespace ion::resources
 			inline void FileData(std::string data, std::filesystem::path path) noexcept
 			{
 				file_data_ = std::move(data);
+				file_view_.reset();
+				file_path_ = std::move(path);
+			}
+
+			///@brief Sets the file view of the file resource to the given view with the associated path
+			///@details The view is not owned, and must be valid until the file data is reset
+			inline void FileView(std::string_view view, std::filesystem::path path) noexcept
+			{
+				file_data_.reset();
+				file_view_ = view;
 				file_path_ = std::move(path);
 			}
 
@@ -60,6 +72,7 @@ namespace ion::resources
 			inline void ResetFileData() noexcept
 			{
 				file_data_.reset();
+				file_view_.reset();
 			}
 
 			///@}
@@ -83,6 +96,18 @@ namespace ion::resources
 				return file_data_;
 			}
 
+			///@brief Returns a view of the file data of the file resource, owned or not
+			///@details Returns nullopt if the file resource has not been prepared yet, or is no longer needed (fully loaded or has failed)
+			[[nodiscard]] inline auto FileBytes() const noexcept -> std::optional<std::string_view>
+			{
+				if (file_view_)
+					return file_view_;
+				else if (file_data_)
+					return *file_data_;
+				else
+					return {};
+			}
+
 			///@brief Returns the file path of the file resource
 			///@details Returns nullopt if the file resource has not been prepared yet
 			[[nodiscard]] inline auto& FilePath() const noexcept
@@ -42,6 +42,19 @@ namespace ion::resources
 
 			return {};
 		}
+
+		template <typename RepositoriesT>
+		inline auto file_view_from_resource_name(const RepositoriesT &repositories, std::string_view resource_name) noexcept ->
+			std::optional<std::pair<std::string_view, std::filesystem::path>>
+		{
+			for (auto &repository : repositories)
+			{
+				if (auto file_view = repository.FileView(resource_name); file_view)
+					return std::pair{*file_view, std::move(*repository.FilePath(resource_name))};
+			}
+
+			return {};
+		}
 	} //file_resource_manager::detail
 
 
@@ -77,6 +90,29 @@ namespace ion::resources
 					return false;
 			}
 
+			///@brief Prepares the given resource with a view of its file data, if stored in a memory mapped data file (zero-copy)
+			///@details Falls back to preparing the resource with a copy of its file data.
+			///Use FileBytes to access the file data, since FileData is nullopt for viewed resources
+			bool PrepareResourceView(ResourceT &resource)
+			{
+				if (auto file = file_resource_manager::detail::file_view_from_resource_name(Repositories(), resource.AssetName()); file)
+				{
+					auto &[view, path] = *file;
+					resource.FileView(view, std::move(path));
+					return true;
+				}
+				else
+					return FileResourceManager::PrepareResource(resource);
+			}
+
+			///@brief See ResourceManager::ResourceSize for more details
+			///@details Returns the size of the file data, if prepared
+			virtual std::size_t ResourceSize(const ResourceT &resource) const noexcept override
+			{
+				auto file_bytes = resource.FileBytes();
+				return file_bytes ? std::size(*file_bytes) : 0;
+			}
+
 
 			///@brief See ResourceManager::ResourcePrepared for more details
 			virtual void ResourcePrepared(ResourceT&) noexcept override
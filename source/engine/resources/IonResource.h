@@ -13,7 +13,10 @@ File:	IonResource.h
 #ifndef ION_RESOURCE_H
 #define ION_RESOURCE_H
 
+#include <cstddef>
+
 #include "managed/IonManagedObject.h"
+#include "types/IonTypes.h"
 
 namespace ion::resources
 {
@@ -57,6 +60,9 @@ namespace ion::resources
 
 			resource::LoadingState loading_state_ = resource::LoadingState::Unloaded;
 			resource::LoadingAction loading_action_ = resource::LoadingAction::Unload;
+			int loading_priority_ = 0;
+			std::size_t resident_size_ = 0;
+			uint64 last_used_frame_ = 0;
 
 		public:
 
@@ -74,6 +80,28 @@ namespace ion::resources
 				loading_state_ = loading_state;
 			}
 
+			///@brief Sets the loading priority of the resource to the given priority
+			///@details Pending resources with a higher priority are prepared, loaded and unloaded first.
+			///Use ResourceManager::Prioritize to reorder a resource that is already pending immediately
+			inline void LoadingPriority(int priority) noexcept
+			{
+				loading_priority_ = priority;
+			}
+
+			///@brief Sets the resident size (in bytes) of the resource to the given size
+			///@details Is set by the owning resource manager when the resource has been loaded
+			inline void ResidentSize(std::size_t size) noexcept
+			{
+				resident_size_ = size;
+			}
+
+			///@brief Sets the last frame this resource was used to the given frame
+			///@details Is set by the owning resource manager when the resource is used
+			inline void LastUsedFrame(uint64 frame) noexcept
+			{
+				last_used_frame_ = frame;
+			}
+
 			///@}
 
 			/**
@@ -93,6 +121,25 @@ namespace ion::resources
 				return loading_action_;
 			}
 
+			///@brief Returns the loading priority of the resource
+			[[nodiscard]] inline auto LoadingPriority() const noexcept
+			{
+				return loading_priority_;
+			}
+
+			///@brief Returns the resident size (in bytes) of the resource
+			///@details Returns 0 if the resource is not loaded
+			[[nodiscard]] inline auto ResidentSize() const noexcept
+			{
+				return resident_size_;
+			}
+
+			///@brief Returns the last frame this resource was used
+			[[nodiscard]] inline auto LastUsedFrame() const noexcept
+			{
+				return last_used_frame_;
+			}
+
 			///@}
 
 			/**
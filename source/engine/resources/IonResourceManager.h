@@ -13,10 +13,13 @@ File:	IonResourceManager.h
 #ifndef ION_RESOURCE_MANAGER_H
 #define ION_RESOURCE_MANAGER_H
 
+#include <algorithm>
+#include <array>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include "IonResource.h"
 #include "events/IonListenable.h"
@@ -24,6 +27,7 @@ File:	IonResourceManager.h
 #include "managed/IonObjectManager.h"
 #include "memory/IonNonOwningPtr.h"
 #include "parallel/IonWorkerPool.h"
+#include "timers/IonStopwatch.h"
 #include "types/IonProgress.h"
 #include "types/IonTypes.h"
 
@@ -42,6 +46,48 @@ namespace ion::resources
 			Eager,
 			Lazy
 		};
+
+
+		namespace detail
+		{
+			template <typename T>
+			struct pending_resource final
+			{
+				T *resource = nullptr;
+				int priority = 0;
+				uint64 sequence = 0; //In order of arrival
+			};
+
+			template <typename T>
+			using pending_queue = std::vector<pending_resource<T>>; //Binary heap
+
+			constexpr auto loading_state_count = static_cast<int>(resource::LoadingState::Failed) + 1;
+
+
+			template <typename T>
+			inline auto pending_resource_less(const pending_resource<T> &x, const pending_resource<T> &y) noexcept
+			{
+				//Highest priority first, then first in first out
+				return x.priority < y.priority ||
+					(x.priority == y.priority && x.sequence > y.sequence);
+			}
+
+			template <typename T>
+			inline void push_pending_resource(pending_queue<T> &queue, pending_resource<T> pending) noexcept
+			{
+				queue.push_back(pending);
+				std::push_heap(std::begin(queue), std::end(queue), pending_resource_less<T>);
+			}
+
+			template <typename T>
+			inline auto pop_pending_resource(pending_queue<T> &queue) noexcept
+			{
+				std::pop_heap(std::begin(queue), std::end(queue), pending_resource_less<T>);
+				auto pending = queue.back();
+				queue.pop_back();
+				return pending;
+			}
+		} //detail
 	} //resource_manager
 
 
@@ -56,6 +102,22 @@ namespace ion::resources
 			parallel::WorkerPool<bool, ResourceT*> processes_;
 			resource_manager::ExecutionModel process_execution_model_ = resource_manager::ExecutionModel::Asynchronous;
 			std::optional<int> max_load_processes_;
+			std::optional<duration> max_load_time_;
+			std::optional<std::size_t> max_load_size_;
+			std::optional<int> max_pending_loads_;
+			std::optional<std::size_t> max_resident_size_;
+			std::size_t resident_size_ = 0;
+			std::size_t resident_count_ = 0; //Number of resources with a resident size
+			std::array<std::size_t, 2> used_resident_counts_{}; //Number of resident resources last used in the previous and current frame
+			uint64 frame_ = 0;
+
+			resource_manager::detail::pending_queue<ResourceT> prepare_queue_;
+			resource_manager::detail::pending_queue<ResourceT> load_queue_;
+			resource_manager::detail::pending_queue<ResourceT> unload_queue_;
+			uint64 pending_sequence_ = 0;
+
+			std::array<int, resource_manager::detail::loading_state_count> loading_state_counts_{};
+			std::vector<ResourceT*> removed_resources_;
 
 		protected:
 
@@ -64,6 +126,13 @@ namespace ion::resources
 				@{
 			*/
 
+			///@brief See ObjectManager::Created for more details
+			void Created(ResourceT &resource) noexcept override
+			{
+				++loading_state_counts_[static_cast<int>(resource.LoadingState())];
+				Enqueue(resource); //Could be adopted while pending
+			}
+
 			///@brief See ObjectManager::Removed for more details
 			void Removed(ResourceT &resource) noexcept override
 			{
@@ -72,6 +141,31 @@ namespace ion::resources
 					[[maybe_unused]] auto result = processes_.Get(&resource); //Blocking
 
 				Unload(resource); //Eagerly
+
+				--loading_state_counts_[static_cast<int>(resource.LoadingState())];
+				removed_resources_.push_back(&resource);
+					//Erased from pending queues when removal has ended
+			}
+
+			///@brief See ObjectManager::RemovalEnded for more details
+			void RemovalEnded() noexcept override
+			{
+				if (std::empty(removed_resources_))
+					return;
+
+				std::sort(std::begin(removed_resources_), std::end(removed_resources_));
+
+				for (auto queue : {&prepare_queue_, &load_queue_, &unload_queue_})
+				{
+					if (std::erase_if(*queue,
+						[&](auto &pending) noexcept
+						{
+							return std::binary_search(std::begin(removed_resources_), std::end(removed_resources_), pending.resource);
+						}) > 0)
+						std::make_heap(std::begin(*queue), std::end(*queue), resource_manager::detail::pending_resource_less<ResourceT>);
+				}
+
+				removed_resources_.clear();
 			}
 
 
@@ -87,6 +181,18 @@ namespace ion::resources
 				return nullptr;
 			}
 
+			virtual std::size_t ResourceSize(const ResourceT&) const noexcept
+			{
+				//Optional to override
+				return 0; //Size in bytes, used for budgeting
+			}
+
+			virtual bool EvictableResource(const ResourceT&) const noexcept
+			{
+				//Optional to override
+				return true;
+			}
+
 			virtual bool LoadResource(ResourceT&) = 0;
 			virtual bool UnloadResource(ResourceT&) noexcept = 0;
 
@@ -175,16 +281,142 @@ namespace ion::resources
 
 		private:
 
+			auto PendingQueue(resource::LoadingState loading_state) noexcept -> resource_manager::detail::pending_queue<ResourceT>*
+			{
+				switch (loading_state)
+				{
+					case resource::LoadingState::PreparePending:
+					return &prepare_queue_;
+
+					case resource::LoadingState::LoadPending:
+					return &load_queue_;
+
+					case resource::LoadingState::UnloadPending:
+					return &unload_queue_;
+
+					default:
+					return nullptr;
+				}
+			}
+
+			void Enqueue(ResourceT &resource) noexcept
+			{
+				if (auto queue = PendingQueue(resource.LoadingState()); queue)
+					resource_manager::detail::push_pending_resource(*queue,
+						{&resource, resource.LoadingPriority(), pending_sequence_++});
+			}
+
+			auto Dequeue(resource::LoadingState loading_state) noexcept -> ResourceT*
+			{
+				auto &queue = *PendingQueue(loading_state);
+
+				while (!std::empty(queue))
+				{
+					auto pending = resource_manager::detail::pop_pending_resource(queue);
+
+					//Skip stale entries (resource is no longer pending)
+					if (pending.resource->LoadingState() != loading_state)
+						continue;
+
+					//Priority has changed, reorder
+					if (pending.priority != pending.resource->LoadingPriority())
+					{
+						pending.priority = pending.resource->LoadingPriority();
+						resource_manager::detail::push_pending_resource(queue, pending);
+						continue;
+					}
+
+					return pending.resource;
+				}
+
+				return nullptr;
+			}
+
+
+			void LoadingStateChanged(ResourceT &resource, resource::LoadingState previous_loading_state) noexcept
+			{
+				if (resource.LoadingState() != previous_loading_state)
+				{
+					--loading_state_counts_[static_cast<int>(previous_loading_state)];
+					++loading_state_counts_[static_cast<int>(resource.LoadingState())];
+					Enqueue(resource);
+				}
+			}
+
 			void ChangeResourceLoadingState(ResourceT &resource, resource::LoadingState loading_state) noexcept
 			{
-				if (resource.LoadingState() != loading_state)
+				if (auto previous_loading_state = resource.LoadingState(); previous_loading_state != loading_state)
 				{
 					resource.LoadingState(loading_state);
+					LoadingStateChanged(resource, previous_loading_state);
 					NotifyResourceLoadingStateChanged(resource);
 				}
 			}
 
 
+			template <typename... T>
+			auto ResourcesIn(T... loading_states) const noexcept
+			{
+				return (loading_state_counts_[static_cast<int>(loading_states)] + ...);
+			}
+
+			std::size_t* UsedResidentCount(const ResourceT &resource) noexcept
+			{
+				if (resource.ResidentSize() > 0)
+				{
+					if (resource.LastUsedFrame() == frame_)
+						return &used_resident_counts_[1];
+					else if (resource.LastUsedFrame() + 1 == frame_)
+						return &used_resident_counts_[0];
+				}
+
+				return nullptr;
+			}
+
+			void ResidentSizeChanged(ResourceT &resource, std::size_t size) noexcept
+			{
+				if (auto count = UsedResidentCount(resource); count)
+					--*count;
+				if (resource.ResidentSize() > 0)
+					--resident_count_;
+
+				resident_size_ = resident_size_ - resource.ResidentSize() + size;
+				resource.ResidentSize(size);
+
+				if (resource.ResidentSize() > 0)
+					++resident_count_;
+				if (auto count = UsedResidentCount(resource); count)
+					++*count;
+			}
+
+			void ResourceUsed(ResourceT &resource) noexcept
+			{
+				if (auto count = UsedResidentCount(resource); count)
+					--*count;
+
+				resource.LastUsedFrame(frame_);
+
+				if (auto count = UsedResidentCount(resource); count)
+					++*count;
+			}
+
+			auto WithinPendingLoads() const noexcept
+			{
+				return !max_pending_loads_ ||
+					ResourcesIn(resource::LoadingState::Preparing, resource::LoadingState::LoadPending) < *max_pending_loads_;
+			}
+
+			auto WithinLoadBudget(const timers::Stopwatch &stopwatch, std::size_t size) const noexcept
+			{
+				//No budget, one at a time
+				if (!max_load_time_ && !max_load_size_)
+					return false;
+
+				return (!max_load_time_ || stopwatch.Elapsed() < *max_load_time_) &&
+					(!max_load_size_ || size < *max_load_size_);
+			}
+
+
 			void ProcessPreparedResource(ResourceT &resource, bool prepared) noexcept
 			{
 				if (prepared)
@@ -208,15 +440,8 @@ namespace ion::resources
 				auto result = processes_.Get(parallel::worker_pool::Synchronization::NonBlocking);
 
 				//Some resources are done preparing
-				if (!std::empty(result))
-				{
-					for (auto &resource : Resources())
-					{
-						//Check if resource was prepared
-						if (auto iter = result.find(&resource); iter != std::end(result))
-							ProcessPreparedResource(resource, iter->second);
-					}
-				}
+				for (auto [resource, prepared] : result)
+					ProcessPreparedResource(*resource, prepared);
 			}
 
 
@@ -255,13 +480,33 @@ namespace ion::resources
 					if (strategy == resource_manager::EvaluationStrategy::Eager)
 						Load(*dependent_resource);
 					else //Lazy
+					{
+						//Dependency has been unloaded (or evicted), load it back in
+						if (dependent_resource->IsUnloaded())
+							Load(*dependent_resource, resource_manager::EvaluationStrategy::Lazy);
+
+						//Dependency may be held back by the pending loads limit (filled by resources waiting for it),
+						//always let it through so that waiting resources can be resolved
+						if (dependent_resource->LoadingState() == resource::LoadingState::PreparePending)
+						{
+							NotifyResourceLoadingStateChanged(*dependent_resource);
+								//Make sure to notify the pending state (in case someone is listening)
+							ExecutePrepareResource(*dependent_resource, process_execution_model_);
+						}
+
 						return; //Wait for the dependency to be resolved
+					}
 				}
 
 				ChangeResourceLoadingState(resource, resource::LoadingState::Loading);
 
 				if (LoadResource(resource))
+				{
+					ResidentSizeChanged(resource, ResourceSize(resource));
+					ResourceUsed(resource);
+						//Must be done before notifying, in case data is released when loaded
 					ChangeResourceLoadingState(resource, resource::LoadingState::Loaded);
+				}
 				else
 					ChangeResourceLoadingState(resource, resource::LoadingState::Failed);
 			}
@@ -269,6 +514,7 @@ namespace ion::resources
 			void ExecuteUnloadResource(ResourceT &resource) noexcept
 			{
 				ChangeResourceLoadingState(resource, resource::LoadingState::Unloading);
+				ResidentSizeChanged(resource, 0);
 				
 				if (UnloadResource(resource))
 				{
@@ -290,19 +536,23 @@ namespace ion::resources
 
 			void PreparePendingResources(resource_manager::ExecutionModel execution_model = resource_manager::ExecutionModel::Asynchronous)
 			{
-				//Check if any resources needs preparing
-				for (auto &resource : Resources())
+				auto stopwatch = timers::Stopwatch::StartNew();
+
+				//Prepare pending resources, in order of priority
+				while (WithinPendingLoads())
 				{
-					//Prepare
-					if (resource.LoadingState() == resource::LoadingState::PreparePending)
-					{
-						NotifyResourceLoadingStateChanged(resource);
-							//Make sure to notify the pending state (in case someone is listening)
-						ExecutePrepareResource(resource, execution_model);
+					auto resource = Dequeue(resource::LoadingState::PreparePending);
 
-						if (execution_model == resource_manager::ExecutionModel::Synchronous)
-							break; //One at a time
-					}
+					if (!resource)
+						break;
+
+					NotifyResourceLoadingStateChanged(*resource);
+						//Make sure to notify the pending state (in case someone is listening)
+					ExecutePrepareResource(*resource, execution_model);
+
+					if (execution_model == resource_manager::ExecutionModel::Synchronous &&
+						!WithinLoadBudget(stopwatch, 0))
+						break; //Within budget (or one at a time)
 				}
 
 				ProcessPreparedResources();
@@ -311,41 +561,92 @@ namespace ion::resources
 
 			void LoadPendingResources()
 			{
-				//Check if any resources needs loading
-				for (auto &resource : Resources())
+				auto stopwatch = timers::Stopwatch::StartNew();
+				auto size = std::size_t{0};
+				std::vector<ResourceT*> waiting_resources;
+
+				//Load pending resources, in order of priority
+				while (auto resource = Dequeue(resource::LoadingState::LoadPending))
 				{
-					//Load
-					if (resource.LoadingState() == resource::LoadingState::LoadPending)
-					{
-						NotifyResourceLoadingStateChanged(resource);
-							//Make sure to notify the pending state (in case someone is listening)
-						ExecuteLoadResource(resource, resource_manager::EvaluationStrategy::Lazy);
-						break; //One at a time
-					}
+					NotifyResourceLoadingStateChanged(*resource);
+						//Make sure to notify the pending state (in case someone is listening)
+					size += ResourceSize(*resource);
+					ExecuteLoadResource(*resource, resource_manager::EvaluationStrategy::Lazy);
+
+					//Waiting for a dependency to be resolved
+					if (resource->LoadingState() == resource::LoadingState::LoadPending)
+						waiting_resources.push_back(resource);
+
+					if (!WithinLoadBudget(stopwatch, size))
+						break; //Within budget (or one at a time)
 				}
+
+				//Try again next update
+				for (auto resource : waiting_resources)
+					Enqueue(*resource);
 			}
 
 			void UnloadPendingResources() noexcept
 			{
-				//Check if any resources needs unloading
+				auto stopwatch = timers::Stopwatch::StartNew();
+
+				//Unload pending resources, in order of priority
+				while (auto resource = Dequeue(resource::LoadingState::UnloadPending))
+				{
+					NotifyResourceLoadingStateChanged(*resource);
+						//Make sure to notify the pending state (in case someone is listening)
+					ExecuteUnloadResource(*resource);
+
+					if (!WithinLoadBudget(stopwatch, 0))
+						break; //Within budget (or one at a time)
+				}
+			}
+
+			void EvictResources() noexcept
+			{
+				if (!max_resident_size_ || resident_size_ <= *max_resident_size_)
+					return;
+
+				//All resident resources have been used since the previous update
+				//Nothing can be evicted, skip scanning through all resources
+				if (used_resident_counts_[0] + used_resident_counts_[1] >= resident_count_)
+					return;
+
+				std::vector<ResourceT*> resources;
+
 				for (auto &resource : Resources())
 				{
-					//Unload
-					if (resource.LoadingState() == resource::LoadingState::UnloadPending)
+					//Resources used since the previous update are still in use
+					if (resource.IsLoaded() && resource.ResidentSize() > 0 &&
+						resource.LastUsedFrame() + 1 < frame_ && EvictableResource(resource))
+						resources.push_back(&resource);
+				}
+
+				//Least recently used first
+				std::stable_sort(std::begin(resources), std::end(resources),
+					[](auto x, auto y) noexcept
 					{
-						NotifyResourceLoadingStateChanged(resource);
-							//Make sure to notify the pending state (in case someone is listening)
-						ExecuteUnloadResource(resource);
-						break; //One at a time
-					}
+						return x->LastUsedFrame() < y->LastUsedFrame();
+					});
+
+				for (auto resource : resources)
+				{
+					if (resident_size_ <= *max_resident_size_)
+						break; //Within budget
+
+					Unload(*resource); //Eagerly
 				}
 			}
 
 			void UpdatePendingResources(resource_manager::ExecutionModel execution_model = resource_manager::ExecutionModel::Asynchronous) noexcept
 			{
+				++frame_;
+				used_resident_counts_ = {used_resident_counts_[1], 0};
+
 				PreparePendingResources(execution_model);
 				LoadPendingResources();
 				UnloadPendingResources();
+				EvictResources();
 			}
 
 		public:
@@ -396,6 +697,40 @@ namespace ion::resources
 					processes_.MaxWorkerThreads(parallel::worker_pool::detail::default_number_of_threads());
 			}
 
+			///@brief Sets the max time the resource manager is allowed to spend on loading (and unloading) resources each update
+			///@details If nullopt is passed, there is no time budget.
+			///If no budget is set at all, one resource is loaded (and unloaded) each update
+			inline void MaxLoadTime(std::optional<duration> max_load_time) noexcept
+			{
+				max_load_time_ = max_load_time;
+			}
+
+			///@brief Sets the max size (in bytes) the resource manager is allowed to load each update
+			///@details If nullopt is passed, there is no size budget.
+			///If no budget is set at all, one resource is loaded (and unloaded) each update
+			inline void MaxLoadSize(std::optional<std::size_t> max_load_size) noexcept
+			{
+				max_load_size_ = max_load_size;
+			}
+
+			///@brief Sets the max number of resources that can be preparing or waiting to be loaded at once
+			///@details Pending resources are not prepared while this limit is reached, which bounds the memory used by prepared data.
+			///Dependencies of resources waiting to be loaded are always prepared, even if the limit is reached.
+			///If nullopt is passed, there is no limit
+			inline void MaxPendingLoads(std::optional<int> max_pending_loads) noexcept
+			{
+				max_pending_loads_ = max_pending_loads;
+			}
+
+			///@brief Sets the max size (in bytes) of all loaded resources in this manager
+			///@details When over budget, the least recently used resources are unloaded each update.
+			///Unloaded resources that are used again (see Use) are loaded back in (lazy).
+			///If nullopt is passed, there is no resident budget
+			inline void MaxResidentSize(std::optional<std::size_t> max_resident_size) noexcept
+			{
+				max_resident_size_ = max_resident_size;
+			}
+
 			///@}
 
 			/**
@@ -416,6 +751,47 @@ namespace ion::resources
 				return max_load_processes_;
 			}
 
+			///@brief Returns the max time the resource manager is allowed to spend on loading (and unloading) resources each update
+			///@details Returns nullopt if there is no time budget
+			[[nodiscard]] inline auto MaxLoadTime() const noexcept
+			{
+				return max_load_time_;
+			}
+
+			///@brief Returns the max size (in bytes) the resource manager is allowed to load each update
+			///@details Returns nullopt if there is no size budget
+			[[nodiscard]] inline auto MaxLoadSize() const noexcept
+			{
+				return max_load_size_;
+			}
+
+			///@brief Returns the max number of resources that can be preparing or waiting to be loaded at once
+			///@details Returns nullopt if there is no limit
+			[[nodiscard]] inline auto MaxPendingLoads() const noexcept
+			{
+				return max_pending_loads_;
+			}
+
+			///@brief Returns the max size (in bytes) of all loaded resources in this manager
+			///@details Returns nullopt if there is no resident budget
+			[[nodiscard]] inline auto MaxResidentSize() const noexcept
+			{
+				return max_resident_size_;
+			}
+
+			///@brief Returns the size (in bytes) of all loaded resources in this manager
+			[[nodiscard]] inline auto ResidentSize() const noexcept
+			{
+				return resident_size_;
+			}
+
+			///@brief Returns the current frame of this manager
+			///@details The frame is advanced once each update
+			[[nodiscard]] inline auto Frame() const noexcept
+			{
+				return frame_;
+			}
+
 			///@}
 
 			/**
@@ -447,24 +823,13 @@ namespace ion::resources
 			///@brief Returns the number of resources that are waiting to be updated
 			[[nodiscard]] auto ResourcesToUpdate() const noexcept
 			{
-				auto count = 0;
-
-				for (auto &resource : Resources())
-				{
-					switch (resource.LoadingState())
-					{
-						case resource::LoadingState::PreparePending:	
-						case resource::LoadingState::LoadPending:
-						case resource::LoadingState::UnloadPending:
-						case resource::LoadingState::Preparing:
-						case resource::LoadingState::Loading:
-						case resource::LoadingState::Unloading:
-						++count;
-						break;
-					}
-				}
-
-				return count;
+				return ResourcesIn(
+					resource::LoadingState::PreparePending,
+					resource::LoadingState::LoadPending,
+					resource::LoadingState::UnloadPending,
+					resource::LoadingState::Preparing,
+					resource::LoadingState::Loading,
+					resource::LoadingState::Unloading);
 			}
 
 			///@brief Updates all resources that is in a pending state (non-blocking)
@@ -490,6 +855,53 @@ namespace ion::resources
 
 			///@}
 
+			/**
+				@name Prioritizing
+				@{
+			*/
+
+			///@brief Sets the loading priority of the given resource to the given priority
+			///@details Pending resources with a higher priority are prepared, loaded and unloaded first.
+			///If the resource is already pending, it is reordered immediately (useful for resources that are visible soon)
+			auto Prioritize(ResourceT &resource, int priority) noexcept
+			{
+				if (resource.Owner() != this)
+					return false;
+
+				if (resource.LoadingPriority() != priority)
+				{
+					resource.LoadingPriority(priority);
+					Enqueue(resource);
+				}
+
+				return true;
+			}
+
+			///@}
+
+			/**
+				@name Using
+				@{
+			*/
+
+			///@brief Marks the given resource as used in the current frame
+			///@details Resources that are used are never unloaded to stay within the max resident size.
+			///If a max resident size is set and the resource is unloaded, it is loaded back in (lazy)
+			auto Use(ResourceT &resource) noexcept
+			{
+				if (resource.Owner() != this)
+					return false;
+
+				ResourceUsed(resource);
+
+				if (max_resident_size_ && resource.IsUnloaded())
+					Load(resource, resource_manager::EvaluationStrategy::Lazy);
+
+				return true;
+			}
+
+			///@}
+
 			/**
 				@name Preparing
 				@{
@@ -510,8 +922,11 @@ namespace ion::resources
 					return resource.IsPrepared();
 				}
 
-				if (auto prepare = resource.Prepare();
-					prepare && strategy == resource_manager::EvaluationStrategy::Eager)
+				auto previous_loading_state = resource.LoadingState();
+				auto prepare = resource.Prepare();
+				LoadingStateChanged(resource, previous_loading_state);
+
+				if (prepare && strategy == resource_manager::EvaluationStrategy::Eager)
 				{
 					NotifyResourceLoadingStateChanged(resource);
 						//Make sure to notify the pending state (in case someone is listening)
@@ -537,20 +952,9 @@ namespace ion::resources
 			///@brief Returns the number of resources that are waiting to be prepared
 			[[nodiscard]] auto ResourcesToPrepare() const noexcept
 			{
-				auto count = 0;
-
-				for (auto &resource : Resources())
-				{
-					switch (resource.LoadingState())
-					{
-						case resource::LoadingState::PreparePending:
-						case resource::LoadingState::Preparing:
-						++count;
-						break;
-					}
-				}
-
-				return count;
+				return ResourcesIn(
+					resource::LoadingState::PreparePending,
+					resource::LoadingState::Preparing);
 			}
 
 			///@brief Prepares all resources that is in a pending state (non-blocking)
@@ -593,8 +997,11 @@ namespace ion::resources
 					strategy == resource_manager::EvaluationStrategy::Eager)
 					JoinAsyncResourceProcess(resource);
 
-				if (auto load = resource.Load();
-					load && strategy == resource_manager::EvaluationStrategy::Eager)
+				auto previous_loading_state = resource.LoadingState();
+				auto load = resource.Load();
+				LoadingStateChanged(resource, previous_loading_state);
+
+				if (load && strategy == resource_manager::EvaluationStrategy::Eager)
 				{
 					NotifyResourceLoadingStateChanged(resource);
 						//Make sure to notify the pending state (in case someone is listening)
@@ -626,22 +1033,11 @@ namespace ion::resources
 			///@brief Returns the number of resources that are waiting to be loaded
 			[[nodiscard]] auto ResourcesToLoad() const noexcept
 			{
-				auto count = 0;
-
-				for (auto &resource : Resources())
-				{
-					switch (resource.LoadingState())
-					{
-						case resource::LoadingState::PreparePending:
-						case resource::LoadingState::LoadPending:
-						case resource::LoadingState::Preparing:
-						case resource::LoadingState::Loading:
-						++count;
-						break;
-					}
-				}
-
-				return count;
+				return ResourcesIn(
+					resource::LoadingState::PreparePending,
+					resource::LoadingState::LoadPending,
+					resource::LoadingState::Preparing,
+					resource::LoadingState::Loading);
 			}
 
 			///@brief Loads all resources that is in a pending state (non-blocking)
@@ -681,8 +1077,11 @@ namespace ion::resources
 				if (resource.Owner() != this)
 					return false;
 
-				if (auto unload = resource.Unload();
-					unload && strategy == resource_manager::EvaluationStrategy::Eager)
+				auto previous_loading_state = resource.LoadingState();
+				auto unload = resource.Unload();
+				LoadingStateChanged(resource, previous_loading_state);
+
+				if (unload && strategy == resource_manager::EvaluationStrategy::Eager)
 				{
 					NotifyResourceLoadingStateChanged(resource);
 						//Make sure to notify the pending state (in case someone is listening)
@@ -705,20 +1104,9 @@ namespace ion::resources
 			///@brief Returns the number of resources that are waiting to be unloaded
 			[[nodiscard]] auto ResourcesToUnload() const noexcept
 			{
-				auto count = 0;
-
-				for (auto &resource : Resources())
-				{
-					switch (resource.LoadingState())
-					{
-						case resource::LoadingState::UnloadPending:
-						case resource::LoadingState::Unloading:
-						++count;
-						break;
-					}
-				}
-
-				return count;
+				return ResourcesIn(
+					resource::LoadingState::UnloadPending,
+					resource::LoadingState::Unloading);
 			}
 
 			///@brief Unloads all resources that is in a pending state (non-blocking)
@@ -756,8 +1144,11 @@ namespace ion::resources
 				if (resource.Owner() != this)
 					return false;
 
-				if (auto reload = resource.Reload();
-					reload && strategy == resource_manager::EvaluationStrategy::Eager)
+				auto previous_loading_state = resource.LoadingState();
+				auto reload = resource.Reload();
+				LoadingStateChanged(resource, previous_loading_state);
+
+				if (reload && strategy == resource_manager::EvaluationStrategy::Eager)
 				{
 					NotifyResourceLoadingStateChanged(resource);
 						//Make sure to notify the pending state (in case someone is listening)
@@ -797,8 +1188,11 @@ namespace ion::resources
 				if (resource.Owner() != this)
 					return false;
 
-				if (auto repair = resource.Repair();
-					repair && strategy == resource_manager::EvaluationStrategy::Eager)
+				auto previous_loading_state = resource.LoadingState();
+				auto repair = resource.Repair();
+				LoadingStateChanged(resource, previous_loading_state);
+
+				if (repair && strategy == resource_manager::EvaluationStrategy::Eager)
 				{
 					NotifyResourceLoadingStateChanged(resource);
 						//Make sure to notify the pending state (in case someone is listening)
@@ -828,15 +1222,7 @@ namespace ion::resources
 			///@brief Returns the number of resources that has failed
 			[[nodiscard]] auto ResourcesToRepair() const noexcept
 			{
-				auto count = 0;
-
-				for (auto &resource : Resources())
-				{
-					if (resource.HasFailed())
-						++count;
-				}
-
-				return count;
+				return ResourcesIn(resource::LoadingState::Failed);
 			}
 
 			///@}
@@ -13,6 +13,7 @@ File:	IonScriptCompiler.cpp
 #include "IonScriptCompiler.h"
 
 #include <algorithm>
+#include <random>
 
 #include "IonScriptTypes.h"
 #include "graphics/utilities/IonColor.h"
@@ -20,9 +21,12 @@ File:	IonScriptCompiler.cpp
 #include "graphics/utilities/IonVector3.h"
 #include "types/IonTypes.h"
 #include "timers/IonStopwatch.h"
+#include "utilities/IonCodec.h"
 #include "utilities/IonConvert.h"
+#include "utilities/IonCrypto.h"
 #include "utilities/IonFileUtility.h"
 #include "utilities/IonParseUtility.h"
+#include "utilities/IonSimd.h"
 #include "utilities/IonStringUtility.h"
 
 namespace ion::script
@@ -79,7 +83,7 @@ build_system::build_system(std::filesystem::path root_path) :
 	//Empty
 }
 
-void build_system::start_process(std::string str, file_trace trace)
+void build_system::start_process(std::string str, file_trace trace, std::string name)
 {
 	auto file_path = trace.current_file_path().string();
 	translation_unit *unit = nullptr;
@@ -88,11 +92,11 @@ void build_system::start_process(std::string str, file_trace trace)
 		std::lock_guard lock{m};
 
 		units.push_back(std::make_unique<translation_unit>(
-			translation_unit{std::move(file_path), std::move(str)}));
+			translation_unit{std::move(file_path), std::move(str), {}, std::move(name)}));
 		unit = units.back().get();
 	}
 
-	auto id = ion::utilities::string::ToLowerCaseCopy(unit->file_path);
+	auto id = unit_id(unit->file_path);
 	processes.RunTask(std::move(id), partial_compile_unit, std::ref(*unit), std::move(trace), std::ref(*this));
 }
 
@@ -208,25 +212,33 @@ std::pair<std::string_view, int> get_comment_lexeme(std::string_view str) noexce
 		if (auto off = str.find("*/", 2); off != std::string_view::npos)
 			str.remove_suffix(std::size(str) - (off + 2));
 		
-		return {str, std::count(std::begin(str), std::end(str), '\n')};
+		return {str, ion::utilities::simd::Count(str, '\n')};
 	}
 }
 
 std::string_view get_hex_literal_lexeme(std::string_view str) noexcept
 {
 	//#<Hexadecimal>
-	if (auto iter = std::find_if(std::begin(str) + 1, std::end(str), std::not_fn(is_hex_digit));
-		iter != std::end(str))
-		str.remove_suffix(std::size(str) - (iter - std::begin(str)));
+	//Same as is_hex_digit, but for a whole pack of characters
+	str.remove_suffix(std::size(str) - ion::utilities::simd::FindFirstNotOf(str, 1,
+		[](auto x) noexcept
+		{
+			return x.InRange('0', '9') | x.InRange('A', 'F') | x.InRange('a', 'f');
+		}));
 
 	return str;
 }
 
 std::string_view get_identifer_lexeme(std::string_view str) noexcept
 {
-	if (auto iter = std::find_if(std::begin(str) + 1, std::end(str), std::not_fn(is_valid_in_identifier));
-		iter != std::end(str))
-		str.remove_suffix(std::size(str) - (iter - std::begin(str)));
+	//Same as is_valid_in_identifier, but for a whole pack of characters
+	str.remove_suffix(std::size(str) - ion::utilities::simd::FindFirstNotOf(str, 1,
+		[](auto x) noexcept
+		{
+			using Pack = decltype(x);
+			return x.InRange('A', 'Z') | x.InRange('a', 'z') | x.InRange('0', '9') |
+				(x == Pack::Broadcast('-')) | (x == Pack::Broadcast('_'));
+		}));
 	
 	return str;
 }
@@ -297,50 +309,74 @@ std::string_view get_numeric_literal_lexeme(std::string_view str) noexcept
 
 std::pair<std::string_view, int> get_string_literal_lexeme(std::string_view str) noexcept
 {
+	auto quote = str.front();
+	auto backtick = quote == '`';
 	auto line_breaks = 0;
-	auto backtick = str.front() == '`';
+	auto escaped = false;
+	auto escaped_cr = false;
 
-	if (auto iter = std::find_if(std::begin(str) + 1, std::end(str),
-		[&, escaped = false, escaped_cr = false](auto c) mutable noexcept
+	//Find next character that can end the literal or change the escape state
+	auto find_special = [&](auto off) noexcept
 		{
-			//Double-quote, single-quote or backtick
-			if (c == str.front())
+			return ion::utilities::simd::FindFirstOf(str, off,
+				[&](auto x) noexcept
+				{
+					using Pack = decltype(x);
+					return (x == Pack::Broadcast(quote)) | (x == Pack::Broadcast('\\')) |
+						(x == Pack::Broadcast('\r')) | (x == Pack::Broadcast('\n'));
+				});
+		};
+
+	for (auto off = find_special(1); off < std::size(str);)
+	{
+		//Double-quote, single-quote or backtick
+		if (str[off] == quote)
+		{
+			if (!escaped)
 			{
-				if (!escaped)
-					return true;
+				str.remove_suffix(std::size(str) - (off + 1));
+				return {str, line_breaks};
 			}
-			else
+
+			escaped = false;
+		}
+		else
+		{
+			switch (str[off])
 			{
-				switch (c)
-				{
-					case '\\': //Backslash
-					escaped = !escaped;
-					return (escaped_cr = false);
+				case '\\': //Backslash
+				escaped = !escaped;
+				escaped_cr = false;
+				break;
 
-					case '\r': //Carriage return
-					escaped_cr = escaped;
-					break;
+				case '\r': //Carriage return
+				escaped_cr = escaped;
+				escaped = false;
+				break;
 
-					case '\n': //Line feed
+				case '\n': //Line feed
+				{
+					if (!escaped && !escaped_cr && !backtick)
 					{
-						if (!escaped && !escaped_cr && !backtick)
-							return true;
-						else
-							++line_breaks;
-
-						[[fallthrough]];
+						str.remove_suffix(std::size(str) - off);
+						return {str, line_breaks};
 					}
-					
-					default:
-					escaped_cr = false;
+
+					++line_breaks;
+					escaped = escaped_cr = false;
 					break;
 				}
 			}
+		}
 
-			return (escaped = false);
-		}); iter != std::end(str))
+		//Skipped characters resets the escape state
+		auto next_off = find_special(off + 1);
 
-		str.remove_suffix(std::size(str) - (iter - std::begin(str) + (*iter != '\n')));
+		if (next_off > off + 1)
+			escaped = escaped_cr = false;
+
+		off = next_off;
+	}
 
 	return {str, line_breaks};
 }
@@ -348,11 +384,15 @@ std::pair<std::string_view, int> get_string_literal_lexeme(std::string_view str)
 std::pair<std::string_view, int> get_white_space_lexeme(std::string_view str) noexcept
 {
 	//White space
-	if (auto iter = std::find_if(std::begin(str) + 1, std::end(str), std::not_fn(is_white_space));
-		iter != std::end(str))
-		str.remove_suffix(std::size(str) - (iter - std::begin(str)));
+	//Same as is_white_space, but for a whole pack of characters
+	str.remove_suffix(std::size(str) - ion::utilities::simd::FindFirstNotOf(str, 1,
+		[](auto x) noexcept
+		{
+			using Pack = decltype(x);
+			return x.InRange('\t', '\v') | (x == Pack::Broadcast('\r')) | (x == Pack::Broadcast(' '));
+		}));
 
-	return {str, std::count(std::begin(str), std::end(str), '\n')};
+	return {str, ion::utilities::simd::Count(str, '\n')};
 }
 
 std::optional<lexical_tokens> lex(translation_unit &unit, file_trace trace, build_system &system)
@@ -514,9 +554,11 @@ std::optional<lexical_tokens> lex(translation_unit &unit, file_trace trace, buil
 				{
 					if (auto result = utilities::parse::AsString(import_argument); result)
 					{
+						auto name = system.repository ? *result : std::string{};
+
 						if (std::string imported_str; import_unit(std::move(*result), system, trace, imported_str, unit.error))
 						{
-							system.start_process(std::move(imported_str), trace);
+							system.start_process(std::move(imported_str), trace, std::move(name));
 							trace.pop_file();
 						}
 						else
@@ -537,6 +579,29 @@ std::optional<lexical_tokens> lex(translation_unit &unit, file_trace trace, buil
 	return tokens;
 }
 
+std::optional<lexical_tokens> lex_unit(translation_unit &unit, file_trace trace, build_system &system)
+{
+	//Reuse tokens from a previous build, if unit has not changed
+	if (system.graph)
+	{
+		if (auto tokens = reuse_unit(unit, trace, system); tokens)
+			return tokens;
+	}
+
+	auto tokens = lex(unit, std::move(trace), system);
+
+	if (tokens)
+	{
+		//Discard unnecessary tokens
+		pre_parse(*tokens);
+
+		if (system.graph)
+			system.graph->Store(make_unit_record(unit, *tokens, system));
+	}
+
+	return tokens;
+}
+
 
 /*
 	Parsing
@@ -1158,7 +1223,7 @@ void link(lexical_tokens &tokens, const adaptors::FlatMap<std::string, std::opti
 		{
 			auto file_path = utilities::parse::AsString((iter + 1)->value);
 			auto full_path = *full_file_path(*file_path, system, std::filesystem::path{token.unit->file_path}.parent_path());
-			auto id = ion::utilities::string::ToLowerCaseCopy(full_path.lexically_normal().string());
+			auto id = unit_id(full_path.string());
 
 			if (auto it = results.find(id); it != std::end(results))
 			{
@@ -2364,7 +2429,7 @@ std::optional<ScriptTree> compile(file_trace trace, build_system &system, Compil
 
 std::optional<ScriptTree> compile_unit(translation_unit &unit, file_trace trace, build_system &system)
 {
-	auto tokens = lex(unit, std::move(trace), system);
+	auto tokens = lex_unit(unit, std::move(trace), system);
 	auto result = tokens ? parse(std::move(*tokens), system, unit.error) : std::nullopt;
 	system.processes.Wait(); //Make sure all external compilations are completed
 	return result;
@@ -2372,18 +2437,283 @@ std::optional<ScriptTree> compile_unit(translation_unit &unit, file_trace trace,
 
 std::optional<lexical_tokens> partial_compile_unit(translation_unit &unit, file_trace trace, build_system &system)
 {
-	auto tokens = lex(unit, std::move(trace), system);
+	auto tokens = lex_unit(unit, std::move(trace), system);
 
+	//Syntax error checking
 	if (tokens)
+		check_syntax(*tokens, unit.error);
+
+	return {unit.error ? std::nullopt : std::move(tokens)};
+}
+
+
+/*
+	Caching
+*/
+
+std::string hash_source(std::string_view source)
+{
+	return ion::utilities::crypto::SHA3_256(source);
+}
+
+std::optional<std::string> hash_unit(const translation_unit &unit, const build_system &system)
+{
+	//Hash the current source of the unit, not the source it was compiled from
+	if (system.repository)
 	{
-		//Discard unnecessary tokens
-		pre_parse(*tokens);
+		if (auto data = system.repository->FileData(unit.name); data)
+			return hash_source(*data);
+	}
+	else if (std::string data; ion::utilities::file::Load(unit.file_path, data, ion::utilities::file::FileLoadMode::Binary))
+		return hash_source(data);
 
-		//Syntax error checking
-		check_syntax(*tokens, unit.error);
+	return {};
+}
+
+std::string cache_key(const translation_unit &entry_unit, const build_system &system)
+{
+	return ion::utilities::codec::EncodeToHex(
+		hash_source(ion::utilities::string::Concat(
+			cache_format_version, "\n",
+			system.repository ? "<repository>"s : system.root_path.lexically_normal().generic_string(), "\n",
+			entry_unit.file_path, "\n",
+			entry_unit.source)));
+}
+
+std::optional<ScriptTree> load_from_cache(const std::filesystem::path &file_path,
+	const build_system &system, CompileError &error, std::vector<CompileError> &errors)
+{
+	std::string data;
+	if (!ion::utilities::file::Load(file_path, data, ion::utilities::file::FileLoadMode::Binary))
+		return {};
+
+	auto bytes = std::string_view{data};
+	auto read = [&](auto &value)
+		{
+			auto size = script_tree::detail::deserialize_value(bytes, value);
+			bytes.remove_prefix(size);
+			return size > 0;
+		};
+
+	std::string version;
+	size_t count = 0;
+
+	if (!read(version) || version != cache_format_version || !read(count))
+		return {};
+
+	std::vector<std::filesystem::path> file_paths;
+	file_paths.reserve(count);
+
+	for (auto i = size_t{0}; i < count; ++i)
+	{
+		translation_unit unit;
+		std::string hash;
+
+		if (!read(unit.file_path) || !read(unit.name) || !read(hash))
+			return {};
+
+		//Imported unit has changed (or is missing) since it was cached
+		//The entry unit (without hash) is part of the cache key
+		if (!std::empty(hash) && hash_unit(unit, system) != hash)
+			return {};
+
+		file_paths.push_back(std::move(unit.file_path));
 	}
 
-	return {unit.error ? std::nullopt : std::move(tokens)};
+	auto tree = ScriptTree::Deserialize(bytes);
+
+	if (tree)
+	{
+		for (auto &path : file_paths)
+			errors.emplace_back().FilePath = std::move(path);
+
+		if (!std::empty(errors))
+			error.FilePath = errors.front().FilePath;
+	}
+
+	return tree;
+}
+
+bool save_to_cache(const std::filesystem::path &file_path, const ScriptTree &tree, const build_system &system)
+{
+	std::vector<std::byte> bytes;
+	script_tree::detail::serialize_value(std::string{cache_format_version}, bytes);
+	script_tree::detail::serialize_value(std::size(system.units), bytes);
+
+	for (auto &unit : system.units)
+	{
+		script_tree::detail::serialize_value(unit->file_path, bytes);
+		script_tree::detail::serialize_value(unit->name, bytes);
+		script_tree::detail::serialize_value(
+			unit != system.units.front() ? hash_source(unit->source) : ""s, bytes);
+	}
+
+	auto tree_bytes = tree.Serialize();
+	bytes.insert(std::end(bytes), std::begin(tree_bytes), std::end(tree_bytes));
+
+	if (!ion::utilities::file::IsDirectory(file_path.parent_path()) &&
+		!ion::utilities::file::CreateDirectories(file_path.parent_path()))
+		return false;
+
+	//Save to a unique temporary file first, then rename it
+	//This makes sure that concurrent compilers never reads a partially written cache file
+	auto temp_file_path = file_path;
+	temp_file_path += ion::utilities::string::Concat(".", std::random_device{}(), ".tmp");
+
+	if (ion::utilities::file::Save(temp_file_path,
+			std::string_view{reinterpret_cast<const char*>(std::data(bytes)), std::size(bytes)},
+			ion::utilities::file::FileSaveMode::Binary) &&
+		ion::utilities::file::Rename(temp_file_path, file_path))
+		return true;
+
+	ion::utilities::file::Remove(temp_file_path);
+	return false;
+}
+
+std::optional<ScriptTree> cached_compile(const std::filesystem::path &cache_path, file_trace trace,
+	build_system &system, CompileError &error, std::vector<CompileError> &errors, bool &cache_hit)
+{
+	auto file_path = cache_path / ion::utilities::string::Concat(cache_key(*system.units.front(), system), cache_file_extension);
+
+	if (auto tree = load_from_cache(file_path, system, error, errors); tree)
+	{
+		cache_hit = true;
+		return tree;
+	}
+
+	auto tree = compile(std::move(trace), system, error, errors);
+
+	//Only cache successful compilations
+	if (tree && !error)
+		save_to_cache(file_path, *tree, system);
+
+	return tree;
+}
+
+
+/*
+	Incremental building
+*/
+
+std::string unit_id(std::string_view file_path)
+{
+	auto id = std::filesystem::path{file_path}.lexically_normal().string();
+
+	#ifdef _WIN32
+	//File paths are case insensitive
+	ion::utilities::string::ToLowerCase(id);
+	#endif
+
+	return id;
+}
+
+std::optional<std::filesystem::file_time_type> write_time(const std::filesystem::path &file_path) noexcept
+{
+	std::error_code error;
+	auto time = std::filesystem::last_write_time(file_path, error);
+	return !error ? std::make_optional(time) : std::nullopt;
+}
+
+
+unit_record make_unit_record(const translation_unit &unit, const lexical_tokens &tokens, const build_system &system)
+{
+	//Copy unit, so that its source outlives the build system
+	auto shared_unit = std::make_shared<translation_unit>(translation_unit{unit.file_path, unit.source, {}, unit.name});
+	auto record = unit_record{shared_unit, tokens};
+	auto scope_depth = 0;
+
+	//Rebase all tokens to view the copied source
+	for (auto &token : record.tokens)
+	{
+		token.value = {std::data(shared_unit->source) + (std::data(token.value) - std::data(unit.source)), std::size(token.value)};
+		token.unit = shared_unit.get();
+	}
+
+	for (auto iter = std::begin(record.tokens), end = std::end(record.tokens); iter != end; ++iter)
+	{
+		if (iter->name == token_name::Separator)
+		{
+			switch (iter->value.front())
+			{
+				case '{':
+				++scope_depth;
+				break;
+
+				case '}':
+				--scope_depth;
+				break;
+			}
+		}
+		//Template selector classes (global scope)
+		else if (iter->name == token_name::Identifier && scope_depth == 0 &&
+				 is_class_identifier(iter->value))
+			record.selectors.emplace(iter->value);
+
+		//@import "argument";
+		else if (iter->name == token_name::Rule && is_import_rule(iter->value) &&
+				 end - iter > 2 && (iter + 1)->name == token_name::StringLiteral &&
+				 (iter + 2)->name == token_name::Separator && (iter + 2)->value.front() == ';')
+		{
+			if (auto file_path = utilities::parse::AsString((iter + 1)->value); file_path)
+			{
+				if (auto full_path = full_file_path(*file_path, system, std::filesystem::path{unit.file_path}.parent_path()); full_path)
+					record.imports.push_back(unit_id(full_path->lexically_normal().string()));
+			}
+		}
+	}
+
+	record.write_time = write_time(unit.file_path);
+	return record;
+}
+
+std::optional<lexical_tokens> reuse_unit(translation_unit &unit, file_trace trace, build_system &system)
+{
+	auto record = system.graph->Find(unit);
+
+	if (!record)
+		return {};
+
+	struct imported_unit
+	{
+		std::string str;
+		file_trace trace;
+		std::string name;
+	};
+	std::vector<imported_unit> imported_units;
+
+	//Load all imported units first, so that nothing is started if an import fails
+	for (auto iter = std::begin(record->tokens), end = std::end(record->tokens); iter != end; ++iter)
+	{
+		//@import "argument";
+		if (iter->name == token_name::Rule && is_import_rule(iter->value) &&
+			end - iter > 2 && (iter + 1)->name == token_name::StringLiteral &&
+			(iter + 2)->name == token_name::Separator && (iter + 2)->value.front() == ';')
+		{
+			if (auto result = utilities::parse::AsString((iter + 1)->value); result)
+			{
+				auto name = system.repository ? *result : std::string{};
+				CompileError error;
+
+				if (std::string imported_str; import_unit(std::move(*result), system, trace, imported_str, error))
+				{
+					imported_units.push_back({std::move(imported_str), trace, std::move(name)});
+					trace.pop_file();
+				}
+				else
+					return {}; //Lex unit again, to report the error
+			}
+		}
+	}
+
+	{
+		std::lock_guard lock{system.m};
+		system.reused_units.push_back(record->unit);
+	}
+
+	for (auto &imported : imported_units)
+		system.start_process(std::move(imported.str), std::move(imported.trace), std::move(imported.name));
+
+	return std::move(record->tokens);
 }
 
 
@@ -2449,6 +2779,187 @@ std::string print_output(duration compile_time, const std::vector<CompileError>
 } //script_compiler::detail
 
 
+namespace script_compiler
+{
+
+//BuildGraph
+//Private
+
+std::optional<detail::unit_record> BuildGraph::Find(const detail::translation_unit &unit) const
+{
+	std::lock_guard lock{m_};
+
+	if (auto iter = units_.find(detail::unit_id(unit.file_path));
+		iter != std::end(units_) && iter->second.unit->source == unit.source)
+		return iter->second;
+	else
+		return {};
+}
+
+void BuildGraph::Store(detail::unit_record record)
+{
+	auto id = detail::unit_id(record.unit->file_path);
+
+	std::lock_guard lock{m_};
+	units_[std::move(id)] = std::move(record);
+}
+
+adaptors::FlatSet<std::string> BuildGraph::DependentsOf(adaptors::FlatSet<std::string> unit_ids) const
+{
+	adaptors::FlatSet<std::string> dependents;
+
+	//Follow import edges in reverse, until no new dependents are found
+	for (auto found = true; found;)
+	{
+		found = false;
+
+		for (auto &[id, record] : units_)
+		{
+			if (!unit_ids.contains(id) &&
+				std::any_of(std::begin(record.imports), std::end(record.imports),
+					[&](auto &import_id) noexcept
+					{
+						return unit_ids.contains(import_id);
+					}))
+			{
+				unit_ids.insert(id);
+				dependents.insert(id);
+				found = true;
+			}
+		}
+	}
+
+	return dependents;
+}
+
+
+//Public
+
+/*
+	Observers
+*/
+
+std::vector<std::filesystem::path> BuildGraph::Units() const
+{
+	std::lock_guard lock{m_};
+	std::vector<std::filesystem::path> file_paths;
+
+	for (auto &[id, record] : units_)
+		file_paths.push_back(record.unit->file_path);
+
+	return file_paths;
+}
+
+std::vector<std::filesystem::path> BuildGraph::Imports(const std::filesystem::path &file_path) const
+{
+	std::lock_guard lock{m_};
+	std::vector<std::filesystem::path> file_paths;
+
+	if (auto iter = units_.find(detail::unit_id(file_path.lexically_normal().string())); iter != std::end(units_))
+	{
+		for (auto &import_id : iter->second.imports)
+		{
+			if (auto import_iter = units_.find(import_id); import_iter != std::end(units_))
+				file_paths.push_back(import_iter->second.unit->file_path);
+			else
+				file_paths.push_back(import_id);
+		}
+	}
+
+	return file_paths;
+}
+
+std::vector<std::filesystem::path> BuildGraph::Dependents(const std::filesystem::path &file_path) const
+{
+	std::lock_guard lock{m_};
+	std::vector<std::filesystem::path> file_paths;
+
+	for (auto &id : DependentsOf(adaptors::FlatSet<std::string>{detail::unit_id(file_path.lexically_normal().string())}))
+		file_paths.push_back(units_.find(id)->second.unit->file_path);
+
+	return file_paths;
+}
+
+Strings BuildGraph::Selectors(const std::filesystem::path &file_path) const
+{
+	std::lock_guard lock{m_};
+	Strings selectors;
+
+	if (auto iter = units_.find(detail::unit_id(file_path.lexically_normal().string())); iter != std::end(units_))
+	{
+		for (auto &selector : iter->second.selectors)
+			selectors.push_back(selector);
+	}
+
+	return selectors;
+}
+
+
+/*
+	Invalidating
+*/
+
+std::vector<std::filesystem::path> BuildGraph::Invalidate(const std::filesystem::path &file_path)
+{
+	auto normalized_path = file_path.lexically_normal();
+	auto id = detail::unit_id(normalized_path.string());
+
+	std::lock_guard lock{m_};
+	std::vector<std::filesystem::path> file_paths;
+
+	if (auto iter = units_.find(id); iter != std::end(units_))
+	{
+		file_paths.push_back(iter->second.unit->file_path);
+
+		//Dependents are kept, since their own source has not changed
+		for (auto &dependent_id : DependentsOf(adaptors::FlatSet<std::string>{id}))
+			file_paths.push_back(units_.find(dependent_id)->second.unit->file_path);
+
+		units_.erase(iter);
+	}
+	else
+		file_paths.push_back(std::move(normalized_path));
+
+	return file_paths;
+}
+
+std::vector<std::filesystem::path> BuildGraph::Poll()
+{
+	std::lock_guard lock{m_};
+	adaptors::FlatSet<std::string> changed_ids;
+
+	for (auto &[id, record] : units_)
+	{
+		if (record.write_time && record.write_time != detail::write_time(record.unit->file_path))
+			changed_ids.insert(id);
+	}
+
+	std::vector<std::filesystem::path> file_paths;
+
+	if (std::empty(changed_ids))
+		return file_paths;
+
+	for (auto &id : changed_ids)
+		file_paths.push_back(units_.find(id)->second.unit->file_path);
+
+	for (auto &id : DependentsOf(changed_ids))
+		file_paths.push_back(units_.find(id)->second.unit->file_path);
+
+	for (auto &id : changed_ids)
+		units_.erase(id);
+
+	return file_paths;
+}
+
+void BuildGraph::Clear() noexcept
+{
+	std::lock_guard lock{m_};
+	units_.clear();
+}
+
+} //script_compiler
+
+
 //ScriptCompiler
 
 /*
@@ -2459,23 +2970,27 @@ std::optional<ScriptTree> ScriptCompiler::Compile(std::string_view name, Compile
 {
 	compile_errors_.clear();
 	compile_time_ = {}; //Reset
+	cache_hit_ = false;
 
 	if (build_repository_)
 	{
 		script_compiler::detail::build_system system{*build_repository_};
+		system.graph = build_graph_.get();
 		script_compiler::detail::file_trace trace;
 
 		//File path needs to be a valid file
 		if (std::string str; script_compiler::detail::load_from_repository(name, system, trace, str, error))
 		{	
 			system.units.push_back(std::make_unique<script_compiler::detail::translation_unit>(
-				script_compiler::detail::translation_unit{trace.current_file_path().string(), std::move(str)}));
+				script_compiler::detail::translation_unit{trace.current_file_path().string(), std::move(str), {}, std::string{name}}));
 
 			if (max_build_processes_)
 				system.processes.MaxWorkerThreads(*max_build_processes_);
 
 			auto stopwatch = timers::Stopwatch::StartNew();
-			auto tree = script_compiler::detail::compile(std::move(trace), system, error, compile_errors_);
+			auto tree = cache_path_ ?
+				script_compiler::detail::cached_compile(*cache_path_, std::move(trace), system, error, compile_errors_, cache_hit_) :
+				script_compiler::detail::compile(std::move(trace), system, error, compile_errors_);
 			compile_time_ = stopwatch.Elapsed();
 			return tree;
 		}
@@ -2494,11 +3009,13 @@ std::optional<ScriptTree> ScriptCompiler::CompileFile(std::filesystem::path file
 {
 	compile_errors_.clear();
 	compile_time_ = {}; //Reset
+	cache_hit_ = false;
 
 	//Root path needs to be a valid directory
 	if (ion::utilities::file::IsDirectory(root_path))
 	{
 		script_compiler::detail::build_system system{std::move(root_path)};
+		system.graph = build_graph_.get();
 		script_compiler::detail::file_trace trace;
 		
 		//File path needs to be a valid file
@@ -2511,7 +3028,9 @@ std::optional<ScriptTree> ScriptCompiler::CompileFile(std::filesystem::path file
 				system.processes.MaxWorkerThreads(*max_build_processes_);
 
 			auto stopwatch = timers::Stopwatch::StartNew();
-			auto tree = script_compiler::detail::compile(std::move(trace), system, error, compile_errors_);
+			auto tree = cache_path_ ?
+				script_compiler::detail::cached_compile(*cache_path_, std::move(trace), system, error, compile_errors_, cache_hit_) :
+				script_compiler::detail::compile(std::move(trace), system, error, compile_errors_);
 			compile_time_ = stopwatch.Elapsed();
 			return tree;
 		}
@@ -2529,11 +3048,13 @@ std::optional<ScriptTree> ScriptCompiler::CompileString(std::string str, std::fi
 {
 	compile_errors_.clear();
 	compile_time_ = {}; //Reset
+	cache_hit_ = false;
 
 	//Root path needs to be a valid directory
 	if (ion::utilities::file::IsDirectory(root_path))
 	{
 		script_compiler::detail::build_system system{std::move(root_path)};
+		system.graph = build_graph_.get();
 		script_compiler::detail::file_trace trace{{".ion"}};
 
 		system.units.push_back(std::make_unique<script_compiler::detail::translation_unit>(
@@ -2543,7 +3064,9 @@ std::optional<ScriptTree> ScriptCompiler::CompileString(std::string str, std::fi
 			system.processes.MaxWorkerThreads(*max_build_processes_);
 
 		auto stopwatch = timers::Stopwatch::StartNew();
-		auto tree = script_compiler::detail::compile(std::move(trace), system, error, compile_errors_);
+		auto tree = cache_path_ ?
+			script_compiler::detail::cached_compile(*cache_path_, std::move(trace), system, error, compile_errors_, cache_hit_) :
+			script_compiler::detail::compile(std::move(trace), system, error, compile_errors_);
 		compile_time_ = stopwatch.Elapsed();
 		return tree;
 	}
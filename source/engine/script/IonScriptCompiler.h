@@ -40,9 +40,15 @@ namespace ion::script
 			SummaryAndUnits
 		};
 
+		class BuildGraph;
+
 
 		namespace detail
 		{
+			constexpr std::string_view cache_format_version = "ion-script-cache-1";
+			constexpr std::string_view cache_file_extension = ".ionc";
+
+
 			enum class token_name
 			{	
 				Comment,
@@ -73,6 +79,7 @@ namespace ion::script
 				std::string file_path; //Normalized, viewed
 				std::string source; //Viewed
 				CompileError error; //Referenced
+				std::string name; //Repository name (if any)
 			};
 
 			using translation_units = std::vector<std::unique_ptr<translation_unit>>;
@@ -140,20 +147,34 @@ namespace ion::script
 				///@}
 			};
 
+			struct unit_record
+			{
+				std::shared_ptr<const translation_unit> unit; //Owns the source viewed by 'tokens'
+				lexical_tokens tokens; //Lexed and pre-parsed
+				std::vector<std::string> imports; //Unit ids
+				adaptors::FlatSet<std::string> selectors;
+				std::optional<std::filesystem::file_time_type> write_time;
+			};
+
+			using unit_records = adaptors::FlatMap<std::string, unit_record>;
+
+
 			struct build_system
 			{
 				std::filesystem::path root_path;
 				const assets::repositories::ScriptRepository *repository = nullptr;		
+				BuildGraph *graph = nullptr;
 				
 				translation_units units; //Need stable memory addressing
-				std::mutex m; //Protects 'units'
+				std::vector<std::shared_ptr<const translation_unit>> reused_units; //Keeps reused sources alive
+				std::mutex m; //Protects 'units' and 'reused_units'
 				parallel::WorkerPool<std::optional<lexical_tokens>, std::string> processes;	
 
 
 				build_system(std::filesystem::path root_path);
 				build_system(const assets::repositories::ScriptRepository &repository);		
 
-				void start_process(std::string str, file_trace trace);
+				void start_process(std::string str, file_trace trace, std::string name = {});
 			};
 
 
@@ -495,6 +516,7 @@ namespace ion::script
 			std::pair<std::string_view, int> get_white_space_lexeme(std::string_view str) noexcept;
 
 			std::optional<lexical_tokens> lex(translation_unit &unit, file_trace trace, build_system &system);
+			std::optional<lexical_tokens> lex_unit(translation_unit &unit, file_trace trace, build_system &system);
 
 			///@}
 		
@@ -571,6 +593,37 @@ namespace ion::script
 			
 			///@}
 
+			/**
+				@name Caching
+				@{
+			*/
+
+			std::string hash_source(std::string_view source);
+			std::optional<std::string> hash_unit(const translation_unit &unit, const build_system &system);
+			std::string cache_key(const translation_unit &entry_unit, const build_system &system);
+
+			std::optional<ScriptTree> load_from_cache(const std::filesystem::path &file_path,
+				const build_system &system, CompileError &error, std::vector<CompileError> &errors);
+			bool save_to_cache(const std::filesystem::path &file_path, const ScriptTree &tree, const build_system &system);
+
+			std::optional<ScriptTree> cached_compile(const std::filesystem::path &cache_path, file_trace trace,
+				build_system &system, CompileError &error, std::vector<CompileError> &errors, bool &cache_hit);
+
+			///@}
+
+			/**
+				@name Incremental building
+				@{
+			*/
+
+			std::string unit_id(std::string_view file_path);
+			std::optional<std::filesystem::file_time_type> write_time(const std::filesystem::path &file_path) noexcept;
+
+			unit_record make_unit_record(const translation_unit &unit, const lexical_tokens &tokens, const build_system &system);
+			std::optional<lexical_tokens> reuse_unit(translation_unit &unit, file_trace trace, build_system &system);
+
+			///@}
+
 			/**
 				@name Outputting
 				@{
@@ -580,6 +633,84 @@ namespace ion::script
 
 			///@}
 		} //detail
+
+
+		///@brief A class representing a persistent build graph, shared between compilations
+		///@details Records the lexed tokens, imports and selectors contributed by each compiled unit (file).
+		///Unchanged units are reused by later compilations, so that only changed units needs to be lexed again.
+		///Changes are detected by polling the last write time of each unit
+		class BuildGraph final
+		{
+			friend std::optional<detail::lexical_tokens> detail::lex_unit(detail::translation_unit &unit, detail::file_trace trace, detail::build_system &system);
+			friend std::optional<detail::lexical_tokens> detail::reuse_unit(detail::translation_unit &unit, detail::file_trace trace, detail::build_system &system);
+
+			private:
+
+				detail::unit_records units_;
+				mutable std::mutex m_;
+
+
+				std::optional<detail::unit_record> Find(const detail::translation_unit &unit) const;
+				void Store(detail::unit_record record);
+
+				adaptors::FlatSet<std::string> DependentsOf(adaptors::FlatSet<std::string> unit_ids) const;
+
+			public:
+
+				///@brief Default constructor
+				BuildGraph() = default;
+
+				///@brief Deleted copy constructor
+				BuildGraph(const BuildGraph&) = delete;
+
+
+				/**
+					@name Operators
+					@{
+				*/
+
+				///@brief Deleted copy assignment
+				BuildGraph& operator=(const BuildGraph&) = delete;
+
+				///@}
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns the file paths of all units in this build graph
+				[[nodiscard]] std::vector<std::filesystem::path> Units() const;
+
+				///@brief Returns the file paths of all units directly imported by the unit with the given file path
+				[[nodiscard]] std::vector<std::filesystem::path> Imports(const std::filesystem::path &file_path) const;
+
+				///@brief Returns the file paths of all units that imports the unit with the given file path (transitive)
+				[[nodiscard]] std::vector<std::filesystem::path> Dependents(const std::filesystem::path &file_path) const;
+
+				///@brief Returns all template selector classes contributed by the unit with the given file path
+				[[nodiscard]] Strings Selectors(const std::filesystem::path &file_path) const;
+
+				///@}
+
+				/**
+					@name Invalidating
+					@{
+				*/
+
+				///@brief Invalidates the unit with the given file path, so that it will be lexed again when compiled
+				///@details Returns the file paths of the unit and all of its dependents (that needs to be compiled again)
+				std::vector<std::filesystem::path> Invalidate(const std::filesystem::path &file_path);
+
+				///@brief Checks the last write time of all units, and invalidates all units that have changed
+				///@details Returns the file paths of all changed units and all of their dependents (that needs to be compiled again)
+				std::vector<std::filesystem::path> Poll();
+
+				///@brief Removes all units from this build graph
+				void Clear() noexcept;
+
+				///@}
+		};
 	} //script_compiler
 
 
@@ -590,9 +721,12 @@ namespace ion::script
 		
 			const assets::repositories::ScriptRepository *build_repository_ = nullptr;	
 			std::optional<int> max_build_processes_;
+			std::optional<std::filesystem::path> cache_path_;
+			std::shared_ptr<script_compiler::BuildGraph> build_graph_;
 
 			std::vector<CompileError> compile_errors_;
 			duration compile_time_{};
+			bool cache_hit_ = false;
 
 		public:
 
@@ -624,6 +758,26 @@ namespace ion::script
 				max_build_processes_ = max_build_processes;
 			}
 
+			///@brief Sets the cache path (directory) the compiler should use for caching compiled trees
+			///@details Trees are cached by a content hash over the entry unit and all of its imports (transitive).
+			///A cached tree is only used if none of the compiled units have changed since the tree was cached.
+			///If nullopt is passed, no compile cache will be used
+			inline void CachePath(std::optional<std::filesystem::path> cache_path) noexcept
+			{
+				cache_path_ = std::move(cache_path);
+			}
+
+			///@brief Sets whether or not the compiler should build incrementally
+			///@details When enabled, a persistent build graph is kept between compilations so that unchanged units are not lexed again.
+			///Copies of this compiler shares the same build graph
+			inline void IncrementalBuild(bool enable)
+			{
+				if (enable && !build_graph_)
+					build_graph_ = std::make_shared<script_compiler::BuildGraph>();
+				else if (!enable)
+					build_graph_.reset();
+			}
+
 			///@}
 
 			/**
@@ -645,6 +799,12 @@ namespace ion::script
 				return compile_time_;
 			}
 
+			///@brief Returns true if the previous compilation was loaded from the compile cache
+			[[nodiscard]] inline auto CacheHit() const noexcept
+			{
+				return cache_hit_;
+			}
+
 
 			///@brief Returns the build repository the compiler has access to when compiling
 			///@details Returns nullptr if the compiler has no build repository
@@ -660,6 +820,20 @@ namespace ion::script
 				return max_build_processes_;
 			}
 
+			///@brief Returns the cache path (directory) the compiler uses for caching compiled trees
+			///@details Returns nullopt if the compiler uses no compile cache
+			[[nodiscard]] inline auto& CachePath() const noexcept
+			{
+				return cache_path_;
+			}
+
+			///@brief Returns the persistent build graph used when building incrementally
+			///@details Returns nullptr if the compiler does not build incrementally
+			[[nodiscard]] inline auto Graph() const noexcept
+			{
+				return build_graph_.get();
+			}
+
 			///@}
 
 			/**
@@ -12,6 +12,7 @@ File:	IonScriptTree.cpp
 
 #include "IonScriptTree.h"
 
+#include <algorithm>
 #include <utility>
 #include "utilities/IonParseUtility.h"
 
@@ -496,7 +497,8 @@ ObjectNode::ObjectNode(std::string name, std::string classes, PropertyNodes prop
 	name_{std::move(name)},
 	classes_{std::move(classes)},
 	properties_{std::move(properties)},
-	objects_{std::move(objects)}
+	objects_{std::move(objects)},
+	name_atom_{MakeAtom(name_)}
 {
 	//Empty
 }
@@ -584,9 +586,11 @@ void ObjectNode::RollbackAppends(bool cascade)
 
 ObjectNode& ObjectNode::Find(std::string_view name) noexcept
 {
+	auto atom = MakeAtom(name);
+
 	for (auto &object : objects_)
 	{
-		if (object.Name() == name)
+		if (object.NameAtom() == atom && object.Name() == name)
 			return object;
 	}
 
@@ -595,9 +599,11 @@ ObjectNode& ObjectNode::Find(std::string_view name) noexcept
 
 const ObjectNode& ObjectNode::Find(std::string_view name) const noexcept
 {
+	auto atom = MakeAtom(name);
+
 	for (auto &object : objects_)
 	{
-		if (object.Name() == name)
+		if (object.NameAtom() == atom && object.Name() == name)
 			return object;
 	}
 
@@ -607,11 +613,13 @@ const ObjectNode& ObjectNode::Find(std::string_view name) const noexcept
 
 ObjectNode& ObjectNode::Search(std::string_view name, SearchStrategy strategy) noexcept
 {
+	auto atom = MakeAtom(name);
+
 	if (strategy == SearchStrategy::BreadthFirst)
 	{
 		for (auto &node : BreadthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return const_cast<ObjectNode&>(node.Object);
 		}
 	}
@@ -619,7 +627,7 @@ ObjectNode& ObjectNode::Search(std::string_view name, SearchStrategy strategy) n
 	{
 		for (auto &node : DepthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return const_cast<ObjectNode&>(node.Object);
 		}
 	}
@@ -629,11 +637,13 @@ ObjectNode& ObjectNode::Search(std::string_view name, SearchStrategy strategy) n
 
 const ObjectNode& ObjectNode::Search(std::string_view name, SearchStrategy strategy) const noexcept
 {
+	auto atom = MakeAtom(name);
+
 	if (strategy == SearchStrategy::BreadthFirst)
 	{
 		for (auto &node : BreadthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return node.Object;
 		}
 	}
@@ -641,7 +651,7 @@ const ObjectNode& ObjectNode::Search(std::string_view name, SearchStrategy strat
 	{
 		for (auto &node : DepthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return node.Object;
 		}
 	}
@@ -652,9 +662,11 @@ const ObjectNode& ObjectNode::Search(std::string_view name, SearchStrategy strat
 
 PropertyNode& ObjectNode::Property(std::string_view name) noexcept
 {
+	auto atom = MakeAtom(name);
+
 	for (auto &property : properties_)
 	{
-		if (property.Name() == name)
+		if (property.NameAtom() == atom && property.Name() == name)
 			return property;
 	}
 
@@ -663,9 +675,11 @@ PropertyNode& ObjectNode::Property(std::string_view name) noexcept
 
 const PropertyNode& ObjectNode::Property(std::string_view name) const noexcept
 {
+	auto atom = MakeAtom(name);
+
 	for (auto &property : properties_)
 	{
-		if (property.Name() == name)
+		if (property.NameAtom() == atom && property.Name() == name)
 			return property;
 	}
 
@@ -677,7 +691,8 @@ const PropertyNode& ObjectNode::Property(std::string_view name) const noexcept
 
 PropertyNode::PropertyNode(std::string name, ArgumentNodes arguments) noexcept :
 	name_{std::move(name)},
-	arguments_{std::move(arguments)}
+	arguments_{std::move(arguments)},
+	name_atom_{MakeAtom(name_)}
 {
 	//Empty
 }
@@ -707,13 +722,14 @@ const ArgumentNode& PropertyNode::Argument(int number) const noexcept
 ArgumentNode::ArgumentNode(ArgumentType argument) noexcept :
 	argument_{std::move(argument)}
 {
-	//Empty
+	if (auto value = std::get_if<ScriptType::Enumerable>(&*argument_); value)
+		value_atom_ = MakeAtom(value->Get());
 }
 
 ArgumentNode::ArgumentNode(ArgumentType argument, std::string unit) noexcept :
-	argument_{std::move(argument)}, unit_{std::move(unit)}
+	ArgumentNode{std::move(argument)}
 {
-	//Empty
+	unit_ = std::move(unit);
 }
 
 ArgumentNode::ArgumentNode(std::nullopt_t) noexcept
@@ -721,6 +737,65 @@ ArgumentNode::ArgumentNode(std::nullopt_t) noexcept
 	//Empty
 }
 
+
+//NameIndex
+
+NameIndex::NameIndex(const ScriptTree &tree)
+{
+	for (auto &node : tree.BreadthFirstSearch())
+		objects_.emplace_back(node.Object.NameAtom(), &node.Object);
+
+	//Keep breadth first order for equal atoms
+	std::stable_sort(std::begin(objects_), std::end(objects_),
+		[](auto &x, auto &y) noexcept
+		{
+			return x.first < y.first;
+		});
+}
+
+
+/*
+	Finding
+*/
+
+const ObjectNode& NameIndex::Find(std::string_view name) const noexcept
+{
+	auto atom = MakeAtom(name);
+	auto iter = std::lower_bound(std::begin(objects_), std::end(objects_), atom,
+		[](auto &x, auto atom) noexcept
+		{
+			return x.first < atom;
+		});
+
+	for (auto end = std::end(objects_); iter != end && iter->first == atom; ++iter)
+	{
+		if (iter->second->Name() == name)
+			return *iter->second;
+	}
+
+	return InvalidObjectNode;
+}
+
+std::vector<const ObjectNode*> NameIndex::FindAll(std::string_view name) const
+{
+	std::vector<const ObjectNode*> objects;
+
+	auto atom = MakeAtom(name);
+	auto iter = std::lower_bound(std::begin(objects_), std::end(objects_), atom,
+		[](auto &x, auto atom) noexcept
+		{
+			return x.first < atom;
+		});
+
+	for (auto end = std::end(objects_); iter != end && iter->first == atom; ++iter)
+	{
+		if (iter->second->Name() == name)
+			objects.push_back(iter->second);
+	}
+
+	return objects;
+}
+
 } //script_tree
 
 
@@ -787,9 +862,11 @@ void ScriptTree::RollbackAppends(bool cascade)
 
 ObjectNode& ScriptTree::Find(std::string_view name) noexcept
 {
+	auto atom = MakeAtom(name);
+
 	for (auto &object : objects_)
 	{
-		if (object.Name() == name)
+		if (object.NameAtom() == atom && object.Name() == name)
 			return object;
 	}
 
@@ -798,9 +875,11 @@ ObjectNode& ScriptTree::Find(std::string_view name) noexcept
 
 const ObjectNode& ScriptTree::Find(std::string_view name) const noexcept
 {
+	auto atom = MakeAtom(name);
+
 	for (auto &object : objects_)
 	{
-		if (object.Name() == name)
+		if (object.NameAtom() == atom && object.Name() == name)
 			return object;
 	}
 
@@ -810,11 +889,13 @@ const ObjectNode& ScriptTree::Find(std::string_view name) const noexcept
 
 ObjectNode& ScriptTree::Search(std::string_view name, SearchStrategy strategy) noexcept
 {
+	auto atom = MakeAtom(name);
+
 	if (strategy == SearchStrategy::BreadthFirst)
 	{
 		for (auto &node : BreadthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return const_cast<ObjectNode&>(node.Object);
 		}
 	}
@@ -822,7 +903,7 @@ ObjectNode& ScriptTree::Search(std::string_view name, SearchStrategy strategy) n
 	{
 		for (auto &node : DepthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return const_cast<ObjectNode&>(node.Object);
 		}
 	}
@@ -832,11 +913,13 @@ ObjectNode& ScriptTree::Search(std::string_view name, SearchStrategy strategy) n
 
 const ObjectNode& ScriptTree::Search(std::string_view name, SearchStrategy strategy) const noexcept
 {
+	auto atom = MakeAtom(name);
+
 	if (strategy == SearchStrategy::BreadthFirst)
 	{
 		for (auto &node : BreadthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return node.Object;
 		}
 	}
@@ -844,7 +927,7 @@ const ObjectNode& ScriptTree::Search(std::string_view name, SearchStrategy strat
 	{
 		for (auto &node : DepthFirstSearch())
 		{
-			if (node.Object.Name() == name)
+			if (node.Object.NameAtom() == atom && node.Object.Name() == name)
 				return node.Object;
 		}
 	}
@@ -17,6 +17,7 @@ File:	IonScriptTree.h
 #include <cassert>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <type_traits>
 #include <vector>
@@ -25,10 +26,13 @@ File:	IonScriptTree.h
 #include "adaptors/ranges/IonIterable.h"
 #include "types/IonTypes.h"
 #include "types/IonTypeTraits.h"
+#include "utilities/IonCrypto.h"
 #include "utilities/IonStringUtility.h"
 
 namespace ion::script
 {
+	using namespace types::type_literals;
+
 	namespace script_tree
 	{
 		/*
@@ -45,6 +49,10 @@ namespace ion::script
 		using PropertyNodes = std::vector<PropertyNode>;
 		using ArgumentNodes = std::vector<ArgumentNode>;
 
+		///@brief An atom is an integer representing an interned name (or enumerable)
+		///@details Atoms are computed from the content of the name, so equal names always have equal atoms
+		using Atom = uint64;
+
 		using ArgumentType =
 			std::variant<
 				ScriptType::Boolean,
@@ -296,6 +304,31 @@ namespace ion::script
 		} //detail
 
 
+		/**
+			@name Atoms
+			@{
+		*/
+
+		///@brief Returns the atom of the given name
+		///@details Can be evaluated at compile time, which makes it possible to switch on atoms
+		[[nodiscard]] constexpr Atom MakeAtom(std::string_view name) noexcept
+		{
+			return utilities::crypto::FNV1a_64(name);
+		}
+
+		inline namespace literals
+		{
+			///@brief Returns the atom of the given name, at compile time
+			///@details Use as case labels when switching on atoms. Equal atoms in one switch are rejected when compiling
+			consteval auto operator""_atom(const char *name, size_t length) noexcept
+			{
+				return MakeAtom({name, length});
+			}
+		} //literals
+
+		///@}
+
+
 		/*
 			Node types
 		*/
@@ -324,6 +357,7 @@ namespace ion::script
 				std::string classes_;
 				PropertyNodes properties_;
 				ObjectNodes objects_;
+				Atom name_atom_ = 0;
 
 				PropertyNodes pending_properties_;
 				ObjectNodes pending_objects_;
@@ -361,6 +395,12 @@ namespace ion::script
 					return name_;
 				}
 
+				///@brief Returns the atom of the name of this object
+				[[nodiscard]] inline auto NameAtom() const noexcept
+				{
+					return name_atom_;
+				}
+
 				///@brief Returns the classes of this object
 				[[nodiscard]] inline auto& Classes() const noexcept
 				{
@@ -508,6 +548,7 @@ namespace ion::script
 
 				std::string name_;
 				ArgumentNodes arguments_;
+				Atom name_atom_ = 0;
 
 			public:
 
@@ -539,6 +580,12 @@ namespace ion::script
 					return name_;
 				}
 
+				///@brief Returns the atom of the name of the property
+				[[nodiscard]] inline auto NameAtom() const noexcept
+				{
+					return name_atom_;
+				}
+
 				///@}
 
 				/**
@@ -604,6 +651,7 @@ namespace ion::script
 
 				std::optional<ArgumentType> argument_;
 				std::string unit_;
+				Atom value_atom_ = 0;
 			
 			public:
 
@@ -669,6 +717,13 @@ namespace ion::script
 					return unit_;
 				}
 
+				///@brief Returns the atom of the value of this argument, if the argument is an enumerable
+				///@details Returns 0 if the argument is not an enumerable
+				[[nodiscard]] inline auto ValueAtom() const noexcept
+				{
+					return value_atom_;
+				}
+
 				///@}
 		};
 	} //script_tree
@@ -843,6 +898,51 @@ namespace ion::script
 		inline const auto InvalidArgumentNode = ArgumentNode{std::nullopt};
 
 		///@}
+
+
+		///@brief A class representing an index of all objects in a script tree, by name
+		///@details The index is an optional accelerator for finding objects by name in large trees.
+		///An index is only valid as long as the indexed tree is not modified (or destroyed)
+		class NameIndex final
+		{
+			private:
+
+				std::vector<std::pair<Atom, const ObjectNode*>> objects_; //Sorted by atom, then breadth first
+
+			public:
+
+				///@brief Constructs a new name index of all objects in the given script tree
+				explicit NameIndex(const ScriptTree &tree);
+
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns the number of indexed objects
+				[[nodiscard]] inline auto Size() const noexcept
+				{
+					return std::ssize(objects_);
+				}
+
+				///@}
+
+				/**
+					@name Finding
+					@{
+				*/
+
+				///@brief Finds the first object (breadth first) with the given name
+				///@details Same as a breadth first search in the indexed tree.
+				///Returns InvalidObjectNode if the given object is not found
+				[[nodiscard]] const ObjectNode& Find(std::string_view name) const noexcept;
+
+				///@brief Finds all objects with the given name, in breadth first order
+				[[nodiscard]] std::vector<const ObjectNode*> FindAll(std::string_view name) const;
+
+				///@}
+		};
 	} //script_tree
 
 } //ion::script
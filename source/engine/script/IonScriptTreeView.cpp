@@ -0,0 +1,455 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	script
+File:	IonScriptTreeView.cpp
+-------------------------------------------
+*/
+
+#include "IonScriptTreeView.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace ion::script
+{
+
+using namespace script_tree_view;
+
+namespace script_tree_view
+{
+
+namespace detail
+{
+
+/*
+	Serializing
+*/
+
+std::vector<std::byte> serialize(const adaptors::ranges::Iterable<const script_tree::ObjectNodes&> &objects)
+{
+	std::vector<const script_tree::ObjectNode*> object_queue;
+	std::vector<object_record> object_records;
+	std::vector<property_record> property_records;
+	std::vector<argument_record> argument_records;
+
+	std::string strings;
+	std::unordered_map<std::string_view, uint32> string_offsets;
+
+	//Equal strings are only stored once
+	auto add_string =
+		[&](std::string_view str)
+		{
+			if (std::empty(str))
+				return string_ref{};
+
+			auto [iter, inserted] = string_offsets.try_emplace(str, static_cast<uint32>(std::size(strings)));
+
+			if (inserted)
+				strings += str;
+
+			return string_ref{iter->second, static_cast<uint32>(std::size(str))};
+		};
+
+	for (auto &object : objects)
+		object_queue.push_back(&object);
+
+	auto root_count = std::size(object_queue);
+
+	//Breadth first, so that all child objects of an object are contiguous
+	for (auto i = size_t{0}; i < std::size(object_queue); ++i)
+	{
+		auto &object = *object_queue[i];
+		auto &record = object_records.emplace_back();
+		record.name = add_string(object.Name());
+		record.classes = add_string(object.Classes());
+		record.first_property = static_cast<uint32>(std::size(property_records));
+
+		for (auto &property : object.Properties())
+		{
+			auto &p_record = property_records.emplace_back();
+			p_record.name = add_string(property.Name());
+			p_record.first_argument = static_cast<uint32>(std::size(argument_records));
+
+			for (auto &argument : property.Arguments())
+			{
+				auto &a_record = argument_records.emplace_back();
+				a_record.unit = add_string(argument.Unit());
+
+				argument.Visit(
+					[&](auto &&value)
+					{
+						using T = std::remove_cvref_t<decltype(value)>;
+						a_record.type = static_cast<uint32>(script_tree::detail::variant_index<script_tree::ArgumentType, T>());
+
+						if constexpr (std::is_same_v<T, ScriptType::Enumerable> || std::is_same_v<T, ScriptType::String>)
+							set_value(a_record, add_string(value.Get()));
+						else if constexpr (std::is_same_v<T, ScriptType::Color>)
+						{
+							auto [r, g, b, a] = value.Get().RGBA();
+							set_value(a_record, std::array{r, g, b, a});
+						}
+						else if constexpr (std::is_same_v<T, ScriptType::Vector2>)
+						{
+							auto [x, y] = value.Get().XY();
+							set_value(a_record, std::array{x, y});
+						}
+						else if constexpr (std::is_same_v<T, ScriptType::Vector3>)
+						{
+							auto [x, y, z] = value.Get().XYZ();
+							set_value(a_record, std::array{x, y, z});
+						}
+						else
+							set_value(a_record, value.Get());
+					});
+			}
+
+			p_record.argument_count = static_cast<uint32>(std::size(argument_records)) - p_record.first_argument;
+		}
+
+		record.property_count = static_cast<uint32>(std::size(property_records)) - record.first_property;
+		record.first_object = static_cast<uint32>(std::size(object_queue));
+
+		for (auto &child_object : object.Objects())
+			object_queue.push_back(&child_object);
+
+		record.object_count = static_cast<uint32>(std::size(object_queue)) - record.first_object;
+	}
+
+	header h;
+	h.magic = magic;
+	h.version = version;
+	h.root_count = static_cast<uint32>(root_count);
+	h.object_count = static_cast<uint32>(std::size(object_records));
+	h.property_count = static_cast<uint32>(std::size(property_records));
+	h.argument_count = static_cast<uint32>(std::size(argument_records));
+	h.objects_offset = static_cast<uint32>(sizeof(header));
+	h.properties_offset = h.objects_offset + static_cast<uint32>(std::size(object_records) * sizeof(object_record));
+	h.arguments_offset = h.properties_offset + static_cast<uint32>(std::size(property_records) * sizeof(property_record));
+	h.strings_offset = h.arguments_offset + static_cast<uint32>(std::size(argument_records) * sizeof(argument_record));
+	h.strings_size = static_cast<uint32>(std::size(strings));
+
+	std::vector<std::byte> bytes(h.strings_offset + std::size(strings));
+	std::memcpy(std::data(bytes), &h, sizeof(header));
+	std::memcpy(std::data(bytes) + h.objects_offset, std::data(object_records), std::size(object_records) * sizeof(object_record));
+	std::memcpy(std::data(bytes) + h.properties_offset, std::data(property_records), std::size(property_records) * sizeof(property_record));
+	std::memcpy(std::data(bytes) + h.arguments_offset, std::data(argument_records), std::size(argument_records) * sizeof(argument_record));
+	std::memcpy(std::data(bytes) + h.strings_offset, std::data(strings), std::size(strings));
+
+	return bytes;
+}
+
+
+/*
+	Validating
+*/
+
+bool is_valid_string(const header &h, string_ref ref) noexcept
+{
+	return static_cast<uint64>(ref.offset) + ref.size <= h.strings_size;
+}
+
+bool is_valid(std::string_view bytes) noexcept
+{
+	//Header
+	if (std::size(bytes) < sizeof(header) ||
+		reinterpret_cast<std::uintptr_t>(std::data(bytes)) % alignof(header) != 0)
+		return false;
+
+	auto data = reinterpret_cast<const std::byte*>(std::data(bytes));
+	auto &h = get_header(data);
+
+	if (h.magic != magic || h.version != version || h.root_count > h.object_count)
+		return false;
+
+	//Tables
+	auto is_valid_table =
+		[&](uint32 offset, uint32 count, size_t record_size) noexcept
+		{
+			return offset % alignof(header) == 0 &&
+				static_cast<uint64>(offset) + static_cast<uint64>(count) * record_size <= std::size(bytes);
+		};
+
+	if (!is_valid_table(h.objects_offset, h.object_count, sizeof(object_record)) ||
+		!is_valid_table(h.properties_offset, h.property_count, sizeof(property_record)) ||
+		!is_valid_table(h.arguments_offset, h.argument_count, sizeof(argument_record)) ||
+		static_cast<uint64>(h.strings_offset) + h.strings_size > std::size(bytes))
+		return false;
+
+	//Records
+	//Child objects must come after its parent (breadth first), which makes cycles impossible
+	auto objects = get_objects(data);
+	for (auto i = 0_ui32; i < h.object_count; ++i)
+	{
+		if (auto &record = objects[i];
+			!is_valid_string(h, record.name) || !is_valid_string(h, record.classes) ||
+			static_cast<uint64>(record.first_property) + record.property_count > h.property_count ||
+			static_cast<uint64>(record.first_object) + record.object_count > h.object_count ||
+			(record.object_count > 0 && record.first_object <= i))
+			return false;
+	}
+
+	auto properties = get_properties(data);
+	for (auto i = 0_ui32; i < h.property_count; ++i)
+	{
+		if (auto &record = properties[i];
+			!is_valid_string(h, record.name) ||
+			static_cast<uint64>(record.first_argument) + record.argument_count > h.argument_count)
+			return false;
+	}
+
+	auto arguments = get_arguments(data);
+	for (auto i = 0_ui32; i < h.argument_count; ++i)
+	{
+		auto &record = arguments[i];
+
+		if (record.type >= std::variant_size_v<script_tree::ArgumentType> ||
+			!is_valid_string(h, record.unit))
+			return false;
+
+		if ((record.type == script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Enumerable>() ||
+			 record.type == script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::String>()) &&
+			!is_valid_string(h, get_value<string_ref>(record)))
+			return false;
+	}
+
+	return true;
+}
+
+} //detail
+
+
+//ObjectView
+
+ObjectView::ObjectView(const std::byte *data, const detail::object_record *record) noexcept :
+	data_{data},
+	record_{record}
+{
+	//Empty
+}
+
+
+/*
+	Finding
+*/
+
+ObjectView ObjectView::Find(std::string_view name) const noexcept
+{
+	for (auto object : Objects())
+	{
+		if (object.Name() == name)
+			return object;
+	}
+
+	return {};
+}
+
+PropertyView ObjectView::Property(std::string_view name) const noexcept
+{
+	for (auto property : Properties())
+	{
+		if (property.Name() == name)
+			return property;
+	}
+
+	return {};
+}
+
+
+/*
+	Ranges
+*/
+
+ObjectViews ObjectView::Objects() const noexcept
+{
+	return record_ ?
+		ObjectViews{data_, detail::get_objects(data_) + record_->first_object, static_cast<int>(record_->object_count)} :
+		ObjectViews{};
+}
+
+PropertyViews ObjectView::Properties() const noexcept
+{
+	return record_ ?
+		PropertyViews{data_, detail::get_properties(data_) + record_->first_property, static_cast<int>(record_->property_count)} :
+		PropertyViews{};
+}
+
+
+//PropertyView
+
+PropertyView::PropertyView(const std::byte *data, const detail::property_record *record) noexcept :
+	data_{data},
+	record_{record}
+{
+	//Empty
+}
+
+
+/*
+	Operators
+*/
+
+ArgumentView PropertyView::operator[](int number) const noexcept
+{
+	return Argument(number);
+}
+
+
+/*
+	Arguments
+*/
+
+ArgumentView PropertyView::Argument(int number) const noexcept
+{
+	return number >= 0 && number < NumberOfArguments() ?
+		ArgumentView{data_, detail::get_arguments(data_) + record_->first_argument + number} :
+		ArgumentView{};
+}
+
+
+/*
+	Ranges
+*/
+
+ArgumentViews PropertyView::Arguments() const noexcept
+{
+	return record_ ?
+		ArgumentViews{data_, detail::get_arguments(data_) + record_->first_argument, static_cast<int>(record_->argument_count)} :
+		ArgumentViews{};
+}
+
+
+//ArgumentView
+
+ArgumentView::ArgumentView(const std::byte *data, const detail::argument_record *record) noexcept :
+	data_{data},
+	record_{record}
+{
+	//Empty
+}
+
+
+/*
+	Observers
+*/
+
+std::optional<std::string_view> ArgumentView::GetView() const noexcept
+{
+	if (Is<ScriptType::Enumerable>() || Is<ScriptType::String>())
+		return detail::get_string(data_, detail::get_value<detail::string_ref>(*record_));
+	else
+		return {};
+}
+
+std::optional<script_tree::ArgumentType> ArgumentView::Decode() const
+{
+	if (!record_)
+		return {};
+
+	switch (record_->type)
+	{
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Boolean>():
+		return *Get<ScriptType::Boolean>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Color>():
+		return *Get<ScriptType::Color>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Enumerable>():
+		return *Get<ScriptType::Enumerable>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::FloatingPoint>():
+		return *Get<ScriptType::FloatingPoint>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Integer>():
+		return *Get<ScriptType::Integer>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::String>():
+		return *Get<ScriptType::String>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Vector2>():
+		return *Get<ScriptType::Vector2>();
+
+		case script_tree::detail::variant_index<script_tree::ArgumentType, ScriptType::Vector3>():
+		return *Get<ScriptType::Vector3>();
+
+		default:
+		return {};
+	}
+}
+
+} //script_tree_view
+
+
+//ScriptTreeView
+
+/*
+	Finding/searching
+*/
+
+ObjectView ScriptTreeView::Find(std::string_view name) const noexcept
+{
+	for (auto object : Objects())
+	{
+		if (object.Name() == name)
+			return object;
+	}
+
+	return {};
+}
+
+ObjectView ScriptTreeView::Search(std::string_view name) const noexcept
+{
+	for (auto object : BreadthFirstSearch())
+	{
+		if (object.Name() == name)
+			return object;
+	}
+
+	return {};
+}
+
+
+/*
+	Ranges
+*/
+
+ObjectViews ScriptTreeView::Objects() const noexcept
+{
+	return data_ ?
+		ObjectViews{data_, detail::get_objects(data_), static_cast<int>(detail::get_header(data_).root_count)} :
+		ObjectViews{};
+}
+
+ObjectViews ScriptTreeView::BreadthFirstSearch() const noexcept
+{
+	return data_ ?
+		ObjectViews{data_, detail::get_objects(data_), static_cast<int>(detail::get_header(data_).object_count)} :
+		ObjectViews{};
+}
+
+
+/*
+	Serializing
+*/
+
+std::optional<ScriptTreeView> ScriptTreeView::Deserialize(std::string_view bytes) noexcept
+{
+	if (!detail::is_valid(bytes))
+		return {};
+
+	ScriptTreeView view;
+	view.data_ = reinterpret_cast<const std::byte*>(std::data(bytes));
+	return view;
+}
+
+std::vector<std::byte> ScriptTreeView::Serialize(const ScriptTree &tree)
+{
+	return detail::serialize(tree.Objects());
+}
+
+} //ion::script
\ No newline at end of file
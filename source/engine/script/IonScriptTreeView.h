@@ -0,0 +1,692 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	script
+File:	IonScriptTreeView.h
+-------------------------------------------
+*/
+
+#ifndef ION_SCRIPT_TREE_VIEW_H
+#define ION_SCRIPT_TREE_VIEW_H
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "IonScriptTree.h"
+#include "IonScriptTypes.h"
+#include "types/IonTypes.h"
+
+namespace ion::script
+{
+	using namespace types::type_literals;
+
+	namespace script_tree_view
+	{
+		class ObjectView;
+		class PropertyView;
+		class ArgumentView;
+
+
+		namespace detail
+		{
+			constexpr std::array<char, 4> magic{'I', 'O', 'N', 'V'};
+			constexpr auto version = 1_ui32;
+
+			constexpr auto value_size =
+				std::max({sizeof(float80), sizeof(int64), sizeof(real) * 4, sizeof(uint32) * 2});
+
+
+			/*
+				Binary layout
+				All records are 4 byte aligned, and are navigated in place
+			*/
+
+			struct string_ref final
+			{
+				uint32 offset = 0;
+				uint32 size = 0;
+			};
+
+			struct header final
+			{
+				std::array<char, 4> magic{};
+				uint32 version = 0;
+
+				uint32 root_count = 0; //Top-level objects are stored first
+				uint32 object_count = 0;
+				uint32 property_count = 0;
+				uint32 argument_count = 0;
+
+				uint32 objects_offset = 0;
+				uint32 properties_offset = 0;
+				uint32 arguments_offset = 0;
+				uint32 strings_offset = 0;
+				uint32 strings_size = 0;
+			};
+
+			struct object_record final
+			{
+				string_ref name;
+				string_ref classes;
+				uint32 first_property = 0;
+				uint32 property_count = 0;
+				uint32 first_object = 0; //Child objects
+				uint32 object_count = 0;
+			};
+
+			struct property_record final
+			{
+				string_ref name;
+				uint32 first_argument = 0;
+				uint32 argument_count = 0;
+			};
+
+			struct argument_record final
+			{
+				uint32 type = 0; //Index of type in ArgumentType
+				string_ref unit;
+				std::array<std::byte, value_size> value{};
+			};
+
+
+			inline auto& get_header(const std::byte *data) noexcept
+			{
+				return *reinterpret_cast<const header*>(data);
+			}
+
+			inline auto get_objects(const std::byte *data) noexcept
+			{
+				return reinterpret_cast<const object_record*>(data + get_header(data).objects_offset);
+			}
+
+			inline auto get_properties(const std::byte *data) noexcept
+			{
+				return reinterpret_cast<const property_record*>(data + get_header(data).properties_offset);
+			}
+
+			inline auto get_arguments(const std::byte *data) noexcept
+			{
+				return reinterpret_cast<const argument_record*>(data + get_header(data).arguments_offset);
+			}
+
+			inline auto get_string(const std::byte *data, string_ref ref) noexcept
+			{
+				return std::string_view{reinterpret_cast<const char*>(data + get_header(data).strings_offset + ref.offset), ref.size};
+			}
+
+			template <typename T>
+			inline auto get_value(const argument_record &record) noexcept
+			{
+				static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= value_size);
+
+				T value;
+				std::memcpy(&value, std::data(record.value), sizeof(T));
+				return value;
+			}
+
+			template <typename T>
+			inline void set_value(argument_record &record, const T &value) noexcept
+			{
+				static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= value_size);
+				std::memcpy(std::data(record.value), &value, sizeof(T));
+			}
+
+
+			template <typename View, typename Record>
+			class view_iterator final
+			{
+				private:
+
+					const std::byte *data_ = nullptr;
+					const Record *record_ = nullptr;
+
+				public:
+
+					using iterator_category = std::random_access_iterator_tag;
+					using value_type = View;
+					using difference_type = std::ptrdiff_t;
+					using pointer = void;
+					using reference = View;
+
+					view_iterator() = default;
+
+					view_iterator(const std::byte *data, const Record *record) noexcept :
+						data_{data}, record_{record}
+					{
+						//Empty
+					}
+
+					[[nodiscard]] inline auto operator*() const noexcept
+					{
+						return View{data_, record_};
+					}
+
+					[[nodiscard]] inline auto operator[](difference_type off) const noexcept
+					{
+						return View{data_, record_ + off};
+					}
+
+					inline auto& operator++() noexcept
+					{
+						++record_;
+						return *this;
+					}
+
+					inline auto operator++(int) noexcept
+					{
+						auto iter = *this;
+						++record_;
+						return iter;
+					}
+
+					inline auto& operator--() noexcept
+					{
+						--record_;
+						return *this;
+					}
+
+					inline auto operator--(int) noexcept
+					{
+						auto iter = *this;
+						--record_;
+						return iter;
+					}
+
+					inline auto& operator+=(difference_type off) noexcept
+					{
+						record_ += off;
+						return *this;
+					}
+
+					inline auto& operator-=(difference_type off) noexcept
+					{
+						record_ -= off;
+						return *this;
+					}
+
+					[[nodiscard]] inline auto operator+(difference_type off) const noexcept
+					{
+						return view_iterator{data_, record_ + off};
+					}
+
+					[[nodiscard]] inline auto operator-(difference_type off) const noexcept
+					{
+						return view_iterator{data_, record_ - off};
+					}
+
+					[[nodiscard]] inline auto operator-(const view_iterator &rhs) const noexcept
+					{
+						return record_ - rhs.record_;
+					}
+
+					[[nodiscard]] inline auto operator==(const view_iterator &rhs) const noexcept
+					{
+						return record_ == rhs.record_;
+					}
+
+					[[nodiscard]] inline auto operator<=>(const view_iterator &rhs) const noexcept
+					{
+						return record_ <=> rhs.record_;
+					}
+			};
+		} //detail
+
+
+		///@brief A class representing an immutable range of node views (that are contiguous in memory)
+		///@details This can be used directly with a range-based for loop
+		template <typename View, typename Record>
+		class NodeViews final
+		{
+			private:
+
+				const std::byte *data_ = nullptr;
+				const Record *first_ = nullptr;
+				int count_ = 0;
+
+			public:
+
+				using iterator = detail::view_iterator<View, Record>;
+
+
+				///@brief Default constructor
+				NodeViews() = default;
+
+				///@brief Constructs a new range with the given data, first record and count
+				NodeViews(const std::byte *data, const Record *first, int count) noexcept :
+					data_{data}, first_{first}, count_{count}
+				{
+					//Empty
+				}
+
+
+				/**
+					@name Operators
+					@{
+				*/
+
+				///@brief Returns the node view at the given offset
+				[[nodiscard]] inline auto operator[](int off) const noexcept
+				{
+					assert(off >= 0 && off < count_);
+					return View{data_, first_ + off};
+				}
+
+				///@}
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns the number of node views in this range
+				[[nodiscard]] inline auto size() const noexcept
+				{
+					return count_;
+				}
+
+				///@brief Returns true if this range is empty
+				[[nodiscard]] inline auto empty() const noexcept
+				{
+					return count_ == 0;
+				}
+
+				///@}
+
+				/**
+					@name Iterators
+					@{
+				*/
+
+				[[nodiscard]] inline auto begin() const noexcept
+				{
+					return iterator{data_, first_};
+				}
+
+				[[nodiscard]] inline auto end() const noexcept
+				{
+					return iterator{data_, first_ + count_};
+				}
+
+				///@}
+		};
+
+		using ObjectViews = NodeViews<ObjectView, detail::object_record>;
+		using PropertyViews = NodeViews<PropertyView, detail::property_record>;
+		using ArgumentViews = NodeViews<ArgumentView, detail::argument_record>;
+
+
+		/*
+			Node views
+		*/
+
+		///@brief A class representing a read-only view of an object node
+		///@details Names and classes are viewed directly from the underlying buffer
+		class ObjectView final
+		{
+			private:
+
+				const std::byte *data_ = nullptr;
+				const detail::object_record *record_ = nullptr;
+
+			public:
+
+				///@brief Constructs an invalid object view
+				ObjectView() = default;
+
+				///@brief Constructs a new object view with the given data and record
+				ObjectView(const std::byte *data, const detail::object_record *record) noexcept;
+
+
+				/**
+					@name Operators
+					@{
+				*/
+
+				///@brief Returns true if this object view is valid
+				[[nodiscard]] inline operator bool() const noexcept
+				{
+					return record_;
+				}
+
+				///@}
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns the name of this object
+				[[nodiscard]] inline auto Name() const noexcept
+				{
+					return record_ ? detail::get_string(data_, record_->name) : std::string_view{};
+				}
+
+				///@brief Returns the classes of this object
+				[[nodiscard]] inline auto Classes() const noexcept
+				{
+					return record_ ? detail::get_string(data_, record_->classes) : std::string_view{};
+				}
+
+				///@}
+
+				/**
+					@name Finding
+					@{
+				*/
+
+				///@brief Finds an object (top-level child object) by the given name
+				///@details Returns an invalid object view if the given object is not found
+				[[nodiscard]] ObjectView Find(std::string_view name) const noexcept;
+
+				///@brief Finds a property by the given name
+				///@details Returns an invalid property view if the given property is not found
+				[[nodiscard]] PropertyView Property(std::string_view name) const noexcept;
+
+				///@}
+
+				/**
+					@name Ranges
+					@{
+				*/
+
+				///@brief Returns an immutable range of all top-level child objects in this object
+				///@details This can be used directly with a range-based for loop
+				[[nodiscard]] ObjectViews Objects() const noexcept;
+
+				///@brief Returns an immutable range of all properties in this object
+				///@details This can be used directly with a range-based for loop
+				[[nodiscard]] PropertyViews Properties() const noexcept;
+
+				///@}
+		};
+
+		///@brief A class representing a read-only view of a property node
+		///@details Names are viewed directly from the underlying buffer
+		class PropertyView final
+		{
+			private:
+
+				const std::byte *data_ = nullptr;
+				const detail::property_record *record_ = nullptr;
+
+			public:
+
+				///@brief Constructs an invalid property view
+				PropertyView() = default;
+
+				///@brief Constructs a new property view with the given data and record
+				PropertyView(const std::byte *data, const detail::property_record *record) noexcept;
+
+
+				/**
+					@name Operators
+					@{
+				*/
+
+				///@brief Returns true if this property view is valid
+				[[nodiscard]] inline operator bool() const noexcept
+				{
+					return record_;
+				}
+
+				///@brief Returns the argument at the given argument number
+				[[nodiscard]] ArgumentView operator[](int number) const noexcept;
+
+				///@}
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns the name of the property
+				[[nodiscard]] inline auto Name() const noexcept
+				{
+					return record_ ? detail::get_string(data_, record_->name) : std::string_view{};
+				}
+
+				///@}
+
+				/**
+					@name Arguments
+					@{
+				*/
+
+				///@brief Returns the argument at the given argument number
+				///@details Returns an invalid argument view if the given argument number is out of range
+				[[nodiscard]] ArgumentView Argument(int number) const noexcept;
+
+				///@brief Returns the number of arguments in this property
+				[[nodiscard]] inline auto NumberOfArguments() const noexcept
+				{
+					return record_ ? static_cast<int>(record_->argument_count) : 0;
+				}
+
+				///@}
+
+				/**
+					@name Ranges
+					@{
+				*/
+
+				///@brief Returns an immutable range of all arguments in this property
+				///@details This can be used directly with a range-based for loop
+				[[nodiscard]] ArgumentViews Arguments() const noexcept;
+
+				///@}
+		};
+
+		///@brief A class representing a read-only view of an argument node
+		///@details The value of the argument is decoded lazily, when retrieved
+		class ArgumentView final
+		{
+			private:
+
+				const std::byte *data_ = nullptr;
+				const detail::argument_record *record_ = nullptr;
+
+			public:
+
+				///@brief Constructs an invalid argument view
+				ArgumentView() = default;
+
+				///@brief Constructs a new argument view with the given data and record
+				ArgumentView(const std::byte *data, const detail::argument_record *record) noexcept;
+
+
+				/**
+					@name Operators
+					@{
+				*/
+
+				///@brief Returns true if this argument view is valid
+				[[nodiscard]] inline operator bool() const noexcept
+				{
+					return record_;
+				}
+
+				///@}
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns true if the argument has the given argument type
+				template <typename T>
+				[[nodiscard]] inline auto Is() const noexcept
+				{
+					return record_ && record_->type == script_tree::detail::variant_index<script_tree::ArgumentType, T>();
+				}
+
+				///@brief Returns the value of the argument with the given argument type
+				///@details Only the requested value is decoded. Integers can be retrieved as floating points (non-narrowing)
+				template <typename T>
+				[[nodiscard]] inline std::optional<T> Get() const
+				{
+					if constexpr (std::is_same_v<T, ScriptType::FloatingPoint>)
+					{
+						//Try to get as integer
+						if (Is<ScriptType::Integer>())
+							//Okay, non-narrowing
+							return ScriptType::FloatingPoint{static_cast<ScriptType::FloatingPoint::value_type>(
+								detail::get_value<ScriptType::Integer::value_type>(*record_))};
+					}
+
+					if (!Is<T>())
+						return {};
+
+					if constexpr (std::is_same_v<T, ScriptType::Enumerable> || std::is_same_v<T, ScriptType::String>)
+						return T{std::string{detail::get_string(data_, detail::get_value<detail::string_ref>(*record_))}};
+					else if constexpr (std::is_same_v<T, ScriptType::Color>)
+					{
+						auto [r, g, b, a] = detail::get_value<std::array<real, 4>>(*record_);
+						return T{{r, g, b, a}};
+					}
+					else if constexpr (std::is_same_v<T, ScriptType::Vector2>)
+					{
+						auto [x, y] = detail::get_value<std::array<real, 2>>(*record_);
+						return T{{x, y}};
+					}
+					else if constexpr (std::is_same_v<T, ScriptType::Vector3>)
+					{
+						auto [x, y, z] = detail::get_value<std::array<real, 3>>(*record_);
+						return T{{x, y, z}};
+					}
+					else
+						return T{detail::get_value<typename T::value_type>(*record_)};
+				}
+
+				///@brief Returns the string value of the argument without copying it
+				///@details Returns nullopt if the argument is not a string or an enumerable
+				[[nodiscard]] std::optional<std::string_view> GetView() const noexcept;
+
+				///@brief Returns the decoded argument
+				///@details Returns nullopt if this argument view is invalid
+				[[nodiscard]] std::optional<script_tree::ArgumentType> Decode() const;
+
+				///@brief Calls the correct overload for the given overload set, based on the decoded value of the argument
+				template <typename T, typename ...Ts>
+				inline auto Visit(T &&callable, Ts &&...callables) const
+				{
+					assert(*this);
+					return std::visit(types::overloaded{std::forward<T>(callable), std::forward<Ts>(callables)...}, *Decode());
+				}
+
+				///@brief Returns the unit of this argument
+				[[nodiscard]] inline auto Unit() const noexcept
+				{
+					return record_ ? detail::get_string(data_, record_->unit) : std::string_view{};
+				}
+
+				///@}
+		};
+
+
+		namespace detail
+		{
+			/*
+				Serializing
+			*/
+
+			std::vector<std::byte> serialize(const adaptors::ranges::Iterable<const script_tree::ObjectNodes&> &objects);
+
+
+			/*
+				Validating
+			*/
+
+			bool is_valid_string(const header &h, string_ref ref) noexcept;
+			bool is_valid(std::string_view bytes) noexcept;
+		} //detail
+	} //script_tree_view
+
+
+	///@brief A class representing a read-only view of a script tree, stored in an offset based binary format
+	///@details The binary format is navigated in place, directly from a given buffer (memory mapped, loaded from a repository etc.).
+	///No nodes, names or strings are allocated when deserializing, and arguments are decoded lazily when retrieved.
+	///The given buffer must be at least 4 byte aligned, and must outlive the view
+	class ScriptTreeView final
+	{
+		private:
+
+			const std::byte *data_ = nullptr;
+
+		public:
+
+			///@brief Constructs an empty script tree view
+			ScriptTreeView() = default;
+
+
+			/**
+				@name Operators
+				@{
+			*/
+
+			///@brief Returns true if this script tree view is viewing a tree
+			[[nodiscard]] inline operator bool() const noexcept
+			{
+				return data_;
+			}
+
+			///@}
+
+			/**
+				@name Finding/searching
+				@{
+			*/
+
+			///@brief Finds an object (top-level object) by the given name
+			///@details Returns an invalid object view if the given object is not found
+			[[nodiscard]] script_tree_view::ObjectView Find(std::string_view name) const noexcept;
+
+			///@brief Searches for an object (all objects) by the given name, breadth first
+			///@details Returns an invalid object view if the given object is not found
+			[[nodiscard]] script_tree_view::ObjectView Search(std::string_view name) const noexcept;
+
+			///@}
+
+			/**
+				@name Ranges
+				@{
+			*/
+
+			///@brief Returns an immutable range of all top-level objects in this script tree view
+			///@details This can be used directly with a range-based for loop
+			[[nodiscard]] script_tree_view::ObjectViews Objects() const noexcept;
+
+			///@brief Returns an immutable (BFS) range of all objects in this script tree view
+			///@details The objects are stored in breadth first order, so no search is needed
+			[[nodiscard]] script_tree_view::ObjectViews BreadthFirstSearch() const noexcept;
+
+			///@}
+
+			/**
+				@name Serializing
+				@{
+			*/
+
+			///@brief Deserializes (views) the given bytes as a script tree, without copying them
+			///@details Returns nullopt if the given bytes are not a valid (or aligned) script tree view
+			[[nodiscard]] static std::optional<ScriptTreeView> Deserialize(std::string_view bytes) noexcept;
+
+			///@brief Serializes the given script tree to a byte array, in the offset based binary format
+			[[nodiscard]] static std::vector<std::byte> Serialize(const ScriptTree &tree);
+
+			///@}
+	};
+} //ion::script
+
+#endif
\ No newline at end of file
@@ -219,35 +219,6 @@ declarations_result find_all_declarations(const ClassDefinition &root, const Cla
 }
 
 
-class_definition_cacher::class_definition_cacher(const ClassDefinition &root) noexcept :
-	root_{root}
-{
-	//Empty
-}
-
-const ClassDefinition* class_definition_cacher::Get(const class_reference &class_ref)
-{
-	auto iter = cache_.find(class_ref);
-	return iter == std::end(cache_) ?
-		cache_.emplace(class_ref, find_class_definition(root_, class_ref)).first->second :
-		iter->second;
-}
-
-class_declarations_cacher::class_declarations_cacher(const ClassDefinition &root) noexcept :
-	root_{root}
-{
-	//Empty
-}
-
-const declarations_result& class_declarations_cacher::Get(const ClassDefinition &class_def)
-{
-	auto iter = cache_.find(&class_def);
-	return iter == std::end(cache_) ?
-		cache_.emplace(&class_def, find_all_declarations(root_, class_def)).first->second :
-		iter->second;
-}
-
-
 /*
 	Validating
 */
@@ -458,11 +429,11 @@ bool validate_property(const script_tree::PropertyNode &property, const property
 	return match;
 }
 
-bool validate_properties(const ScriptTree &tree, const script_tree::ObjectNode &object, const ClassDefinition &class_def,
-	class_declarations_cacher &declarations_cacher, std::vector<ValidateError> &errors)
+bool validate_properties(const ScriptTree &tree, const script_tree::ObjectNode &object, const schema_class &class_schema,
+	std::vector<ValidateError> &errors)
 {
-	auto &[inner_classes, properties] = declarations_cacher.Get(class_def);
-	auto required_properties = get_required_properties(properties);
+	auto &properties = class_schema.Properties;
+	auto required_properties = class_schema.RequiredProperties;
 	ValidateError error;
 
 	for (auto &property : object.Properties())
@@ -495,70 +466,45 @@ bool validate_properties(const ScriptTree &tree, const script_tree::ObjectNode &
 	return !error;
 }
 
-const ClassDefinition* validate_class(const ScriptTree &tree, const script_tree::ObjectNode &object, const ClassDefinition &class_owner,
-	class_definition_cacher &definition_cacher, class_declarations_cacher &declarations_cacher, std::vector<ValidateError> &errors)
+const schema_class* validate_class(const ScriptTree &tree, const script_tree::ObjectNode &object, const schema_class &class_owner,
+	const schema_classes &classes, std::vector<ValidateError> &errors)
 {
-	auto &[inner_classes, properties] = declarations_cacher.Get(class_owner);
-	const inner_class_declarations::value_type *class_candidate = nullptr;
-	ValidateError error;
+	auto iter = class_owner.InnerClasses.find(object.Name());
 
-	if (auto iter = inner_classes.find(object.Name());
-		iter != std::end(inner_classes))
+	if (iter == std::end(class_owner.InnerClasses))
 	{
-		//Check closest candidate with definition
-		for (auto &candidate : iter->second)
-		{
-			if (class_candidate &&
-				class_candidate->Depth < candidate.Depth)
-				break; //Unambiguous definition found
-
-			//Ambiguous definition found
-			if (class_candidate)
-			{
-				error = {ValidateErrorCode::AmbiguousClass, *tree.GetFullyQualifiedName(object)};
-				errors.push_back(error);
-				break;
-			}
-			//A candidate found
-			else
-				class_candidate = &candidate;
-		}
+		errors.push_back({ValidateErrorCode::UnexpectedClass, *tree.GetFullyQualifiedName(object)});
+		return nullptr;
 	}
 
-	if (error)
-		return nullptr;
-	else if (!class_candidate)
+	auto &[class_decl, class_index] = iter->second;
+
+	if (!class_decl)
 	{
-		error = {ValidateErrorCode::UnexpectedClass, *tree.GetFullyQualifiedName(object)};
-		errors.push_back(error);
+		errors.push_back({ValidateErrorCode::AmbiguousClass, *tree.GetFullyQualifiedName(object)});
 		return nullptr;
 	}
-	else if (!class_candidate->Declaration->Instantiatable())
+	else if (!class_decl->Instantiatable())
 	{
-		error = {ValidateErrorCode::AbstractClassInstantiated, *tree.GetFullyQualifiedName(object)};
-		errors.push_back(error);
+		errors.push_back({ValidateErrorCode::AbstractClassInstantiated, *tree.GetFullyQualifiedName(object)});
 		return nullptr;
 	}
 
-
-	auto class_def = class_candidate->Declaration->HasDefinition() ?
-		&class_candidate->Declaration->Definition() :
-		definition_cacher.Get({class_candidate->Declaration->Name(), *class_candidate->Owner});
-
 	//Class definition found, validate properties
-	if (class_def)
+	if (class_index >= 0)
 	{
-		validate_properties(tree, object, *class_def, declarations_cacher, errors); //Ignoring return value
-		return class_def;
+		auto &class_schema = classes[class_index];
+		validate_properties(tree, object, class_schema, errors); //Ignoring return value
+		return &class_schema;
 	}
 	else
 		return nullptr;
 }
 
-bool validate(const ScriptTree &tree, const ClassDefinition &root, ValidateError &error, std::vector<ValidateError> &errors)
+bool validate(const ScriptTree &tree, const ValidatorSchema &schema, ValidateError &error, std::vector<ValidateError> &errors)
 {
 	//Start by validating the given tree
-	auto result = validate_tree(tree, root, errors);
+	auto result = validate_tree(tree, schema, errors);
 	
 	//Set to first error
 	if (!std::empty(errors))
@@ -567,24 +513,21 @@ bool validate(const ScriptTree &tree, const ClassDefinition &root, ValidateError
 	return result;
 }
 
-bool validate_tree(const ScriptTree &tree, const ClassDefinition &root, std::vector<ValidateError> &errors)
+bool validate_tree(const ScriptTree &tree, const ValidatorSchema &schema, std::vector<ValidateError> &errors)
 {
 	//No top level (global) classes found
-	if (std::empty(root.InnerClasses()))
+	if (std::empty(schema.Root().InnerClasses()))
 		return true; //Nothing to validate against
 	
 	struct scope
 	{
 		const script_tree::ObjectNode *object;
-		const ClassDefinition &class_def;
+		const schema_class &class_schema;
 		adaptors::FlatSet<std::string_view> required_classes;
 	};
 
-	class_definition_cacher definition_cacher{root};
-	class_declarations_cacher declarations_cacher{root};	
-
-	auto &[root_classes, root_properties] = declarations_cacher.Get(root);
-	std::vector<scope> scopes{{nullptr, root, get_required_classes(root_classes)}};
+	auto &classes = schema.Classes();
+	std::vector<scope> scopes{{nullptr, classes.front(), classes.front().RequiredClasses}};
 	auto next_search_depth = -1;
 	ValidateError error;
 
@@ -615,12 +558,10 @@ bool validate_tree(const ScriptTree &tree, const ClassDefinition &root, std::vec
 			scopes.pop_back();
 		}
 
-		if (auto class_def = validate_class(tree, object, scopes.back().class_def, definition_cacher, declarations_cacher, errors); class_def)
+		if (auto class_schema = validate_class(tree, object, scopes.back().class_schema, classes, errors); class_schema)
 		{
-			auto &[inner_classes, properties] = declarations_cacher.Get(*class_def);
-
-			scopes.back().required_classes.erase(class_def->Name());
-			scopes.push_back({&object, *class_def, get_required_classes(inner_classes)});
+			scopes.back().required_classes.erase(class_schema->Definition->Name());
+			scopes.push_back({&object, *class_schema, class_schema->RequiredClasses});
 		}
 		else
 		{
@@ -971,21 +912,116 @@ ClassDeclaration::ClassDeclaration(ClassDefinition definition, Ordinality ordina
 	//Empty
 }
 
+
+//ValidatorSchema
+//Private
+
+int ValidatorSchema::AddClass(const ClassDefinition &class_def, detail::schema_class_indices &indices)
+{
+	//Class already added (or being added)
+	if (auto iter = indices.find(&class_def); iter != std::end(indices))
+		return iter->second;
+
+	auto index = static_cast<int>(std::size(classes_));
+	indices.emplace(&class_def, index);
+	classes_.emplace_back();
+
+	auto [inner_classes, properties] = detail::find_all_declarations(root_, class_def);
+	detail::schema_class class_schema{&class_def};
+	class_schema.RequiredClasses = detail::get_required_classes(inner_classes);
+	class_schema.RequiredProperties = detail::get_required_properties(properties);
+
+	for (auto &[name, candidates] : inner_classes)
+	{
+		detail::schema_inner_class inner_class;
+
+		//Find closest candidate
+		for (auto &candidate : candidates)
+		{
+			if (inner_class.Declaration &&
+				candidates.front().Depth < candidate.Depth)
+				break; //Unambiguous definition found
+
+			//Ambiguous definition found
+			if (inner_class.Declaration)
+			{
+				inner_class.Declaration = nullptr;
+				break;
+			}
+			//A candidate found
+			else
+				inner_class.Declaration = candidate.Declaration;
+		}
+
+		//Resolve class definition
+		if (inner_class.Declaration && inner_class.Declaration->Instantiatable())
+		{
+			auto &candidate = candidates.front();
+			auto inner_class_def = candidate.Declaration->HasDefinition() ?
+				&candidate.Declaration->Definition() :
+				detail::find_class_definition(root_, {candidate.Declaration->Name(), *candidate.Owner});
+
+			if (inner_class_def)
+				inner_class.Class = AddClass(*inner_class_def, indices);
+		}
+
+		class_schema.InnerClasses.emplace(name, inner_class);
+	}
+
+	class_schema.Properties = std::move(properties);
+	classes_[index] = std::move(class_schema);
+	return index;
+}
+
+
+//Public
+
+ValidatorSchema::ValidatorSchema(ClassDefinition root) :
+	root_{std::move(root)}
+{
+	detail::schema_class_indices indices;
+	AddClass(root_, indices);
+}
+
 } //script_validator
 
 
+//ScriptValidator
+//Private
+
+const ClassDefinition& ScriptValidator::Root() const noexcept
+{
+	return schema_ ? schema_->Root() : root_;
+}
+
+void ScriptValidator::Detach()
+{
+	//Make uncompiled, by taking a copy of the shared root
+	if (schema_)
+	{
+		root_ = schema_->Root();
+		schema_.reset();
+	}
+}
+
+
+//Public
+
+
 /*
 	Classes
 */
 
 ScriptValidator& ScriptValidator::AddClass(std::string name)
 {
+	Detach();
 	root_.AddClass(std::move(name));
 	return *this;
 }
 
 ScriptValidator& ScriptValidator::AddClass(ClassDefinition class_def)
 {
+	Detach();
 	root_.AddClass(std::move(class_def));
 	return *this;
 }
@@ -993,6 +1029,7 @@ ScriptValidator& ScriptValidator::AddClass(ClassDefinition class_def)
 
 ScriptValidator& ScriptValidator::AddAbstractClass(ClassDefinition class_def)
 {
+	Detach();
 	root_.AddAbstractClass(std::move(class_def));
 	return *this;
 }
@@ -1000,12 +1037,14 @@ ScriptValidator& ScriptValidator::AddAbstractClass(ClassDefinition class_def)
 
 ScriptValidator& ScriptValidator::AddRequiredClass(std::string name)
 {
+	Detach();
 	root_.AddRequiredClass(std::move(name));
 	return *this;
 }
 
 ScriptValidator& ScriptValidator::AddRequiredClass(ClassDefinition class_def)
 {
+	Detach();
 	root_.AddRequiredClass(std::move(class_def));
 	return *this;
 }
@@ -1017,7 +1056,23 @@ ScriptValidator& ScriptValidator::AddRequiredClass(ClassDefinition class_def)
 
 const ClassDeclaration* ScriptValidator::GetClass(std::string_view name) const noexcept
 {
-	return root_.GetInnerClass(name);
+	return Root().GetInnerClass(name); //Root may have been moved into a compiled schema
+}
+
+
+/*
+	Compiling
+*/
+
+ScriptValidator& ScriptValidator::Compile()
+{
+	if (!schema_)
+	{
+		schema_ = std::make_shared<const ValidatorSchema>(std::move(root_));
+		root_ = ClassDefinition{{}};
+	}
+
+	return *this;
 }
 
 
@@ -1045,8 +1100,9 @@ bool ScriptValidator::Validate(const ScriptTree &tree, ValidateError &error)
 	validate_errors_.clear();
 	validate_time_ = {}; //Reset
 
+	Compile();
 	auto stopwatch = timers::Stopwatch::StartNew();
-	auto result = script_validator::detail::validate(tree, root_, error, validate_errors_);
+	auto result = script_validator::detail::validate(tree, *schema_, error, validate_errors_);
 	validate_time_ = stopwatch.Elapsed();
 	return result;
 }
@@ -15,6 +15,7 @@ File:	IonScriptValidator.h
 
 #include <cassert>
 #include <initializer_list>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -72,6 +73,8 @@ namespace ion::script
 		struct PropertyDeclaration;
 		class ClassDeclaration;
 
+		class ValidatorSchema;
+
 		using ParameterDefinitions = std::vector<ParameterDefinition>;
 		using PropertyDeclarations = adaptors::FlatSet<PropertyDeclaration>;
 		using ClassDeclarations = adaptors::FlatSet<ClassDeclaration>;
@@ -229,33 +232,33 @@ namespace ion::script
 			const ClassDefinition* find_class_definition(const ClassDefinition &root, const class_reference &class_ref);
 			declarations_result find_all_declarations(const ClassDefinition &root, const ClassDefinition &class_def);
 
+			///@}
 
-			class class_definition_cacher final
-			{
-				private:
-
-					const ClassDefinition &root_;
-					adaptors::FlatMap<class_reference, const ClassDefinition*> cache_;				
-
-				public:
-
-					class_definition_cacher(const ClassDefinition &root) noexcept;
-					const ClassDefinition* Get(const class_reference &class_ref);
-			};
+			/**
+				@name Schema
+				@{
+			*/
 
-			class class_declarations_cacher final
+			struct schema_inner_class final
 			{
-				private:
+				const ClassDeclaration *Declaration = nullptr; //Closest candidate, nullptr if ambiguous
+				int Class = -1; //Index of the resolved schema class, -1 if not resolved
+			};
 
-					const ClassDefinition &root_;
-					adaptors::FlatMap<const ClassDefinition*, declarations_result> cache_;
+			using schema_inner_classes_map = adaptors::FlatMap<std::string_view, schema_inner_class>;
 
-				public:
-
-					class_declarations_cacher(const ClassDefinition &root) noexcept;
-					const declarations_result& Get(const ClassDefinition &class_def);
+			struct schema_class final
+			{
+				const ClassDefinition *Definition = nullptr;
+				schema_inner_classes_map InnerClasses;
+				properties_map Properties;
+				adaptors::FlatSet<std::string_view> RequiredClasses;
+				adaptors::FlatSet<std::string_view> RequiredProperties;
 			};
 
+			using schema_classes = std::vector<schema_class>;
+			using schema_class_indices = adaptors::FlatMap<const ClassDefinition*, int>;
+
 			///@}
 
 			/**
@@ -267,13 +270,13 @@ namespace ion::script
 			adaptors::FlatSet<std::string_view> get_required_classes(const inner_classes_map &inner_classes);
 
 			bool validate_property(const script_tree::PropertyNode &property, const property_declarations &overload_set, bool required);
-			bool validate_properties(const ScriptTree &tree, const script_tree::ObjectNode &object, const ClassDefinition &class_def,
-				class_declarations_cacher &declarations_cacher, std::vector<ValidateError> &errors);
-			const ClassDefinition* validate_class(const ScriptTree &tree, const script_tree::ObjectNode &object, const ClassDefinition &class_owner,
-				class_definition_cacher &definition_cacher, class_declarations_cacher &declarations_cacher, std::vector<ValidateError> &errors);
+			bool validate_properties(const ScriptTree &tree, const script_tree::ObjectNode &object, const schema_class &class_schema,
+				std::vector<ValidateError> &errors);
+			const schema_class* validate_class(const ScriptTree &tree, const script_tree::ObjectNode &object, const schema_class &class_owner,
+				const schema_classes &classes, std::vector<ValidateError> &errors);
 
-			bool validate(const ScriptTree &tree, const ClassDefinition &root, ValidateError &error, std::vector<ValidateError> &errors);
-			bool validate_tree(const ScriptTree &tree, const ClassDefinition &root, std::vector<ValidateError> &errors);
+			bool validate(const ScriptTree &tree, const ValidatorSchema &schema, ValidateError &error, std::vector<ValidateError> &errors);
+			bool validate_tree(const ScriptTree &tree, const ValidatorSchema &schema, std::vector<ValidateError> &errors);
 
 			///@}
 
@@ -620,6 +623,53 @@ namespace ion::script
 
 				///@}
 		};
+
+
+		///@brief A class representing an immutable, pre-flattened validation schema
+		///@details All classes reachable from the root are resolved once, each with its fully inherited property and inner class tables.
+		///Validating against a schema does not modify it, so one schema can be shared by many validators (and threads)
+		class ValidatorSchema final
+		{
+			private:
+
+				ClassDefinition root_;
+				detail::schema_classes classes_;
+
+
+				int AddClass(const ClassDefinition &class_def, detail::schema_class_indices &indices);
+
+			public:
+
+				///@brief Constructs a new schema by taking ownership of the given root class definition
+				explicit ValidatorSchema(ClassDefinition root);
+
+				///@brief Deleted copy constructor
+				ValidatorSchema(const ValidatorSchema&) = delete;
+
+				///@brief Deleted copy assignment
+				ValidatorSchema& operator=(const ValidatorSchema&) = delete;
+
+
+				/**
+					@name Observers
+					@{
+				*/
+
+				///@brief Returns the root class definition of this schema
+				[[nodiscard]] inline auto& Root() const noexcept
+				{
+					return root_;
+				}
+
+				///@brief Returns all resolved classes of this schema
+				///@details The first class is always the root
+				[[nodiscard]] inline auto& Classes() const noexcept
+				{
+					return classes_;
+				}
+
+				///@}
+		};
 	} //script_validator
 
 
@@ -631,9 +681,14 @@ namespace ion::script
 		private:
 
 			script_validator::ClassDefinition root_{{}};
+			std::shared_ptr<const script_validator::ValidatorSchema> schema_;
 
 			std::vector<ValidateError> validate_errors_;
 			duration validate_time_{};
+
+
+			const script_validator::ClassDefinition& Root() const noexcept;
+			void Detach();
     
 		public:
 
@@ -670,6 +725,25 @@ namespace ion::script
 				return validate_time_;
 			}
 
+			///@brief Returns the compiled schema of this validator
+			///@details Returns nullptr if this validator has not been compiled
+			[[nodiscard]] inline auto& Schema() const noexcept
+			{
+				return schema_;
+			}
+
+			///@}
+
+			/**
+				@name Compiling
+				@{
+			*/
+
+			///@brief Compiles the validation scheme into an immutable schema, if not already compiled
+			///@details Copies of a compiled validator shares the same schema, which makes them cheap to copy.
+			///Adding classes to a compiled validator will make it uncompiled again (without affecting any copies)
+			ScriptValidator& Compile();
+
 			///@}
 
 			/**
@@ -724,6 +798,7 @@ namespace ion::script
 			*/
 
 			///@brief Returns true if this validator validates the given script tree
+			///@details Compiles the validation scheme first, if not already compiled
 			[[nodiscard]] bool Validate(const ScriptTree &tree, ValidateError &error);
 
 			///@}
@@ -737,7 +812,7 @@ namespace ion::script
 			///@details This can be used directly with a range-based for loop
 			[[nodiscard]] inline auto Classes() const noexcept
 			{
-				return root_.InnerClasses();
+				return Root().InnerClasses();
 			}
 
 			///@}
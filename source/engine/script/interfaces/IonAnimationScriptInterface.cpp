@@ -20,6 +20,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace animation_script_interface;
 using namespace graphics::textures;
@@ -81,44 +82,80 @@ void set_animation_properties(const script_tree::ObjectNode &object, Animation &
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "cycle-percent")
+		switch (property.NameAtom())
+		{
+			case "cycle-percent"_atom:
 			animation.CyclePercent(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "cycle-time")
+			break;
+
+			case "cycle-time"_atom:
 			animation.CycleTime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "direction")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "normal")
-				animation.Direction(animation::PlaybackDirection::Normal);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "reverse")
-				animation.Direction(animation::PlaybackDirection::Reverse);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "alternate")
-				animation.Direction(animation::PlaybackDirection::Alternate);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "alternate-reverse")
-				animation.Direction(animation::PlaybackDirection::AlternateReverse);
-		}
-		else if (property.Name() == "frame-rate")
+			break;
+
+			case "direction"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "normal"_atom:
+					animation.Direction(animation::PlaybackDirection::Normal);
+					break;
+
+					case "reverse"_atom:
+					animation.Direction(animation::PlaybackDirection::Reverse);
+					break;
+
+					case "alternate"_atom:
+					animation.Direction(animation::PlaybackDirection::Alternate);
+					break;
+
+					case "alternate-reverse"_atom:
+					animation.Direction(animation::PlaybackDirection::AlternateReverse);
+					break;
+				}
+				break;
+			}
+
+			case "frame-rate"_atom:
 			animation.FrameRate(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "jump-backward")
+			break;
+
+			case "jump-backward"_atom:
 			animation.JumpBackward(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "jump-forward")
+			break;
+
+			case "jump-forward"_atom:
 			animation.JumpForward(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "playback-rate")
+			break;
+
+			case "playback-rate"_atom:
 			animation.PlaybackRate(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "repeat-count")
+			break;
+
+			case "repeat-count"_atom:
 			animation.RepeatCount(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "running")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				animation.Start();
-			else
-				animation.Stop();
-		}
-		else if (property.Name() == "total-duration")
+			break;
+
+			case "running"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					animation.Start();
+				else
+					animation.Stop();
+				break;
+			}
+
+			case "total-duration"_atom:
 			animation.TotalDuration(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "total-percent")
+			break;
+
+			case "total-percent"_atom:
 			animation.TotalPercent(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "total-time")
+			break;
+
+			case "total-time"_atom:
 			animation.TotalTime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
+			break;
+		}
 	}
 }
 
@@ -150,8 +187,12 @@ void create_animations(const ScriptTree &tree,
 {
 	for (auto &object : tree.Objects())
 	{
-		if (object.Name() == "animation")
+		switch (object.NameAtom())
+		{
+			case "animation"_atom:
 			create_animation(object, animation_manager, managers);
+			break;
+		}
 	}
 }
 
@@ -162,7 +203,8 @@ void create_animations(const ScriptTree &tree,
 
 ScriptValidator AnimationScriptInterface::GetValidator() const
 {
-	return detail::get_animation_validator();
+	static const auto validator = detail::get_animation_validator().Compile();
+	return validator;
 }
 
 
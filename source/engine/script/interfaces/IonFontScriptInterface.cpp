@@ -18,6 +18,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace font_script_interface;
 using namespace graphics::fonts;
@@ -109,8 +110,12 @@ void create_fonts(const ScriptTree &tree,
 {
 	for (auto &object : tree.Objects())
 	{
-		if (object.Name() == "font")
+		switch (object.NameAtom())
+		{
+			case "font"_atom:
 			create_font(object, font_manager);
+			break;
+		}
 	}
 }
 
@@ -121,7 +126,8 @@ void create_fonts(const ScriptTree &tree,
 
 ScriptValidator FontScriptInterface::GetValidator() const
 {
-	return detail::get_font_validator();
+	static const auto validator = detail::get_font_validator().Compile();
+	return validator;
 }
 
 
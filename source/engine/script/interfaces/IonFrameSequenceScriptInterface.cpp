@@ -19,6 +19,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace frame_sequence_script_interface;
 using namespace graphics::textures;
@@ -87,8 +88,12 @@ NonOwningPtr<FrameSequence> create_frame_sequence(const script_tree::ObjectNode
 
 		for (auto &property : object.Properties())
 		{
-			if (property.Name() == "frame")
+			switch (property.NameAtom())
+			{
+				case "frame"_atom:
 				frames.push_back(get_texture(property[0].Get<ScriptType::String>()->Get(), managers));
+				break;
+			}
 		}
 
 		if (!std::empty(frames))
@@ -103,8 +108,12 @@ void create_frame_sequences(const ScriptTree &tree,
 {
 	for (auto &object : tree.Objects())
 	{
-		if (object.Name() == "frame-sequence")
+		switch (object.NameAtom())
+		{
+			case "frame-sequence"_atom:
 			create_frame_sequence(object, frame_sequence_manager, managers);
+			break;
+		}
 	}
 }
 
@@ -115,7 +124,8 @@ void create_frame_sequences(const ScriptTree &tree,
 
 ScriptValidator FrameSequenceScriptInterface::GetValidator() const
 {
-	return detail::get_frame_sequence_validator();
+	static const auto validator = detail::get_frame_sequence_validator().Compile();
+	return validator;
 }
 
 
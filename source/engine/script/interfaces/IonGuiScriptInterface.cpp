@@ -25,6 +25,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace gui_script_interface;
 using namespace gui;
@@ -360,23 +361,31 @@ void set_panel_grid_properties(const script_tree::ObjectNode &object, gui_panel:
 {
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "cell")
+		switch (obj.NameAtom())
 		{
-			auto row = obj
-				.Property("row")[0]
-				.Get<ScriptType::Integer>()->As<int>();
-			auto column = obj
-				.Property("column")[0]
-				.Get<ScriptType::Integer>()->As<int>();
-
-			set_panel_grid_cell_properties(obj, grid[{row, column}], panel);
+			case "cell"_atom:
+			{
+				auto row = obj
+					.Property("row")[0]
+					.Get<ScriptType::Integer>()->As<int>();
+				auto column = obj
+					.Property("column")[0]
+					.Get<ScriptType::Integer>()->As<int>();
+
+				set_panel_grid_cell_properties(obj, grid[{row, column}], panel);
+				break;
+			}
 		}
 	}
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "size-percentage")
+		switch (property.NameAtom())
+		{
+			case "size-percentage"_atom:
 			grid.SizePercentage(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
@@ -385,28 +394,52 @@ void set_panel_grid_cell_properties(const script_tree::ObjectNode &object, gui_p
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "alignment")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "left")
-				cell.Alignment(gui_panel::GridCellAlignment::Left);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "center")
-				cell.Alignment(gui_panel::GridCellAlignment::Center);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "right")
-				cell.Alignment(gui_panel::GridCellAlignment::Right);
-		}
-		else if (property.Name() == "attach")
-		{
-			if (auto control = panel.GetControl(property[0].Get<ScriptType::String>()->Get()); control)
-				cell.AttachControl(control);
-		}
-		else if (property.Name() == "vertical-alignment")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "top")
-				cell.VerticalAlignment(gui_panel::GridCellVerticalAlignment::Top);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "middle")
-				cell.VerticalAlignment(gui_panel::GridCellVerticalAlignment::Middle);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "bottom")
-				cell.VerticalAlignment(gui_panel::GridCellVerticalAlignment::Bottom);
+			case "alignment"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "left"_atom:
+					cell.Alignment(gui_panel::GridCellAlignment::Left);
+					break;
+
+					case "center"_atom:
+					cell.Alignment(gui_panel::GridCellAlignment::Center);
+					break;
+
+					case "right"_atom:
+					cell.Alignment(gui_panel::GridCellAlignment::Right);
+					break;
+				}
+				break;
+			}
+
+			case "attach"_atom:
+			{
+				if (auto control = panel.GetControl(property[0].Get<ScriptType::String>()->Get()); control)
+					cell.AttachControl(control);
+				break;
+			}
+
+			case "vertical-alignment"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "top"_atom:
+					cell.VerticalAlignment(gui_panel::GridCellVerticalAlignment::Top);
+					break;
+
+					case "middle"_atom:
+					cell.VerticalAlignment(gui_panel::GridCellVerticalAlignment::Middle);
+					break;
+
+					case "bottom"_atom:
+					cell.VerticalAlignment(gui_panel::GridCellVerticalAlignment::Bottom);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -416,26 +449,44 @@ void set_gui_properties(const script_tree::ObjectNode &object, GuiController &gu
 {
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "frame")
+		switch (obj.NameAtom())
+		{
+			case "frame"_atom:
 			create_gui_frame(obj, gui_controller, scene_manager, managers);
-		else if (obj.Name() == "mouse-cursor")
+			break;
+
+			case "mouse-cursor"_atom:
 			create_gui_mouse_cursor(obj, gui_controller, scene_manager, managers);
-		else if (obj.Name() == "tooltip")
+			break;
+
+			case "tooltip"_atom:
 			create_gui_tooltip(obj, gui_controller, scene_manager, managers);
+			break;
+		}
 	}
 
 	set_component_properties(object, gui_controller, scene_manager, managers);
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "active-mouse-cursor")
+		switch (property.NameAtom())
+		{
+			case "active-mouse-cursor"_atom:
 			gui_controller.ActiveMouseCursor(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "active-theme")
+			break;
+
+			case "active-theme"_atom:
 			gui_controller.ActiveTheme(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "active-tooltip")
+			break;
+
+			case "active-tooltip"_atom:
 			gui_controller.ActiveTooltip(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "sounds-enabled")
+			break;
+
+			case "sounds-enabled"_atom:
 			gui_controller.SoundsEnabled(property[0].Get<ScriptType::Boolean>()->Get());
+			break;
+		}
 	}
 }
 
@@ -444,26 +495,44 @@ void set_component_properties(const script_tree::ObjectNode &object, GuiComponen
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "enabled")
+		switch (property.NameAtom())
+		{
+			case "enabled"_atom:
 			component.Enabled(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "global-position")
+			break;
+
+			case "global-position"_atom:
 			component.GlobalPosition(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "global-z-order")
+			break;
+
+			case "global-z-order"_atom:
 			component.GlobalZOrder(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			component.Position(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "visible")
+			break;
+
+			case "visible"_atom:
 			component.Visible(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "z-order")
+			break;
+
+			case "z-order"_atom:
 			component.ZOrder(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "scene-node")
+		switch (obj.NameAtom())
 		{
-			if (auto node = component.Node(); node)
-				scene_script_interface::detail::set_scene_node_properties(obj, *node, scene_manager, managers);
+			case "scene-node"_atom:
+			{
+				if (auto node = component.Node(); node)
+					scene_script_interface::detail::set_scene_node_properties(obj, *node, scene_manager, managers);
+				break;
+			}
 		}
 	}
 }
@@ -475,18 +544,34 @@ void set_frame_properties(const script_tree::ObjectNode &object, GuiFrame &frame
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "activated")
+		switch (property.NameAtom())
+		{
+			case "activated"_atom:
 			frame.Activated(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "active-theme")
+			break;
+
+			case "active-theme"_atom:
 			frame.ActiveTheme(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "focused")
+			break;
+
+			case "focused"_atom:
 			frame.Focused(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "show")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "modeless")
-				frame.Show(gui_frame::FrameMode::Modeless);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "modal")
-				frame.Show(gui_frame::FrameMode::Modal);
+			break;
+
+			case "show"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "modeless"_atom:
+					frame.Show(gui_frame::FrameMode::Modeless);
+					break;
+
+					case "modal"_atom:
+					frame.Show(gui_frame::FrameMode::Modal);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -498,29 +583,37 @@ void set_panel_properties(const script_tree::ObjectNode &object, GuiPanel &panel
 
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "grid")
+		switch (obj.NameAtom())
 		{
-			auto rows = obj
-				.Property("rows")[0]
-				.Get<ScriptType::Integer>()->As<int>();
-			auto columns = obj
-				.Property("columns")[0]
-				.Get<ScriptType::Integer>()->As<int>();
-			auto size = obj
-				.Property("size")[0]
-				.Get<ScriptType::Vector2>().value_or(vector2::Zero).Get();
-
-			if (size != vector2::Zero)
-				set_panel_grid_properties(obj, panel.GridLayout(rows, columns, size), panel);
-			else
-				set_panel_grid_properties(obj, panel.GridLayout(rows, columns), panel);
+			case "grid"_atom:
+			{
+				auto rows = obj
+					.Property("rows")[0]
+					.Get<ScriptType::Integer>()->As<int>();
+				auto columns = obj
+					.Property("columns")[0]
+					.Get<ScriptType::Integer>()->As<int>();
+				auto size = obj
+					.Property("size")[0]
+					.Get<ScriptType::Vector2>().value_or(vector2::Zero).Get();
+
+				if (size != vector2::Zero)
+					set_panel_grid_properties(obj, panel.GridLayout(rows, columns, size), panel);
+				else
+					set_panel_grid_properties(obj, panel.GridLayout(rows, columns), panel);
+				break;
+			}
 		}
 	}
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "tab-order")
+		switch (property.NameAtom())
+		{
+			case "tab-order"_atom:
 			panel.TabOrder(property[0].Get<ScriptType::Integer>()->As<int>());
+			break;
+		}
 	}
 }
 
@@ -529,32 +622,57 @@ void set_panel_container_properties(const script_tree::ObjectNode &object, GuiPa
 {
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "panel")
+		switch (obj.NameAtom())
+		{
+			case "panel"_atom:
 			create_gui_panel(obj, container, scene_manager, managers);
+			break;
 
-		//Controls
-		else if (obj.Name() == "button")
+			//Controls
+			case "button"_atom:
 			create_gui_button(obj, container, scene_manager, managers);
-		else if (obj.Name() == "check-box")
+			break;
+
+			case "check-box"_atom:
 			create_gui_check_box(obj, container, scene_manager, managers);
-		else if (obj.Name() == "group-box")
+			break;
+
+			case "group-box"_atom:
 			create_gui_group_box(obj, container, scene_manager, managers);
-		else if (obj.Name() == "image")
+			break;
+
+			case "image"_atom:
 			create_gui_image(obj, container, scene_manager, managers);
-		else if (obj.Name() == "label")
+			break;
+
+			case "label"_atom:
 			create_gui_label(obj, container, scene_manager, managers);
-		else if (obj.Name() == "list-box")
+			break;
+
+			case "list-box"_atom:
 			create_gui_list_box(obj, container, scene_manager, managers);
-		else if (obj.Name() == "progress-bar")
+			break;
+
+			case "progress-bar"_atom:
 			create_gui_progress_bar(obj, container, scene_manager, managers);
-		else if (obj.Name() == "radio-button")
+			break;
+
+			case "radio-button"_atom:
 			create_gui_radio_button(obj, container, scene_manager, managers);
-		else if (obj.Name() == "scroll-bar")
+			break;
+
+			case "scroll-bar"_atom:
 			create_gui_scroll_bar(obj, container, scene_manager, managers);
-		else if (obj.Name() == "slider")
+			break;
+
+			case "slider"_atom:
 			create_gui_slider(obj, container, scene_manager, managers);
-		else if (obj.Name() == "text-box")
+			break;
+
+			case "text-box"_atom:
 			create_gui_text_box(obj, container, scene_manager, managers);
+			break;
+		}
 	}
 
 	set_component_properties(object, container, scene_manager, managers);
@@ -568,56 +686,98 @@ void set_button_properties(const script_tree::ObjectNode &object, controls::GuiB
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "action")
+		switch (property.NameAtom())
 		{
-			auto action = property[0]
-				.Get<ScriptType::Enumerable>()->Get();
-
-			if (action == "show-gui")
-				button.AddAction({controls::gui_button::ButtonActionType::ShowGui, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "hide-gui")
-				button.AddAction({controls::gui_button::ButtonActionType::HideGui, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "enable-gui")
-				button.AddAction({controls::gui_button::ButtonActionType::EnableGui, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "disable-gui")
-				button.AddAction({controls::gui_button::ButtonActionType::DisableGui, property[1].Get<ScriptType::String>()->Get()});
-
-			else if (action == "show-frame")
-				button.AddAction({controls::gui_button::ButtonActionType::ShowFrame, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "show-frame-modal")
-				button.AddAction({controls::gui_button::ButtonActionType::ShowFrameModal, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "hide-frame")
-				button.AddAction({controls::gui_button::ButtonActionType::HideFrame, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "enable-frame")
-				button.AddAction({controls::gui_button::ButtonActionType::EnableFrame, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "disable-frame")
-				button.AddAction({controls::gui_button::ButtonActionType::DisableFrame, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "focus-frame")
-				button.AddAction({controls::gui_button::ButtonActionType::FocusFrame, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "defocus-frame")
-				button.AddAction({controls::gui_button::ButtonActionType::DefocusFrame, property[1].Get<ScriptType::String>()->Get()});
-
-			else if (action == "show-panel")
-				button.AddAction({controls::gui_button::ButtonActionType::ShowPanel, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "hide-panel")
-				button.AddAction({controls::gui_button::ButtonActionType::HidePanel, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "enable-panel")
-				button.AddAction({controls::gui_button::ButtonActionType::EnablePanel, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "disable-panel")
-				button.AddAction({controls::gui_button::ButtonActionType::DisablePanel, property[1].Get<ScriptType::String>()->Get()});
-
-			else if (action == "show-control")
-				button.AddAction({controls::gui_button::ButtonActionType::ShowControl, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "hide-control")
-				button.AddAction({controls::gui_button::ButtonActionType::HideControl, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "enable-control")
-				button.AddAction({controls::gui_button::ButtonActionType::EnableControl, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "disable-control")
-				button.AddAction({controls::gui_button::ButtonActionType::DisableControl, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "focus-control")
-				button.AddAction({controls::gui_button::ButtonActionType::FocusControl, property[1].Get<ScriptType::String>()->Get()});
-			else if (action == "defocus-control")
-				button.AddAction({controls::gui_button::ButtonActionType::DefocusControl, property[1].Get<ScriptType::String>()->Get()});
+			case "action"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "show-gui"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::ShowGui, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "hide-gui"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::HideGui, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "enable-gui"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::EnableGui, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "disable-gui"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::DisableGui, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "show-frame"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::ShowFrame, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "show-frame-modal"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::ShowFrameModal, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "hide-frame"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::HideFrame, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "enable-frame"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::EnableFrame, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "disable-frame"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::DisableFrame, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "focus-frame"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::FocusFrame, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "defocus-frame"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::DefocusFrame, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "show-panel"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::ShowPanel, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "hide-panel"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::HidePanel, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "enable-panel"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::EnablePanel, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "disable-panel"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::DisablePanel, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "show-control"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::ShowControl, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "hide-control"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::HideControl, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "enable-control"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::EnableControl, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "disable-control"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::DisableControl, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "focus-control"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::FocusControl, property[1].Get<ScriptType::String>()->Get()});
+					break;
+
+					case "defocus-control"_atom:
+					button.AddAction({controls::gui_button::ButtonActionType::DefocusControl, property[1].Get<ScriptType::String>()->Get()});
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -629,8 +789,12 @@ void set_check_box_properties(const script_tree::ObjectNode &object, controls::G
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "checked")
+		switch (property.NameAtom())
+		{
+			case "checked"_atom:
 			check_box.Checked(property[0].Get<ScriptType::Boolean>()->Get());
+			break;
+		}
 	}
 }
 
@@ -644,119 +808,196 @@ void set_control_properties(const script_tree::ObjectNode &object, controls::Gui
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "caption")
-			control.Caption(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "caption-layout")
+		switch (property.NameAtom())
 		{
-			auto layout = property[0]
-				.Get<ScriptType::Enumerable>()->Get();
-
-			if (layout == "outside-top-left")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideTopLeft);
-			else if (layout == "outside-top-center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideTopCenter);
-			else if (layout == "outside-top-right")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideTopRight);
-			else if (layout == "outside-left-top")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideLeftTop);
-			else if (layout == "top-left")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::TopLeft);
-			else if (layout == "top-center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::TopCenter);
-			else if (layout == "top-right")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::TopRight);
-			else if (layout == "outside-right-top")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideRightTop);
-			else if (layout == "outside-left-center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideLeftCenter);
-			else if (layout == "left")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::Left);
-			else if (layout == "center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::Center);
-			else if (layout == "right")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::Right);
-			else if (layout == "outside-right-center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideRightCenter);
-			else if (layout == "outside-left-bottom")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideLeftBottom);
-			else if (layout == "bottom-left")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::BottomLeft);
-			else if (layout == "bottom-center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::BottomCenter);
-			else if (layout == "bottom-right")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::BottomRight);
-			else if (layout == "outside-right-bottom")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideRightBottom);
-			else if (layout == "outside-bottom-left")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideBottomLeft);
-			else if (layout == "outside-bottom-center")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideBottomCenter);
-			else if (layout == "outside-bottom-right")
-				control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideBottomRight);
-		}
-		else if (property.Name() == "caption-margin")
+			case "caption"_atom:
+			control.Caption(property[0].Get<ScriptType::String>()->Get());
+			break;
+
+			case "caption-layout"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "outside-top-left"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideTopLeft);
+					break;
+
+					case "outside-top-center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideTopCenter);
+					break;
+
+					case "outside-top-right"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideTopRight);
+					break;
+
+					case "outside-left-top"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideLeftTop);
+					break;
+
+					case "top-left"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::TopLeft);
+					break;
+
+					case "top-center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::TopCenter);
+					break;
+
+					case "top-right"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::TopRight);
+					break;
+
+					case "outside-right-top"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideRightTop);
+					break;
+
+					case "outside-left-center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideLeftCenter);
+					break;
+
+					case "left"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::Left);
+					break;
+
+					case "center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::Center);
+					break;
+
+					case "right"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::Right);
+					break;
+
+					case "outside-right-center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideRightCenter);
+					break;
+
+					case "outside-left-bottom"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideLeftBottom);
+					break;
+
+					case "bottom-left"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::BottomLeft);
+					break;
+
+					case "bottom-center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::BottomCenter);
+					break;
+
+					case "bottom-right"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::BottomRight);
+					break;
+
+					case "outside-right-bottom"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideRightBottom);
+					break;
+
+					case "outside-bottom-left"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideBottomLeft);
+					break;
+
+					case "outside-bottom-center"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideBottomCenter);
+					break;
+
+					case "outside-bottom-right"_atom:
+					control.CaptionLayout(controls::gui_control::ControlCaptionLayout::OutsideBottomRight);
+					break;
+				}
+				break;
+			}
+
+			case "caption-margin"_atom:
 			control.CaptionMargin(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "caption-overflow")
-		{
-			auto overflow = property[0]
-				.Get<ScriptType::Enumerable>()->Get();
-
-			if (overflow == "no-wrap")
-				control.CaptionOverflow(controls::gui_control::ControlCaptionOverflow::NoWrap);
-			else if (overflow == "no-wrap-ellipsis")
-				control.CaptionOverflow(controls::gui_control::ControlCaptionOverflow::NoWrapEllipsis);
-			else if (overflow == "wrap")
-				control.CaptionOverflow(controls::gui_control::ControlCaptionOverflow::Wrap);
-		}
-		else if (property.Name() == "caption-padding")
+			break;
+
+			case "caption-overflow"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "no-wrap"_atom:
+					control.CaptionOverflow(controls::gui_control::ControlCaptionOverflow::NoWrap);
+					break;
+
+					case "no-wrap-ellipsis"_atom:
+					control.CaptionOverflow(controls::gui_control::ControlCaptionOverflow::NoWrapEllipsis);
+					break;
+
+					case "wrap"_atom:
+					control.CaptionOverflow(controls::gui_control::ControlCaptionOverflow::Wrap);
+					break;
+				}
+				break;
+			}
+
+			case "caption-padding"_atom:
 			control.CaptionPadding(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "caption-size")
+			break;
+
+			case "caption-size"_atom:
 			control.CaptionSize(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "enabled")
+			break;
+
+			case "enabled"_atom:
 			control.Enabled(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "focusable")
+			break;
+
+			case "focusable"_atom:
 			control.Focusable(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "focused")
+			break;
+
+			case "focused"_atom:
 			control.Focused(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "hit-box")
-		{
-			if (!has_hit_boxes)
-				hit_boxes.push_back({
-					property[0].Get<ScriptType::Vector2>()->Get(),
-					property[1].Get<ScriptType::Vector2>()->Get()});
-		}
-		else if (property.Name() == "size")
+			break;
+
+			case "hit-box"_atom:
+			{
+				if (!has_hit_boxes)
+					hit_boxes.push_back({
+						property[0].Get<ScriptType::Vector2>()->Get(),
+						property[1].Get<ScriptType::Vector2>()->Get()});
+				break;
+			}
+
+			case "size"_atom:
 			control.Size(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
 
-		//Already set in GuiControl constructor
-		/*else if (property.Name() == "skin")
-		{
-			if (auto owner = control.Owner(); owner)
+			//Already set in GuiControl constructor
+			/*case "skin"_atom:
+			{
+				if (auto owner = control.Owner(); owner)
+				{
+					if (auto skin = get_skin(*owner, property[0].Get<ScriptType::String>()->Get()); skin)
+						control.Skin(*skin);
+				}
+				break;
+			}*/
+
+			case "skin-part-color"_atom:
 			{
-				if (auto skin = get_skin(*owner, property[0].Get<ScriptType::String>()->Get()); skin)
-					control.Skin(*skin);
+				if (property.NumberOfArguments() == 2)
+					control.SkinPartColor(property[0].Get<ScriptType::Color>()->Get(), property[1].Get<ScriptType::String>()->Get());
+				else
+					control.SkinPartColor(property[0].Get<ScriptType::Color>()->Get());
+				break;
 			}
-		}*/
 
-		else if (property.Name() == "skin-part-color")
-		{
-			if (property.NumberOfArguments() == 2)
-				control.SkinPartColor(property[0].Get<ScriptType::Color>()->Get(), property[1].Get<ScriptType::String>()->Get());
-			else
-				control.SkinPartColor(property[0].Get<ScriptType::Color>()->Get());
-		}
-		else if (property.Name() == "skin-part-opacity")
-		{
-			if (property.NumberOfArguments() == 2)
-				control.SkinPartOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>(), property[1].Get<ScriptType::String>()->Get());
-			else
-				control.SkinPartOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		}
+			case "skin-part-opacity"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					control.SkinPartOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>(), property[1].Get<ScriptType::String>()->Get());
+				else
+					control.SkinPartOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+				break;
+			}
 
-		else if (property.Name() == "tab-order")
+			case "tab-order"_atom:
 			control.TabOrder(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "tooltip")
+			break;
+
+			case "tooltip"_atom:
 			control.Tooltip(property[0].Get<ScriptType::String>()->Get());
+			break;
+		}
 	}
 
 	if (!std::empty(hit_boxes))
@@ -770,8 +1011,12 @@ void set_group_box_properties(const script_tree::ObjectNode &object, controls::G
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "attach")
+		switch (property.NameAtom())
+		{
+			case "attach"_atom:
 			group_box.AddControl(property[0].Get<ScriptType::String>()->Get());
+			break;
+		}
 	}
 }
 
@@ -782,37 +1027,53 @@ void set_image_properties(const script_tree::ObjectNode &object, controls::GuiIm
 	
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "fill-color")
+		switch (property.NameAtom())
+		{
+			case "fill-color"_atom:
 			image.FillColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "fill-opacity")
+			break;
+
+			case "fill-opacity"_atom:
 			image.FillOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "mode")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "fill")
-				image.Mode(controls::gui_image::ImageMode::Fill);	
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "fit")
-				image.Mode(controls::gui_image::ImageMode::Fit);
-		}
-		else if (property.Name() == "source")
-		{
-			NonOwningPtr<graphics::materials::Material> enabled;
-			NonOwningPtr<graphics::materials::Material> disabled;
-			NonOwningPtr<graphics::materials::Material> focused;
-			NonOwningPtr<graphics::materials::Material> pressed;
-			NonOwningPtr<graphics::materials::Material> hovered;
-
-			if (property.NumberOfArguments() >= 1)
-				enabled = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
-			if (property.NumberOfArguments() >= 2)
-				disabled = get_material(property[1].Get<ScriptType::String>()->Get(), managers);
-			if (property.NumberOfArguments() >= 3)
-				focused = get_material(property[2].Get<ScriptType::String>()->Get(), managers);
-			if (property.NumberOfArguments() >= 4)
-				pressed = get_material(property[3].Get<ScriptType::String>()->Get(), managers);
-			if (property.NumberOfArguments() >= 5)
-				hovered = get_material(property[4].Get<ScriptType::String>()->Get(), managers);
-
-			image.Source(enabled, disabled, focused, pressed, hovered);
+			break;
+
+			case "mode"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "fill"_atom:
+					image.Mode(controls::gui_image::ImageMode::Fill);	
+					break;
+
+					case "fit"_atom:
+					image.Mode(controls::gui_image::ImageMode::Fit);
+					break;
+				}
+				break;
+			}
+
+			case "source"_atom:
+			{
+				NonOwningPtr<graphics::materials::Material> enabled;
+				NonOwningPtr<graphics::materials::Material> disabled;
+				NonOwningPtr<graphics::materials::Material> focused;
+				NonOwningPtr<graphics::materials::Material> pressed;
+				NonOwningPtr<graphics::materials::Material> hovered;
+
+				if (property.NumberOfArguments() >= 1)
+					enabled = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
+				if (property.NumberOfArguments() >= 2)
+					disabled = get_material(property[1].Get<ScriptType::String>()->Get(), managers);
+				if (property.NumberOfArguments() >= 3)
+					focused = get_material(property[2].Get<ScriptType::String>()->Get(), managers);
+				if (property.NumberOfArguments() >= 4)
+					pressed = get_material(property[3].Get<ScriptType::String>()->Get(), managers);
+				if (property.NumberOfArguments() >= 5)
+					hovered = get_material(property[4].Get<ScriptType::String>()->Get(), managers);
+
+				image.Source(enabled, disabled, focused, pressed, hovered);
+				break;
+			}
 		}
 	}
 }
@@ -833,46 +1094,84 @@ void set_list_box_properties(const script_tree::ObjectNode &object, controls::Gu
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "icon-column-width")
-			list_box.IconColumnWidth(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "icon-layout")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "left")
-				list_box.IconLayout(controls::gui_list_box::ListBoxIconLayout::Left);	
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "right")
-				list_box.IconLayout(controls::gui_list_box::ListBoxIconLayout::Right);
-		}
-		else if (property.Name() == "icon-max-size")
+			case "icon-column-width"_atom:
+			list_box.IconColumnWidth(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+
+			case "icon-layout"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "left"_atom:
+					list_box.IconLayout(controls::gui_list_box::ListBoxIconLayout::Left);	
+					break;
+
+					case "right"_atom:
+					list_box.IconLayout(controls::gui_list_box::ListBoxIconLayout::Right);
+					break;
+				}
+				break;
+			}
+
+			case "icon-max-size"_atom:
 			list_box.IconMaxSize(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "icon-padding")
+			break;
+
+			case "icon-padding"_atom:
 			list_box.IconPadding(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "item")
-		{
-			if (property.NumberOfArguments() == 2)
-				items.emplace_back(property[0].Get<ScriptType::String>()->Get(),
-								   get_material(property[1].Get<ScriptType::String>()->Get(), managers));
-			else
-				items.emplace_back(property[0].Get<ScriptType::String>()->Get());
-		}
-		else if (property.Name() == "item-height-factor")
+			break;
+
+			case "item"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					items.emplace_back(property[0].Get<ScriptType::String>()->Get(),
+									   get_material(property[1].Get<ScriptType::String>()->Get(), managers));
+				else
+					items.emplace_back(property[0].Get<ScriptType::String>()->Get());
+				break;
+			}
+
+			case "item-height-factor"_atom:
 			list_box.ItemHeightFactor(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "item-index")
+			break;
+
+			case "item-index"_atom:
 			list_box.ItemIndex(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "item-layout")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "left")
-				list_box.ItemLayout(controls::gui_list_box::ListBoxItemLayout::Left);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "center")
-				list_box.ItemLayout(controls::gui_list_box::ListBoxItemLayout::Center);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "right")
-				list_box.ItemLayout(controls::gui_list_box::ListBoxItemLayout::Right);
-		}
-		else if (property.Name() == "item-padding")
+			break;
+
+			case "item-layout"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "left"_atom:
+					list_box.ItemLayout(controls::gui_list_box::ListBoxItemLayout::Left);
+					break;
+
+					case "center"_atom:
+					list_box.ItemLayout(controls::gui_list_box::ListBoxItemLayout::Center);
+					break;
+
+					case "right"_atom:
+					list_box.ItemLayout(controls::gui_list_box::ListBoxItemLayout::Right);
+					break;
+				}
+				break;
+			}
+
+			case "item-padding"_atom:
 			list_box.ItemPadding(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "selection-padding")
+			break;
+
+			case "selection-padding"_atom:
 			list_box.SelectionPadding(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "show-icons")
+			break;
+
+			case "show-icons"_atom:
 			list_box.ShowIcons(property[0].Get<ScriptType::Boolean>()->Get());
+			break;
+		}
 	}
 
 	if (!std::empty(items))
@@ -886,29 +1185,50 @@ void set_mouse_cursor_properties(const script_tree::ObjectNode &object, controls
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hot-spot")
+		switch (property.NameAtom())
 		{
-			auto hot_spot = property[0]
-				.Get<ScriptType::Enumerable>()->Get();
-
-			if (hot_spot == "top-left")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::TopLeft);
-			else if (hot_spot == "top-center")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::TopCenter);
-			else if (hot_spot == "top-right")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::TopRight);
-			else if (hot_spot == "left")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::Left);
-			else if (hot_spot == "center")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::Center);
-			else if (hot_spot == "right")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::Right);
-			else if (hot_spot == "bottom-left")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::BottomLeft);
-			else if (hot_spot == "bottom-center")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::BottomCenter);
-			else if (hot_spot == "bottom-right")
-				mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::BottomRight);
+			case "hot-spot"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "top-left"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::TopLeft);
+					break;
+
+					case "top-center"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::TopCenter);
+					break;
+
+					case "top-right"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::TopRight);
+					break;
+
+					case "left"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::Left);
+					break;
+
+					case "center"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::Center);
+					break;
+
+					case "right"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::Right);
+					break;
+
+					case "bottom-left"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::BottomLeft);
+					break;
+
+					case "bottom-center"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::BottomCenter);
+					break;
+
+					case "bottom-right"_atom:
+					mouse_cursor.HotSpot(controls::gui_mouse_cursor::MouseCursorHotSpot::BottomRight);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -920,35 +1240,67 @@ void set_progress_bar_properties(const script_tree::ObjectNode &object, controls
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "flipped")
+		switch (property.NameAtom())
+		{
+			case "flipped"_atom:
 			progress_bar.Flipped(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "interpolation-delay")
+			break;
+
+			case "interpolation-delay"_atom:
 			progress_bar.InterpolationDelay(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "interpolation-time")
+			break;
+
+			case "interpolation-time"_atom:
 			progress_bar.InterpolationTime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "interpolation-type")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "forward")
-				progress_bar.InterpolationType(controls::gui_progress_bar::BarInterpolationType::Forward);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "backward")
-				progress_bar.InterpolationType(controls::gui_progress_bar::BarInterpolationType::Backward);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "bidirectional")
-				progress_bar.InterpolationType(controls::gui_progress_bar::BarInterpolationType::Bidirectional);
-		}
-		else if (property.Name() == "percent")
+			break;
+
+			case "interpolation-type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "forward"_atom:
+					progress_bar.InterpolationType(controls::gui_progress_bar::BarInterpolationType::Forward);
+					break;
+
+					case "backward"_atom:
+					progress_bar.InterpolationType(controls::gui_progress_bar::BarInterpolationType::Backward);
+					break;
+
+					case "bidirectional"_atom:
+					progress_bar.InterpolationType(controls::gui_progress_bar::BarInterpolationType::Bidirectional);
+					break;
+				}
+				break;
+			}
+
+			case "percent"_atom:
 			progress_bar.Percent(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "range")
+			break;
+
+			case "range"_atom:
 			progress_bar.Range(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
 							   property[1].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "type")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "horizontal")
-				progress_bar.Type(controls::gui_progress_bar::ProgressBarType::Horizontal);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "vertical")
-				progress_bar.Type(controls::gui_progress_bar::ProgressBarType::Vertical);
-		}
-		else if (property.Name() == "value")
+			break;
+
+			case "type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "horizontal"_atom:
+					progress_bar.Type(controls::gui_progress_bar::ProgressBarType::Horizontal);
+					break;
+
+					case "vertical"_atom:
+					progress_bar.Type(controls::gui_progress_bar::ProgressBarType::Vertical);
+					break;
+				}
+				break;
+			}
+
+			case "value"_atom:
 			progress_bar.Value(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -959,8 +1311,12 @@ void set_radio_button_properties(const script_tree::ObjectNode &object, controls
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "tag")
+		switch (property.NameAtom())
+		{
+			case "tag"_atom:
 			radio_button.Tag(property[0].Get<ScriptType::Integer>()->As<int>());
+			break;
+		}
 	}
 }
 
@@ -971,16 +1327,23 @@ void set_scrollable_properties(const script_tree::ObjectNode &object, controls::
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "attach")
+		switch (property.NameAtom())
 		{
-			if (auto owner = scrollable.Owner(); owner)
-				scrollable.AttachedScrollBar(owner->GetControlAs<controls::GuiScrollBar>(property[0].Get<ScriptType::String>()->Get()));
-		}
-		else if (property.Name() == "scroll")
+			case "attach"_atom:
+			{
+				if (auto owner = scrollable.Owner(); owner)
+					scrollable.AttachedScrollBar(owner->GetControlAs<controls::GuiScrollBar>(property[0].Get<ScriptType::String>()->Get()));
+				break;
+			}
+
+			case "scroll"_atom:
 			scrollable.Scroll(property[0].Get<ScriptType::Integer>()->As<int>());
-		
-		else if (property.Name() == "scroll-rate")
+			break;
+
+			case "scroll-rate"_atom:
 			scrollable.ScrollRate(property[0].Get<ScriptType::Integer>()->As<int>());
+			break;
+		}
 	}
 }
 
@@ -991,14 +1354,20 @@ void set_scroll_bar_properties(const script_tree::ObjectNode &object, controls::
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "attach")
+		switch (property.NameAtom())
 		{
-			if (auto owner = scroll_bar.Owner(); owner)
-				scroll_bar.AttachedScrollable(owner->GetControlAs<controls::GuiScrollable>(property[0].Get<ScriptType::String>()->Get()));
-		}
-		else if (property.Name() == "handle-size")
+			case "attach"_atom:
+			{
+				if (auto owner = scroll_bar.Owner(); owner)
+					scroll_bar.AttachedScrollable(owner->GetControlAs<controls::GuiScrollable>(property[0].Get<ScriptType::String>()->Get()));
+				break;
+			}
+
+			case "handle-size"_atom:
 			scroll_bar.HandleSize(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
 								  property[1].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -1009,28 +1378,52 @@ void set_slider_properties(const script_tree::ObjectNode &object, controls::GuiS
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "flipped")
+		switch (property.NameAtom())
+		{
+			case "flipped"_atom:
 			slider.Flipped(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "percent")
+			break;
+
+			case "percent"_atom:
 			slider.Percent(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "range")
+			break;
+
+			case "range"_atom:
 			slider.Range(property[0].Get<ScriptType::Integer>()->As<int>(),
 						 property[1].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "large-step")
+			break;
+
+			case "large-step"_atom:
 			slider.LargeStep(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "small-step")
+			break;
+
+			case "small-step"_atom:
 			slider.SmallStep(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "step")
+			break;
+
+			case "step"_atom:
 			slider.Step(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "type")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "horizontal")
-				slider.Type(controls::gui_slider::SliderType::Horizontal);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "vertical")
-				slider.Type(controls::gui_slider::SliderType::Vertical);
-		}
-		else if (property.Name() == "value")
+			break;
+
+			case "type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "horizontal"_atom:
+					slider.Type(controls::gui_slider::SliderType::Horizontal);
+					break;
+
+					case "vertical"_atom:
+					slider.Type(controls::gui_slider::SliderType::Vertical);
+					break;
+				}
+				break;
+			}
+
+			case "value"_atom:
 			slider.Value(property[0].Get<ScriptType::Integer>()->As<int>());
+			break;
+		}
 	}
 }
 
@@ -1041,60 +1434,116 @@ void set_text_box_properties(const script_tree::ObjectNode &object, controls::Gu
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "character-set")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "ascii")
-				text_box.CharacterSet(controls::gui_text_box::TextBoxCharacterSet::ASCII);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "extended-ascii")
-				text_box.CharacterSet(controls::gui_text_box::TextBoxCharacterSet::ExtendedASCII);
-		}
-		else if (property.Name() == "content")
+			case "character-set"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "ascii"_atom:
+					text_box.CharacterSet(controls::gui_text_box::TextBoxCharacterSet::ASCII);
+					break;
+
+					case "extended-ascii"_atom:
+					text_box.CharacterSet(controls::gui_text_box::TextBoxCharacterSet::ExtendedASCII);
+					break;
+				}
+				break;
+			}
+
+			case "content"_atom:
 			text_box.Content(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "cursor-blink-rate")
+			break;
+
+			case "cursor-blink-rate"_atom:
 			text_box.CursorBlinkRate(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "cursor-hold-percent")
+			break;
+
+			case "cursor-hold-percent"_atom:
 			text_box.CursorHoldPercent(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "cursor-position")
+			break;
+
+			case "cursor-position"_atom:
 			text_box.CursorPosition(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "key-repeat-delay")
+			break;
+
+			case "key-repeat-delay"_atom:
 			text_box.KeyRepeatDelay(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "key-repeat-rate")
+			break;
+
+			case "key-repeat-rate"_atom:
 			text_box.KeyRepeatRate(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "mask")
-		{
-			if (auto mask = property[0].Get<ScriptType::String>()->Get(); !std::empty(mask))
-				text_box.Mask(mask.front());
-		}
-		else if (property.Name() == "max-characters")
+			break;
+
+			case "mask"_atom:
+			{
+				if (auto mask = property[0].Get<ScriptType::String>()->Get(); !std::empty(mask))
+					text_box.Mask(mask.front());
+				break;
+			}
+
+			case "max-characters"_atom:
 			text_box.MaxCharacters(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "placeholder-content")
+			break;
+
+			case "placeholder-content"_atom:
 			text_box.PlaceholderContent(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "read-only")
+			break;
+
+			case "read-only"_atom:
 			text_box.ReadOnly(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "reveal-count")
+			break;
+
+			case "reveal-count"_atom:
 			text_box.RevealCount(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "text-layout")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "left")
-				text_box.TextLayout(controls::gui_text_box::TextBoxTextLayout::Left);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "center")
-				text_box.TextLayout(controls::gui_text_box::TextBoxTextLayout::Center);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "right")
-				text_box.TextLayout(controls::gui_text_box::TextBoxTextLayout::Right);
-		}
-		else if (property.Name() == "text-mode")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "printable")
-				text_box.TextMode(controls::gui_text_box::TextBoxTextMode::Printable);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "alpha-numeric")
-				text_box.TextMode(controls::gui_text_box::TextBoxTextMode::AlphaNumeric);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "alpha")
-				text_box.TextMode(controls::gui_text_box::TextBoxTextMode::Alpha);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "numeric")
-				text_box.TextMode(controls::gui_text_box::TextBoxTextMode::Numeric);
-		}
-		else if (property.Name() == "text-padding")
+			break;
+
+			case "text-layout"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "left"_atom:
+					text_box.TextLayout(controls::gui_text_box::TextBoxTextLayout::Left);
+					break;
+
+					case "center"_atom:
+					text_box.TextLayout(controls::gui_text_box::TextBoxTextLayout::Center);
+					break;
+
+					case "right"_atom:
+					text_box.TextLayout(controls::gui_text_box::TextBoxTextLayout::Right);
+					break;
+				}
+				break;
+			}
+
+			case "text-mode"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "printable"_atom:
+					text_box.TextMode(controls::gui_text_box::TextBoxTextMode::Printable);
+					break;
+
+					case "alpha-numeric"_atom:
+					text_box.TextMode(controls::gui_text_box::TextBoxTextMode::AlphaNumeric);
+					break;
+
+					case "alpha"_atom:
+					text_box.TextMode(controls::gui_text_box::TextBoxTextMode::Alpha);
+					break;
+
+					case "numeric"_atom:
+					text_box.TextMode(controls::gui_text_box::TextBoxTextMode::Numeric);
+					break;
+				}
+				break;
+			}
+
+			case "text-padding"_atom:
 			text_box.TextPadding(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
@@ -1105,22 +1554,40 @@ void set_tooltip_properties(const script_tree::ObjectNode &object, controls::Gui
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "auto-size")
+		switch (property.NameAtom())
+		{
+			case "auto-size"_atom:
 			tooltip.AutoSize(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "fade-in-delay")
+			break;
+
+			case "fade-in-delay"_atom:
 			tooltip.FadeInDelay(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "fade-in-time")
+			break;
+
+			case "fade-in-time"_atom:
 			tooltip.FadeInTime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "fade-out-delay")
+			break;
+
+			case "fade-out-delay"_atom:
 			tooltip.FadeOutDelay(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "fade-out-time")
+			break;
+
+			case "fade-out-time"_atom:
 			tooltip.FadeOutTime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "follow-mouse-cursor")
+			break;
+
+			case "follow-mouse-cursor"_atom:
 			tooltip.FollowMouseCursor(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "hold-time")
+			break;
+
+			case "hold-time"_atom:
 			tooltip.HoldTime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "show")
+			break;
+
+			case "show"_atom:
 			tooltip.Show(property[0].Get<ScriptType::String>()->Get());
+			break;
+		}
 	}
 }
 
@@ -1187,10 +1654,14 @@ NonOwningPtr<controls::GuiButton> create_gui_button(const script_tree::ObjectNod
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto button =
@@ -1240,10 +1711,14 @@ NonOwningPtr<controls::GuiCheckBox> create_gui_check_box(const script_tree::Obje
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto check_box =
@@ -1287,10 +1762,14 @@ NonOwningPtr<controls::GuiGroupBox> create_gui_group_box(const script_tree::Obje
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto group_box =
@@ -1334,10 +1813,14 @@ NonOwningPtr<controls::GuiImage> create_gui_image(const script_tree::ObjectNode
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto image =
@@ -1381,10 +1864,14 @@ NonOwningPtr<controls::GuiLabel> create_gui_label(const script_tree::ObjectNode
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto label =
@@ -1428,10 +1915,14 @@ NonOwningPtr<controls::GuiListBox> create_gui_list_box(const script_tree::Object
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto list_box =
@@ -1566,10 +2057,14 @@ NonOwningPtr<controls::GuiRadioButton> create_gui_radio_button(const script_tree
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto radio_button =
@@ -1619,10 +2114,14 @@ NonOwningPtr<controls::GuiScrollBar> create_gui_scroll_bar(const script_tree::Ob
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	if (type_name == "horizontal")
@@ -1681,10 +2180,14 @@ NonOwningPtr<controls::GuiSlider> create_gui_slider(const script_tree::ObjectNod
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	if (type_name == "vertical")
@@ -1731,10 +2234,14 @@ NonOwningPtr<controls::GuiTextBox> create_gui_text_box(const script_tree::Object
 	auto hit_boxes = controls::gui_control::BoundingBoxes{};
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "hit-box")
+		switch (property.NameAtom())
+		{
+			case "hit-box"_atom:
 			hit_boxes.push_back({
 				property[0].Get<ScriptType::Vector2>()->Get(),
 				property[1].Get<ScriptType::Vector2>()->Get()});
+			break;
+		}
 	}
 
 	auto text_box =
@@ -1795,9 +2302,10 @@ NonOwningPtr<controls::GuiTooltip> create_gui_tooltip(const script_tree::ObjectN
 void create_gui(const ScriptTree &tree, GuiController &gui_controller,
 	graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers)
 {
+	//A gui object sets up the given gui controller in place, so there is nothing to decode in parallel
 	for (auto &object : tree.Objects())
 	{
-		if (object.Name() == "gui")
+		if (object.NameAtom() == "gui"_atom)
 			set_gui_properties(object, gui_controller, scene_manager, managers);
 	}
 }
@@ -1809,7 +2317,8 @@ void create_gui(const ScriptTree &tree, GuiController &gui_controller,
 
 ScriptValidator GuiScriptInterface::GetValidator() const
 {
-	return detail::get_gui_validator();
+	static const auto validator = detail::get_gui_validator().Compile();
+	return validator;
 }
 
 
@@ -37,6 +37,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace gui_theme_script_interface;
 using namespace gui;
@@ -189,43 +190,87 @@ graphics::fonts::text::TextBlockStyle create_text_style(const script_tree::Objec
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "background-color")
-			style.BackgroundColor = property[0].Get<ScriptType::Color>()->Get();
-		else if (property.Name() == "decoration")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "underline")
-				style.Decoration = graphics::fonts::text::TextDecoration::Underline;
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "line-through")
-				style.Decoration = graphics::fonts::text::TextDecoration::LineThrough;
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "overline")
-				style.Decoration = graphics::fonts::text::TextDecoration::Overline;
-		}
-		else if (property.Name() == "decoration-color")
+			case "background-color"_atom:
+			style.BackgroundColor = property[0].Get<ScriptType::Color>()->Get();
+			break;
+
+			case "decoration"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "underline"_atom:
+					style.Decoration = graphics::fonts::text::TextDecoration::Underline;
+					break;
+
+					case "line-through"_atom:
+					style.Decoration = graphics::fonts::text::TextDecoration::LineThrough;
+					break;
+
+					case "overline"_atom:
+					style.Decoration = graphics::fonts::text::TextDecoration::Overline;
+					break;
+				}
+				break;
+			}
+
+			case "decoration-color"_atom:
 			style.DecorationColor = property[0].Get<ScriptType::Color>()->Get();
-		else if (property.Name() == "foreground-color")
+			break;
+
+			case "foreground-color"_atom:
 			style.ForegroundColor = property[0].Get<ScriptType::Color>()->Get();
-		else if (property.Name() == "font-size")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "smaller")
-				style.FontSize = graphics::fonts::text::TextBlockFontSize::Smaller;
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "larger")
-				style.FontSize = graphics::fonts::text::TextBlockFontSize::Larger;
-		}
-		else if (property.Name() == "font-style")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "bold")
-				style.FontStyle = graphics::fonts::text::TextFontStyle::Bold;
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "italic")
-				style.FontStyle = graphics::fonts::text::TextFontStyle::Italic;
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "bold-italic")
-				style.FontStyle = graphics::fonts::text::TextFontStyle::BoldItalic;
-		}
-		else if (property.Name() == "vertical-align")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "subscript")
-				style.VerticalAlign = graphics::fonts::text::TextBlockVerticalAlign::Subscript;
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "superscript")
-				style.VerticalAlign = graphics::fonts::text::TextBlockVerticalAlign::Superscript;
+			break;
+
+			case "font-size"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "smaller"_atom:
+					style.FontSize = graphics::fonts::text::TextBlockFontSize::Smaller;
+					break;
+
+					case "larger"_atom:
+					style.FontSize = graphics::fonts::text::TextBlockFontSize::Larger;
+					break;
+				}
+				break;
+			}
+
+			case "font-style"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "bold"_atom:
+					style.FontStyle = graphics::fonts::text::TextFontStyle::Bold;
+					break;
+
+					case "italic"_atom:
+					style.FontStyle = graphics::fonts::text::TextFontStyle::Italic;
+					break;
+
+					case "bold-italic"_atom:
+					style.FontStyle = graphics::fonts::text::TextFontStyle::BoldItalic;
+					break;
+				}
+				break;
+			}
+
+			case "vertical-align"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "subscript"_atom:
+					style.VerticalAlign = graphics::fonts::text::TextBlockVerticalAlign::Subscript;
+					break;
+
+					case "superscript"_atom:
+					style.VerticalAlign = graphics::fonts::text::TextBlockVerticalAlign::Superscript;
+					break;
+				}
+				break;
+			}
 		}
 	}
 
@@ -245,23 +290,45 @@ void set_gui_skin_properties(const script_tree::ObjectNode &object, GuiSkin &ski
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "border-alignment")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "outside")
-				skin.BorderAlignment(gui_skin::SkinPartsAlignment::Outside);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "center")
-				skin.BorderAlignment(gui_skin::SkinPartsAlignment::Center);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "inside")
-				skin.BorderAlignment(gui_skin::SkinPartsAlignment::Inside);
-		}
-		else if (property.Name() == "corner-alignment")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "outside")
-				skin.CornerAlignment(gui_skin::SkinPartsAlignment::Outside);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "center")
-				skin.CornerAlignment(gui_skin::SkinPartsAlignment::Center);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "inside")
-				skin.CornerAlignment(gui_skin::SkinPartsAlignment::Inside);
+			case "border-alignment"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "outside"_atom:
+					skin.BorderAlignment(gui_skin::SkinPartsAlignment::Outside);
+					break;
+
+					case "center"_atom:
+					skin.BorderAlignment(gui_skin::SkinPartsAlignment::Center);
+					break;
+
+					case "inside"_atom:
+					skin.BorderAlignment(gui_skin::SkinPartsAlignment::Inside);
+					break;
+				}
+				break;
+			}
+
+			case "corner-alignment"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "outside"_atom:
+					skin.CornerAlignment(gui_skin::SkinPartsAlignment::Outside);
+					break;
+
+					case "center"_atom:
+					skin.CornerAlignment(gui_skin::SkinPartsAlignment::Center);
+					break;
+
+					case "inside"_atom:
+					skin.CornerAlignment(gui_skin::SkinPartsAlignment::Inside);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -347,92 +414,144 @@ NonOwningPtr<GuiSkin> create_gui_skin(const script_tree::ObjectNode &object,
 	{
 		for (auto &obj : object.Objects())
 		{
-			if (obj.Name() == "part")
+			switch (obj.NameAtom())
 			{
-				auto part_name = obj
-					.Property("name")[0]
-					.Get<ScriptType::String>()->Get();
-
-				skins::gui_skin::SkinPart part;
-
-				for (auto &property : obj.Properties())
+				case "part"_atom:
 				{
-					if (property.Name() == "auto-repeat")
-						part.AutoRepeat = property[0].Get<ScriptType::Boolean>()->Get();
-					else if (property.Name() == "disabled")
-						part.Disabled = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
-					else if (property.Name() == "enabled")
-						part.Enabled = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
-					else if (property.Name() == "fill-color")
-						part.FillColor = property[0].Get<ScriptType::Color>()->Get();
-					else if (property.Name() == "flip-horizontal")
-						part.FlipHorizontal = property[0].Get<ScriptType::Boolean>()->Get();
-					else if (property.Name() == "flip-vertical")
-						part.FlipVertical = property[0].Get<ScriptType::Boolean>()->Get();
-					else if (property.Name() == "focused")
-						part.Focused = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
-					else if (property.Name() == "hovered")
-						part.Hovered = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
-					else if (property.Name() == "include-bounding-volumes")
-						part.IncludeBoundingVolumes = property[0].Get<ScriptType::Boolean>()->Get();
-					else if (property.Name() == "position")
-						part.Position = property[0].Get<ScriptType::Vector3>()->Get();
-					else if (property.Name() == "pressed")
-						part.Pressed = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
-					else if (property.Name() == "rotation")
-						part.Rotation = utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-					else if (property.Name() == "scaling")
-						part.Scaling = property[0].Get<ScriptType::Vector2>()->Get();
+					auto part_name = obj
+						.Property("name")[0]
+						.Get<ScriptType::String>()->Get();
+
+					skins::gui_skin::SkinPart part;
+
+					for (auto &property : obj.Properties())
+					{
+						switch (property.NameAtom())
+						{
+							case "auto-repeat"_atom:
+							part.AutoRepeat = property[0].Get<ScriptType::Boolean>()->Get();
+							break;
+
+							case "disabled"_atom:
+							part.Disabled = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
+							break;
+
+							case "enabled"_atom:
+							part.Enabled = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
+							break;
+
+							case "fill-color"_atom:
+							part.FillColor = property[0].Get<ScriptType::Color>()->Get();
+							break;
+
+							case "flip-horizontal"_atom:
+							part.FlipHorizontal = property[0].Get<ScriptType::Boolean>()->Get();
+							break;
+
+							case "flip-vertical"_atom:
+							part.FlipVertical = property[0].Get<ScriptType::Boolean>()->Get();
+							break;
+
+							case "focused"_atom:
+							part.Focused = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
+							break;
+
+							case "hovered"_atom:
+							part.Hovered = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
+							break;
+
+							case "include-bounding-volumes"_atom:
+							part.IncludeBoundingVolumes = property[0].Get<ScriptType::Boolean>()->Get();
+							break;
+
+							case "position"_atom:
+							part.Position = property[0].Get<ScriptType::Vector3>()->Get();
+							break;
+
+							case "pressed"_atom:
+							part.Pressed = get_material(property[0].Get<ScriptType::String>()->Get(), managers);
+							break;
+
+							case "rotation"_atom:
+							part.Rotation = utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+							break;
+
+							case "scaling"_atom:
+							part.Scaling = property[0].Get<ScriptType::Vector2>()->Get();
+							break;
+						}
+					}
+
+					skin->AddPart(std::move(part_name), part);
+					break;
 				}
 
-				skin->AddPart(std::move(part_name), part);
-			}
-			else if (obj.Name() == "part-render-pass")
+				case "part-render-pass"_atom:
 				skin->AddPartRenderPass(create_render_pass(obj, managers));
-			else if (obj.Name() == "sound-part")
-			{
-				auto part_name = obj
-					.Property("name")[0]
-					.Get<ScriptType::String>()->Get();
-				auto sound_name = obj
-					.Property("sound")[0]
-					.Get<ScriptType::String>()->Get();
-
-				skins::gui_skin::SkinSoundPart sound_part;
-				sound_part.Base = get_sound(sound_name, managers);
+				break;
 
-				skin->AddSoundPart(std::move(part_name), sound_part);
-			}
-			else if (obj.Name() == "text-part")
-			{
-				auto part_name = obj
-					.Property("name")[0]
-					.Get<ScriptType::String>()->Get();
-				auto text_name = obj
-					.Property("text")[0]
-					.Get<ScriptType::String>()->Get();
-
-				skins::gui_skin::SkinTextPart text_part;
-				text_part.Base = get_text(text_name, managers);
+				case "sound-part"_atom:
+				{
+					auto part_name = obj
+						.Property("name")[0]
+						.Get<ScriptType::String>()->Get();
+					auto sound_name = obj
+						.Property("sound")[0]
+						.Get<ScriptType::String>()->Get();
+
+					skins::gui_skin::SkinSoundPart sound_part;
+					sound_part.Base = get_sound(sound_name, managers);
+
+					skin->AddSoundPart(std::move(part_name), sound_part);
+					break;
+				}
 
-				for (auto &obj2 : obj.Objects())
+				case "text-part"_atom:
 				{
-					if (obj2.Name() == "disabled")
-						text_part.Disabled = create_text_style(obj2);
-					else if (obj2.Name() == "enabled")
-						text_part.Enabled = create_text_style(obj2);
-					else if (obj2.Name() == "focused")
-						text_part.Focused = create_text_style(obj2);
-					else if (obj2.Name() == "hovered")
-						text_part.Hovered = create_text_style(obj2);
-					else if (obj2.Name() == "pressed")
-						text_part.Pressed = create_text_style(obj2);
+					auto part_name = obj
+						.Property("name")[0]
+						.Get<ScriptType::String>()->Get();
+					auto text_name = obj
+						.Property("text")[0]
+						.Get<ScriptType::String>()->Get();
+
+					skins::gui_skin::SkinTextPart text_part;
+					text_part.Base = get_text(text_name, managers);
+
+					for (auto &obj2 : obj.Objects())
+					{
+						switch (obj2.NameAtom())
+						{
+							case "disabled"_atom:
+							text_part.Disabled = create_text_style(obj2);
+							break;
+
+							case "enabled"_atom:
+							text_part.Enabled = create_text_style(obj2);
+							break;
+
+							case "focused"_atom:
+							text_part.Focused = create_text_style(obj2);
+							break;
+
+							case "hovered"_atom:
+							text_part.Hovered = create_text_style(obj2);
+							break;
+
+							case "pressed"_atom:
+							text_part.Pressed = create_text_style(obj2);
+							break;
+						}
+					}
+
+					skin->AddTextPart(std::move(part_name), text_part);
+					break;
 				}
 
-				skin->AddTextPart(std::move(part_name), text_part);
-			}
-			else if (obj.Name() == "text-render-pass")
+				case "text-render-pass"_atom:
 				skin->AddTextRenderPass(create_render_pass(obj, managers));
+				break;
+			}
 		}
 
 		set_gui_skin_properties(object, *skin);
@@ -479,7 +598,8 @@ void create_gui_themes(const ScriptTree &tree, GuiController &gui_controller,
 
 ScriptValidator GuiThemeScriptInterface::GetValidator() const
 {
-	return detail::get_gui_theme_validator();
+	static const auto validator = detail::get_gui_theme_validator().Compile();
+	return validator;
 }
 
 
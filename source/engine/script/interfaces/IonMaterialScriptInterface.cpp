@@ -21,6 +21,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace material_script_interface;
 using namespace graphics::materials;
@@ -100,93 +101,136 @@ void set_material_properties(const script_tree::ObjectNode &object, Material &ma
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "ambient-color")
+		switch (property.NameAtom())
+		{
+			case "ambient-color"_atom:
 			material.AmbientColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "crop")
+			break;
+
+			case "crop"_atom:
 			material.Crop(graphics::utilities::Aabb{property[0].Get<ScriptType::Vector2>()->Get(), property[1].Get<ScriptType::Vector2>()->Get()});
-		else if (property.Name() == "diffuse-color")
+			break;
+
+			case "diffuse-color"_atom:
 			material.DiffuseColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "diffuse-map")
-		{
-			if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
-				material.DiffuseMap(texture);
-			else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
-				material.DiffuseMap(animation);
-		}
-		else if (property.Name() == "emissive-color")
+			break;
+
+			case "diffuse-map"_atom:
+			{
+				if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
+					material.DiffuseMap(texture);
+				else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
+					material.DiffuseMap(animation);
+				break;
+			}
+
+			case "emissive-color"_atom:
 			material.EmissiveColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "emissive-light-radius")
+			break;
+
+			case "emissive-light-radius"_atom:
 			material.EmissiveLightRadius(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "emissive-map")
-		{
-			if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
-				material.EmissiveMap(texture);
-			else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
-				material.EmissiveMap(animation);
-		}
-		else if (property.Name() == "flip-horizontal")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				material.FlipHorizontal();
-		}
-		else if (property.Name() == "flip-vertical")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				material.FlipVertical();
-		}
-		else if (property.Name() == "lighting-enabled")
+			break;
+
+			case "emissive-map"_atom:
+			{
+				if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
+					material.EmissiveMap(texture);
+				else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
+					material.EmissiveMap(animation);
+				break;
+			}
+
+			case "flip-horizontal"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					material.FlipHorizontal();
+				break;
+			}
+
+			case "flip-vertical"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					material.FlipVertical();
+				break;
+			}
+
+			case "lighting-enabled"_atom:
 			material.LightingEnabled(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "normal-map")
-		{
-			if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
-				material.NormalMap(texture);
-			else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
-				material.NormalMap(animation);
-		}
-		else if (property.Name() == "receive-shadows")
+			break;
+
+			case "normal-map"_atom:
+			{
+				if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
+					material.NormalMap(texture);
+				else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
+					material.NormalMap(animation);
+				break;
+			}
+
+			case "receive-shadows"_atom:
 			material.ReceiveShadows(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "repeat")
+			break;
+
+			case "repeat"_atom:
 			material.Repeat(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "shininess")
+			break;
+
+			case "shininess"_atom:
 			material.Shininess(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "specular-color")
+			break;
+
+			case "specular-color"_atom:
 			material.SpecularColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "specular-map")
-		{
-			if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
-				material.SpecularMap(texture);
-			else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
-				material.SpecularMap(animation);
-		}
-		else if (property.Name() == "tex-coords")
+			break;
+
+			case "specular-map"_atom:
+			{
+				if (auto texture = get_texture(property[0].Get<ScriptType::String>()->Get(), managers); texture)
+					material.SpecularMap(texture);
+				else if (auto animation = get_animation(property[0].Get<ScriptType::String>()->Get(), managers); animation)
+					material.SpecularMap(animation);
+				break;
+			}
+
+			case "tex-coords"_atom:
 			material.TexCoords(property[0].Get<ScriptType::Vector2>()->Get(), property[1].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
 
-NonOwningPtr<Material> create_material(const script_tree::ObjectNode &object,
-	MaterialManager &material_manager, const ManagerRegister &managers)
+Material decode_material(const script_tree::ObjectNode &object,
+	const ManagerRegister &managers)
 {
 	auto name = object
 		.Property("name")[0]
 		.Get<ScriptType::String>()->Get();
 
-	auto material = material_manager.CreateMaterial(std::move(name));
-
-	if (material)
-		set_material_properties(object, *material, managers);
-
+	Material material{std::move(name)};
+	set_material_properties(object, material, managers);
 	return material;
 }
 
+NonOwningPtr<Material> create_material(const script_tree::ObjectNode &object,
+	MaterialManager &material_manager, const ManagerRegister &managers)
+{
+	return material_manager.CreateMaterial(decode_material(object, managers));
+}
+
 void create_materials(const ScriptTree &tree,
 	MaterialManager &material_manager, const ManagerRegister &managers)
 {
-	for (auto &object : tree.Objects())
-	{
-		if (object.Name() == "material")
-			create_material(object, material_manager, managers);
-	}
+	script_interface::detail::create_objects(tree, "material",
+		[&](const script_tree::ObjectNode &object)
+		{
+			return decode_material(object, managers);
+		},
+		[&](Material &&material)
+		{
+			material_manager.CreateMaterial(std::move(material));
+		});
 }
 
 } //material_script_interface::detail
@@ -196,7 +240,8 @@ void create_materials(const ScriptTree &tree,
 
 ScriptValidator MaterialScriptInterface::GetValidator() const
 {
-	return detail::get_material_validator();
+	static const auto validator = detail::get_material_validator().Compile();
+	return validator;
 }
 
 
@@ -49,6 +49,9 @@ namespace ion::script::interfaces
 			const ManagerRegister &managers);
 
 
+		graphics::materials::Material decode_material(const script_tree::ObjectNode &object,
+			const ManagerRegister &managers);
+
 		NonOwningPtr<graphics::materials::Material> create_material(const script_tree::ObjectNode &object,
 			graphics::materials::MaterialManager &material_manager, const ManagerRegister &managers);
 
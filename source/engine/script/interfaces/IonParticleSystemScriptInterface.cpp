@@ -20,6 +20,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace particle_system_script_interface;
 using namespace graphics::particles;
@@ -175,97 +176,155 @@ void set_emitter_properties(const script_tree::ObjectNode &object, Emitter &emit
 {
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "color-fader")
+		switch (obj.NameAtom())
+		{
+			case "color-fader"_atom:
 			create_color_fader(obj, emitter);
-		else if (obj.Name() == "direction-randomizer")
+			break;
+
+			case "direction-randomizer"_atom:
 			create_direction_randomizer(obj, emitter);
-		else if (obj.Name() == "graviation")
+			break;
+
+			case "graviation"_atom:
 			create_graviation(obj, emitter);
-		else if (obj.Name() == "linear-force")
+			break;
+
+			case "linear-force"_atom:
 			create_linear_force(obj, emitter);
-		else if (obj.Name() == "scaler")
+			break;
+
+			case "scaler"_atom:
 			create_scaler(obj, emitter);
-		else if (obj.Name() == "sine-force")
+			break;
+
+			case "sine-force"_atom:
 			create_sine_force(obj, emitter);
-		else if (obj.Name() == "velocity-randomizer")
+			break;
+
+			case "velocity-randomizer"_atom:
 			create_velocity_randomizer(obj, emitter);
+			break;
+		}
 	}
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "direction")
+		switch (property.NameAtom())
+		{
+			case "direction"_atom:
 			emitter.Direction(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "emission-angle")
+			break;
+
+			case "emission-angle"_atom:
 			emitter.EmissionAngle(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "emission-duration")
+			break;
+
+			case "emission-duration"_atom:
 			emitter.EmissionDuration(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "emission-rate")
+			break;
+
+			case "emission-rate"_atom:
 			emitter.EmissionRate(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "emitting")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				emitter.Start();
-			else
-				emitter.Stop();
-		}
-		else if (property.Name() == "inner-size")
+			break;
+
+			case "emitting"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					emitter.Start();
+				else
+					emitter.Stop();
+				break;
+			}
+
+			case "inner-size"_atom:
 			emitter.InnerSize(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "particle-color")
-		{
-			if (property.NumberOfArguments() == 2)
-				emitter.ParticleColor(property[0].Get<ScriptType::Color>()->Get(),
-									  property[1].Get<ScriptType::Color>()->Get());
-			else
-				emitter.ParticleColor(property[0].Get<ScriptType::Color>()->Get());
-		}
-		else if (property.Name() == "particle-lifetime")
-		{
-			if (property.NumberOfArguments() == 2)
-				emitter.ParticleLifetime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()},
-										 duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()});
-			else
-				emitter.ParticleLifetime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		}
-		else if (property.Name() == "particle-mass")
-		{
-			if (property.NumberOfArguments() == 2)
-				emitter.ParticleMass(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
-									 property[1].Get<ScriptType::FloatingPoint>()->As<real>());
-			else
-				emitter.ParticleMass(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		}
-		else if (property.Name() == "particle-material")
-			emitter.ParticleMaterial(get_material(property[0].Get<ScriptType::String>()->Get(), managers));
-		else if (property.Name() == "particle-size")
-		{
-			if (property.NumberOfArguments() == 2)
-				emitter.ParticleSize(property[0].Get<ScriptType::Vector2>()->Get(),
-									 property[1].Get<ScriptType::Vector2>()->Get());
-			else
-				emitter.ParticleSize(property[0].Get<ScriptType::Vector2>()->Get());
-		}
-		else if (property.Name() == "particle-velocity")
-		{
-			if (property.NumberOfArguments() == 2)
-				emitter.ParticleVelocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
+			break;
+
+			case "particle-color"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					emitter.ParticleColor(property[0].Get<ScriptType::Color>()->Get(),
+										  property[1].Get<ScriptType::Color>()->Get());
+				else
+					emitter.ParticleColor(property[0].Get<ScriptType::Color>()->Get());
+				break;
+			}
+
+			case "particle-lifetime"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					emitter.ParticleLifetime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()},
+											 duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()});
+				else
+					emitter.ParticleLifetime(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
+				break;
+			}
+
+			case "particle-mass"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					emitter.ParticleMass(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
 										 property[1].Get<ScriptType::FloatingPoint>()->As<real>());
-			else
-				emitter.ParticleVelocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		}
-		else if (property.Name() == "particle-quota")
+				else
+					emitter.ParticleMass(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+				break;
+			}
+
+			case "particle-material"_atom:
+			emitter.ParticleMaterial(get_material(property[0].Get<ScriptType::String>()->Get(), managers));
+			break;
+
+			case "particle-size"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					emitter.ParticleSize(property[0].Get<ScriptType::Vector2>()->Get(),
+										 property[1].Get<ScriptType::Vector2>()->Get());
+				else
+					emitter.ParticleSize(property[0].Get<ScriptType::Vector2>()->Get());
+				break;
+			}
+
+			case "particle-velocity"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					emitter.ParticleVelocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
+											 property[1].Get<ScriptType::FloatingPoint>()->As<real>());
+				else
+					emitter.ParticleVelocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+				break;
+			}
+
+			case "particle-quota"_atom:
 			emitter.ParticleQuota(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			emitter.Position(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "size")
+			break;
+
+			case "size"_atom:
 			emitter.Size(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "type")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "point")
-				emitter.Type(emitter::EmitterType::Point);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "box")
-				emitter.Type(emitter::EmitterType::Box);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "ring")
-				emitter.Type(emitter::EmitterType::Ring);
+			break;
+
+			case "type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "point"_atom:
+					emitter.Type(emitter::EmitterType::Point);
+					break;
+
+					case "box"_atom:
+					emitter.Type(emitter::EmitterType::Box);
+					break;
+
+					case "ring"_atom:
+					emitter.Type(emitter::EmitterType::Ring);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -275,40 +334,69 @@ void set_particle_system_properties(const script_tree::ObjectNode &object, Parti
 {
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "emitter")
+		switch (obj.NameAtom())
+		{
+			case "emitter"_atom:
 			create_emitter(obj, particle_system, managers);
+			break;
 
-		else if (obj.Name() == "color-fader")
+			case "color-fader"_atom:
 			create_color_fader(obj, particle_system);
-		else if (obj.Name() == "direction-randomizer")
+			break;
+
+			case "direction-randomizer"_atom:
 			create_direction_randomizer(obj, particle_system);
-		else if (obj.Name() == "graviation")
+			break;
+
+			case "graviation"_atom:
 			create_graviation(obj, particle_system);
-		else if (obj.Name() == "linear-force")
+			break;
+
+			case "linear-force"_atom:
 			create_linear_force(obj, particle_system);
-		else if (obj.Name() == "scaler")
+			break;
+
+			case "scaler"_atom:
 			create_scaler(obj, particle_system);
-		else if (obj.Name() == "sine-force")
+			break;
+
+			case "sine-force"_atom:
 			create_sine_force(obj, particle_system);
-		else if (obj.Name() == "velocity-randomizer")
+			break;
+
+			case "velocity-randomizer"_atom:
 			create_velocity_randomizer(obj, particle_system);
+			break;
+		}
 	}
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "emitting")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				particle_system.StartAll();
-			else
-				particle_system.StopAll();
-		}
-		else if (property.Name() == "render-primitive")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "point")
-				particle_system.RenderPrimitive(particle_system::ParticlePrimitive::Point);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "rectangle")
-				particle_system.RenderPrimitive(particle_system::ParticlePrimitive::Rectangle);
+			case "emitting"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					particle_system.StartAll();
+				else
+					particle_system.StopAll();
+				break;
+			}
+
+			case "render-primitive"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "point"_atom:
+					particle_system.RenderPrimitive(particle_system::ParticlePrimitive::Point);
+					break;
+
+					case "rectangle"_atom:
+					particle_system.RenderPrimitive(particle_system::ParticlePrimitive::Rectangle);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -353,10 +441,16 @@ void set_direction_randomizer_properties(const script_tree::ObjectNode &object,
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "angle")
+		switch (property.NameAtom())
+		{
+			case "angle"_atom:
 			direction_randomizer.Angle(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "scope")
+			break;
+
+			case "scope"_atom:
 			direction_randomizer.Scope(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -366,12 +460,20 @@ void set_gravitation_properties(const script_tree::ObjectNode &object, affectors
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "gravity")
+		switch (property.NameAtom())
+		{
+			case "gravity"_atom:
 			gravitation.Gravity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "mass")
+			break;
+
+			case "mass"_atom:
 			gravitation.Mass(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			gravitation.Position(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
@@ -381,14 +483,26 @@ void set_linear_force_properties(const script_tree::ObjectNode &object, affector
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "force")
-			linear_force.Force(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "type")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "add")
-				linear_force.Type(affectors::linear_force::ForceType::Add);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "average")
-				linear_force.Type(affectors::linear_force::ForceType::Average);
+			case "force"_atom:
+			linear_force.Force(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+
+			case "type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "add"_atom:
+					linear_force.Type(affectors::linear_force::ForceType::Add);
+					break;
+
+					case "average"_atom:
+					linear_force.Type(affectors::linear_force::ForceType::Average);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -423,14 +537,26 @@ void set_sine_force_properties(const script_tree::ObjectNode &object, affectors:
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "force")
-			sine_force.Force(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "type")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "add")
-				sine_force.Type(affectors::sine_force::ForceType::Add);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "average")
-				sine_force.Type(affectors::sine_force::ForceType::Average);
+			case "force"_atom:
+			sine_force.Force(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+
+			case "type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "add"_atom:
+					sine_force.Type(affectors::sine_force::ForceType::Add);
+					break;
+
+					case "average"_atom:
+					sine_force.Type(affectors::sine_force::ForceType::Average);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -441,21 +567,40 @@ void set_velocity_randomizer_properties(const script_tree::ObjectNode &object, a
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "scope")
-			velocity_randomizer.Scope(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "velocity")
+		switch (property.NameAtom())
 		{
-			if (property.NumberOfArguments() == 2)
-				velocity_randomizer.Velocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
-											 property[1].Get<ScriptType::FloatingPoint>()->As<real>());
-			else
-				velocity_randomizer.Velocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			case "scope"_atom:
+			velocity_randomizer.Scope(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+
+			case "velocity"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					velocity_randomizer.Velocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
+												 property[1].Get<ScriptType::FloatingPoint>()->As<real>());
+				else
+					velocity_randomizer.Velocity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+				break;
+			}
 		}
 	}
 }
 
 
 
+ParticleSystem decode_particle_system(const script_tree::ObjectNode &object,
+	const ManagerRegister &managers)
+{
+	auto name = object
+		.Property("name")[0]
+		.Get<ScriptType::String>()->Get();
+
+	ParticleSystem particle_system{std::move(name)};
+	set_particle_system_properties(object, particle_system, managers);
+	return particle_system;
+}
+
+
 NonOwningPtr<Emitter> create_emitter(const script_tree::ObjectNode &object,
 	ParticleSystem &particle_system, const ManagerRegister &managers)
 {
@@ -474,16 +619,7 @@ NonOwningPtr<Emitter> create_emitter(const script_tree::ObjectNode &object,
 NonOwningPtr<ParticleSystem> create_particle_system(const script_tree::ObjectNode &object,
 	ParticleSystemManager &particle_system_manager, const ManagerRegister &managers)
 {
-	auto name = object
-		.Property("name")[0]
-		.Get<ScriptType::String>()->Get();
-
-	auto particle_system = particle_system_manager.CreateParticleSystem(std::move(name));
-
-	if (particle_system)
-		set_particle_system_properties(object, *particle_system, managers);
-
-	return particle_system;
+	return particle_system_manager.CreateParticleSystem(decode_particle_system(object, managers));
 }
 
 
@@ -596,11 +732,15 @@ NonOwningPtr<affectors::VelocityRandomizer> create_velocity_randomizer(const scr
 void create_particle_systems(const ScriptTree &tree,
 	ParticleSystemManager &particle_system_manager, const ManagerRegister &managers)
 {
-	for (auto &object : tree.Objects())
-	{
-		if (object.Name() == "particle-system")
-			create_particle_system(object, particle_system_manager, managers);
-	}
+	script_interface::detail::create_objects(tree, "particle-system",
+		[&](const script_tree::ObjectNode &object)
+		{
+			return decode_particle_system(object, managers);
+		},
+		[&](ParticleSystem &&particle_system)
+		{
+			particle_system_manager.CreateParticleSystem(std::move(particle_system));
+		});
 }
 
 } //particle_system_script_interface::detail
@@ -610,7 +750,8 @@ void create_particle_systems(const ScriptTree &tree,
 
 ScriptValidator ParticleSystemScriptInterface::GetValidator() const
 {
-	return detail::get_particle_system_validator();
+	static const auto validator = detail::get_particle_system_validator().Compile();
+	return validator;
 }
 
 
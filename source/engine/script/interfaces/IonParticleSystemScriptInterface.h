@@ -81,6 +81,10 @@ namespace ion::script::interfaces
 		void set_velocity_randomizer_properties(const script_tree::ObjectNode &object, graphics::particles::affectors::VelocityRandomizer &velocity_randomizer);
 
 
+		graphics::particles::ParticleSystem decode_particle_system(const script_tree::ObjectNode &object,
+			const ManagerRegister &managers);
+
+
 		NonOwningPtr<graphics::particles::Emitter> create_emitter(const script_tree::ObjectNode &object,
 			graphics::particles::ParticleSystem &particle_system, const ManagerRegister &managers);
 		NonOwningPtr<graphics::particles::ParticleSystem> create_particle_system(const script_tree::ObjectNode &object,
@@ -32,6 +32,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace scene_script_interface;
 using namespace graphics::scene;
@@ -715,43 +716,79 @@ void set_frustum_properties(const script_tree::ObjectNode &object, graphics::ren
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "aspect-format")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "fill")
-				frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::Fill);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "fill-height")
-				frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::FillHeight);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "fill-width")
-				frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::FillWidth);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "letterbox")
-				frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::Letterbox);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "windowbox")
-				frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::Windowbox);
-		}
-		else if (property.Name() == "aspect-ratio")
+		switch (property.NameAtom())
 		{
-			if (property.NumberOfArguments() == 2)
-				frustum.AspectRatio(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
-									property[1].Get<ScriptType::FloatingPoint>()->As<real>());
-			else
-				frustum.AspectRatio(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		}
-		else if (property.Name() == "base-viewport-height")
+			case "aspect-format"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "fill"_atom:
+					frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::Fill);
+					break;
+
+					case "fill-height"_atom:
+					frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::FillHeight);
+					break;
+
+					case "fill-width"_atom:
+					frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::FillWidth);
+					break;
+
+					case "letterbox"_atom:
+					frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::Letterbox);
+					break;
+
+					case "windowbox"_atom:
+					frustum.AspectFormat(graphics::render::frustum::AspectRatioFormat::Windowbox);
+					break;
+				}
+				break;
+			}
+
+			case "aspect-ratio"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					frustum.AspectRatio(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
+										property[1].Get<ScriptType::FloatingPoint>()->As<real>());
+				else
+					frustum.AspectRatio(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+				break;
+			}
+
+			case "base-viewport-height"_atom:
 			frustum.BaseViewportHeight(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "clip-plane")
+			break;
+
+			case "clip-plane"_atom:
 			frustum.ClipPlane(graphics::utilities::Aabb{property[0].Get<ScriptType::Vector2>()->Get(), property[1].Get<ScriptType::Vector2>()->Get()});
-		else if (property.Name() == "far-clip-distance")
+			break;
+
+			case "far-clip-distance"_atom:
 			frustum.FarClipDistance(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "field-of-view")
+			break;
+
+			case "field-of-view"_atom:
 			frustum.FieldOfView(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "near-clip-distance")
+			break;
+
+			case "near-clip-distance"_atom:
 			frustum.NearClipDistance(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "projection")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "orthographic")
-				frustum.Projection(graphics::render::frustum::ProjectionType::Orthographic);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "perspective")
-				frustum.Projection(graphics::render::frustum::ProjectionType::Perspective);
+			break;
+
+			case "projection"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "orthographic"_atom:
+					frustum.Projection(graphics::render::frustum::ProjectionType::Orthographic);
+					break;
+
+					case "perspective"_atom:
+					frustum.Projection(graphics::render::frustum::ProjectionType::Perspective);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -761,25 +798,35 @@ void set_render_pass_properties(const script_tree::ObjectNode &object, graphics:
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "blending-factor")
-		{
-			if (property.NumberOfArguments() == 4)
-				pass.BlendingFactor(get_pass_blend_factor(property[0]), get_pass_blend_factor(property[1]),
-									get_pass_blend_factor(property[2]), get_pass_blend_factor(property[3]));
-			else
-				pass.BlendingFactor(get_pass_blend_factor(property[0]), get_pass_blend_factor(property[1]));
-		}
-		else if (property.Name() == "blending-equation-mode")
+		switch (property.NameAtom())
 		{
-			if (property.NumberOfArguments() == 2)
-				pass.BlendingEquationMode(get_pass_blend_equation_mode(property[0]), get_pass_blend_equation_mode(property[1]));
-			else
-				pass.BlendingEquationMode(get_pass_blend_equation_mode(property[0]));
-		}
-		else if (property.Name() == "iterations")
+			case "blending-factor"_atom:
+			{
+				if (property.NumberOfArguments() == 4)
+					pass.BlendingFactor(get_pass_blend_factor(property[0]), get_pass_blend_factor(property[1]),
+										get_pass_blend_factor(property[2]), get_pass_blend_factor(property[3]));
+				else
+					pass.BlendingFactor(get_pass_blend_factor(property[0]), get_pass_blend_factor(property[1]));
+				break;
+			}
+
+			case "blending-equation-mode"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					pass.BlendingEquationMode(get_pass_blend_equation_mode(property[0]), get_pass_blend_equation_mode(property[1]));
+				else
+					pass.BlendingEquationMode(get_pass_blend_equation_mode(property[0]));
+				break;
+			}
+
+			case "iterations"_atom:
 			pass.Iterations(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "shader-program")
+			break;
+
+			case "shader-program"_atom:
 			pass.RenderProgram(get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers));
+			break;
+		}
 	}
 }
 
@@ -791,17 +838,25 @@ void set_animated_sprite_properties(const script_tree::ObjectNode &object, shape
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "running")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				animated_sprite.Start();
-			else
-				animated_sprite.Stop();
-		}
-		else if (property.Name() == "jump-backward")
+			case "running"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					animated_sprite.Start();
+				else
+					animated_sprite.Stop();
+				break;
+			}
+
+			case "jump-backward"_atom:
 			animated_sprite.JumpBackward(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
-		else if (property.Name() == "jump-forward")
+			break;
+
+			case "jump-forward"_atom:
 			animated_sprite.JumpForward(duration{property[0].Get<ScriptType::FloatingPoint>()->As<real>()});
+			break;
+		}
 	}
 }
 
@@ -812,27 +867,35 @@ void set_border_properties(const script_tree::ObjectNode &object, shapes::Border
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "border-color")
-			border.BorderColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "corner-color")
-		{
-			if (property.NumberOfArguments() == 4)
-				border.CornerColor(property[0].Get<ScriptType::Color>()->Get(),
-								   property[1].Get<ScriptType::Color>()->Get(),
-								   property[2].Get<ScriptType::Color>()->Get(),
-								   property[3].Get<ScriptType::Color>()->Get());
-			else
-				border.CornerColor(property[0].Get<ScriptType::Color>()->Get());
-		}
-		else if (property.Name() == "side-color")
+		switch (property.NameAtom())
 		{
-			if (property.NumberOfArguments() == 4)
-				border.SideColor(property[0].Get<ScriptType::Color>()->Get(),
-								 property[1].Get<ScriptType::Color>()->Get(),
-								 property[2].Get<ScriptType::Color>()->Get(),
-								 property[3].Get<ScriptType::Color>()->Get());
-			else
-				border.SideColor(property[0].Get<ScriptType::Color>()->Get());
+			case "border-color"_atom:
+			border.BorderColor(property[0].Get<ScriptType::Color>()->Get());
+			break;
+
+			case "corner-color"_atom:
+			{
+				if (property.NumberOfArguments() == 4)
+					border.CornerColor(property[0].Get<ScriptType::Color>()->Get(),
+									   property[1].Get<ScriptType::Color>()->Get(),
+									   property[2].Get<ScriptType::Color>()->Get(),
+									   property[3].Get<ScriptType::Color>()->Get());
+				else
+					border.CornerColor(property[0].Get<ScriptType::Color>()->Get());
+				break;
+			}
+
+			case "side-color"_atom:
+			{
+				if (property.NumberOfArguments() == 4)
+					border.SideColor(property[0].Get<ScriptType::Color>()->Get(),
+									 property[1].Get<ScriptType::Color>()->Get(),
+									 property[2].Get<ScriptType::Color>()->Get(),
+									 property[3].Get<ScriptType::Color>()->Get());
+				else
+					border.SideColor(property[0].Get<ScriptType::Color>()->Get());
+				break;
+			}
 		}
 	}
 }
@@ -844,10 +907,16 @@ void set_curve_properties(const script_tree::ObjectNode &object, shapes::Curve &
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "p")
+		switch (property.NameAtom())
+		{
+			case "p"_atom:
 			curve.P(property[0].Get<ScriptType::Integer>()->As<int>(), property[1].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "thickness")
+			break;
+
+			case "thickness"_atom:
 			curve.Thickness(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -858,16 +927,28 @@ void set_ellipse_properties(const script_tree::ObjectNode &object, shapes::Ellip
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "diameter")
+		switch (property.NameAtom())
+		{
+			case "diameter"_atom:
 			ellipse.Diameter(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			ellipse.Position(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "radius")
+			break;
+
+			case "radius"_atom:
 			ellipse.Radius(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "rotation")
+			break;
+
+			case "rotation"_atom:
 			ellipse.Rotation(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "size")
+			break;
+
+			case "size"_atom:
 			ellipse.Size(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
@@ -878,12 +959,20 @@ void set_line_properties(const script_tree::ObjectNode &object, shapes::Line &li
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "a")
+		switch (property.NameAtom())
+		{
+			case "a"_atom:
 			line.A(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "b")
+			break;
+
+			case "b"_atom:
 			line.B(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "thickness")
+			break;
+
+			case "thickness"_atom:
 			line.Thickness(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -894,16 +983,30 @@ void set_mesh_properties(const script_tree::ObjectNode &object, shapes::Mesh &me
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "include-bounding-volumes")
+		switch (property.NameAtom())
+		{
+			case "include-bounding-volumes"_atom:
 			mesh.IncludeBoundingVolumes(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "surface-material")
+			break;
+
+			case "surface-material"_atom:
 			mesh.SurfaceMaterial(get_material(property[0].Get<ScriptType::String>()->Get(), managers));
-		else if (property.Name() == "tex-coord-mode")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "manual")
-				mesh.TexCoordMode(shapes::mesh::MeshTexCoordMode::Manual);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "auto")
-				mesh.TexCoordMode(shapes::mesh::MeshTexCoordMode::Auto);
+			break;
+
+			case "tex-coord-mode"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "manual"_atom:
+					mesh.TexCoordMode(shapes::mesh::MeshTexCoordMode::Manual);
+					break;
+
+					case "auto"_atom:
+					mesh.TexCoordMode(shapes::mesh::MeshTexCoordMode::Auto);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -915,20 +1018,36 @@ void set_rectangle_properties(const script_tree::ObjectNode &object, shapes::Rec
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "height")
+		switch (property.NameAtom())
+		{
+			case "height"_atom:
 			rectangle.Height(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			rectangle.Position(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "resize-to-fill")
+			break;
+
+			case "resize-to-fill"_atom:
 			rectangle.ResizeToFill(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "resize-to-fit")
+			break;
+
+			case "resize-to-fit"_atom:
 			rectangle.ResizeToFit(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "rotation")
+			break;
+
+			case "rotation"_atom:
 			rectangle.Rotation(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "size")
+			break;
+
+			case "size"_atom:
 			rectangle.Size(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "width")
+			break;
+
+			case "width"_atom:
 			rectangle.Width(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -948,22 +1067,43 @@ void set_render_primitive_properties(const script_tree::ObjectNode &object, grap
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "color" || property.Name() == "base-color")
+		switch (property.NameAtom())
+		{
+			case "color"_atom:
+			case "base-color"_atom:
 			primitive.BaseColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "line-thickness")
+			break;
+
+			case "line-thickness"_atom:
 			primitive.LineThickness(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "material" || property.Name() == "render-material")
+			break;
+
+			case "material"_atom:
+			case "render-material"_atom:
 			primitive.RenderMaterial(get_material(property[0].Get<ScriptType::String>()->Get(), managers));
-		else if (property.Name() == "opacity" || property.Name() == "base-opacity")
+			break;
+
+			case "opacity"_atom:
+			case "base-opacity"_atom:
 			primitive.BaseOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "point-size")
+			break;
+
+			case "point-size"_atom:
 			primitive.PointSize(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "point-sprite")
+			break;
+
+			case "point-sprite"_atom:
 			primitive.PointSprite(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "wire-frame")
+			break;
+
+			case "wire-frame"_atom:
 			primitive.WireFrame(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "visible")
+			break;
+
+			case "visible"_atom:
 			primitive.Visible(property[0].Get<ScriptType::Boolean>()->Get());
+			break;
+		}
 	}
 }
 
@@ -974,10 +1114,16 @@ void set_shape_properties(const script_tree::ObjectNode &object, shapes::Shape &
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "fill-color")
+		switch (property.NameAtom())
+		{
+			case "fill-color"_atom:
 			shape.FillColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "fill-opacity")
+			break;
+
+			case "fill-opacity"_atom:
 			shape.FillOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -988,26 +1134,42 @@ void set_sprite_properties(const script_tree::ObjectNode &object, shapes::Sprite
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "auto-repeat")
+		switch (property.NameAtom())
+		{
+			case "auto-repeat"_atom:
 			sprite.AutoRepeat(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "auto-size")
+			break;
+
+			case "auto-size"_atom:
 			sprite.AutoSize(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "crop")
+			break;
+
+			case "crop"_atom:
 			sprite.Crop(Aabb{property[0].Get<ScriptType::Vector2>()->Get(), property[1].Get<ScriptType::Vector2>()->Get()});
-		else if (property.Name() == "flip-horizontal")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				sprite.FlipHorizontal();
-		}
-		else if (property.Name() == "flip-vertical")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				sprite.FlipVertical();
-		}
-		else if (property.Name() == "repeat")
+			break;
+
+			case "flip-horizontal"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					sprite.FlipHorizontal();
+				break;
+			}
+
+			case "flip-vertical"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					sprite.FlipVertical();
+				break;
+			}
+
+			case "repeat"_atom:
 			sprite.Repeat(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "tex-coords")
+			break;
+
+			case "tex-coords"_atom:
 			sprite.TexCoords(property[0].Get<ScriptType::Vector2>()->Get(), property[1].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
@@ -1018,12 +1180,20 @@ void set_triangle_properties(const script_tree::ObjectNode &object, shapes::Tria
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "a")
+		switch (property.NameAtom())
+		{
+			case "a"_atom:
 			triangle.A(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "b")
+			break;
+
+			case "b"_atom:
 			triangle.B(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "c")
+			break;
+
+			case "c"_atom:
 			triangle.C(property[0].Get<ScriptType::Vector3>()->Get());
+			break;
+		}
 	}
 }
 
@@ -1032,28 +1202,52 @@ void set_node_animation_properties(const script_tree::ObjectNode &object, graph:
 {
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "action")
+		switch (obj.NameAtom())
+		{
+			case "action"_atom:
 			create_action(obj, animation);
-		else if (obj.Name() == "color-fading")
+			break;
+
+			case "color-fading"_atom:
 			create_color_fading_motion(obj, animation);
-		else if (obj.Name() == "fading")
+			break;
+
+			case "fading"_atom:
 			create_fading_motion(obj, animation);
-		else if (obj.Name() == "model-action")
+			break;
+
+			case "model-action"_atom:
 			create_model_action(obj, animation);
-		else if (obj.Name() == "object-action")
+			break;
+
+			case "object-action"_atom:
 			create_object_action(obj, animation);
-		else if (obj.Name() == "particle-system-action")
+			break;
+
+			case "particle-system-action"_atom:
 			create_particle_system_action(obj, animation);
-		else if (obj.Name() == "rotation")
+			break;
+
+			case "rotation"_atom:
 			create_rotating_motion(obj, animation);
-		else if (obj.Name() == "scaling")
+			break;
+
+			case "scaling"_atom:
 			create_scaling_motion(obj, animation);
-		else if (obj.Name() == "sound-action")
+			break;
+
+			case "sound-action"_atom:
 			create_sound_action(obj, animation);
-		else if (obj.Name() == "timeline-action")
+			break;
+
+			case "timeline-action"_atom:
 			create_timeline_action(obj, animation);
-		else if (obj.Name() == "translation")
+			break;
+
+			case "translation"_atom:
 			create_translating_motion(obj, animation);
+			break;
+		}
 	}
 
 	for (auto &property : object.Properties())
@@ -1068,20 +1262,26 @@ void set_node_animation_group_properties(const script_tree::ObjectNode &object,
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "add")
+		switch (property.NameAtom())
 		{
-			auto node_animation =
-				get_node_animation(property[0].Get<ScriptType::String>()->Get(), parent_node);
+			case "add"_atom:
+			{
+				auto node_animation =
+					get_node_animation(property[0].Get<ScriptType::String>()->Get(), parent_node);
+
+				if (property.NumberOfArguments() == 3)
+					animation_group.Add(node_animation,
+										duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()},
+										property[2].Get<ScriptType::Boolean>()->Get());
+				else
+					animation_group.Add(node_animation);
+				break;
+			}
 
-			if (property.NumberOfArguments() == 3)
-				animation_group.Add(node_animation,
-									duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()},
-									property[2].Get<ScriptType::Boolean>()->Get());
-			else
-				animation_group.Add(node_animation);
-		}
-		else if (property.Name() == "start")
+			case "start"_atom:
 			animation_group.Start(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -1090,161 +1290,209 @@ void set_node_animation_timeline_properties(const script_tree::ObjectNode &objec
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "attach-animation")
-		{
-			auto node_animation =
-				get_node_animation(property[0].Get<ScriptType::String>()->Get(), parent_node);
-
-			if (property.NumberOfArguments() == 3)
-				timeline.Attach(node_animation,
-								duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()},
-								property[2].Get<ScriptType::Boolean>()->Get());
-			else if (property.NumberOfArguments() == 2)
-				timeline.Attach(node_animation,
-								duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()});
-			else
-				timeline.Attach(node_animation);
-		}
-		else if (property.Name() == "attach-animation-group")
-		{
-			auto node_animation_group =
-				get_node_animation_group(property[0].Get<ScriptType::String>()->Get(), parent_node);
-
-			if (property.NumberOfArguments() == 3)
-				timeline.Attach(node_animation_group,
-								duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()},
-								property[2].Get<ScriptType::Boolean>()->Get());
-			else if (property.NumberOfArguments() == 2)
-				timeline.Attach(node_animation_group,
-								duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()});
-			else
-				timeline.Attach(node_animation_group);
-		}
-		else if (property.Name() == "playback-rate")
+		switch (property.NameAtom())
+		{
+			case "attach-animation"_atom:
+			{
+				auto node_animation =
+					get_node_animation(property[0].Get<ScriptType::String>()->Get(), parent_node);
+
+				if (property.NumberOfArguments() == 3)
+					timeline.Attach(node_animation,
+									duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()},
+									property[2].Get<ScriptType::Boolean>()->Get());
+				else if (property.NumberOfArguments() == 2)
+					timeline.Attach(node_animation,
+									duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()});
+				else
+					timeline.Attach(node_animation);
+				break;
+			}
+
+			case "attach-animation-group"_atom:
+			{
+				auto node_animation_group =
+					get_node_animation_group(property[0].Get<ScriptType::String>()->Get(), parent_node);
+
+				if (property.NumberOfArguments() == 3)
+					timeline.Attach(node_animation_group,
+									duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()},
+									property[2].Get<ScriptType::Boolean>()->Get());
+				else if (property.NumberOfArguments() == 2)
+					timeline.Attach(node_animation_group,
+									duration{property[1].Get<ScriptType::FloatingPoint>()->As<real>()});
+				else
+					timeline.Attach(node_animation_group);
+				break;
+			}
+
+			case "playback-rate"_atom:
 			timeline.PlaybackRate(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "repeat-count")
+			break;
+
+			case "repeat-count"_atom:
 			timeline.RepeatCount(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "running")
-		{
-			if (property[0].Get<ScriptType::Boolean>()->Get())
-				timeline.Start();
-			else
-				timeline.Stop();
+			break;
+
+			case "running"_atom:
+			{
+				if (property[0].Get<ScriptType::Boolean>()->Get())
+					timeline.Start();
+				else
+					timeline.Stop();
+				break;
+			}
 		}
 	}
 }
 
-void set_scene_node_properties(const script_tree::ObjectNode &object, graph::SceneNode &scene_node,
-	SceneManager &scene_manager, const ManagerRegister &managers)
+void set_scene_node_properties(const script_tree::ObjectNode &object, graph::SceneNode &scene_node)
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "derived-position")
+		switch (property.NameAtom())
+		{
+			case "derived-position"_atom:
 			scene_node.DerivedPosition(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "derived-rotation")
+			break;
+
+			case "derived-rotation"_atom:
 			scene_node.DerivedRotation(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "derived-scaling")
+			break;
+
+			case "derived-scaling"_atom:
 			scene_node.DerivedScaling(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "direction")
+			break;
+
+			case "direction"_atom:
 			scene_node.Direction(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "flip-visibility")
+			break;
+
+			case "flip-visibility"_atom:
 			scene_node.FlipVisibility(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "inherit-rotation")
+			break;
+
+			case "inherit-rotation"_atom:
 			scene_node.InheritRotation(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "inherit-scaling")
+			break;
+
+			case "inherit-scaling"_atom:
 			scene_node.InheritScaling(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			scene_node.Position(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "rotate")
+			break;
+
+			case "rotate"_atom:
 			scene_node.Rotate(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "rotation")
+			break;
+
+			case "rotation"_atom:
 			scene_node.Rotation(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "rotation-origin")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "parent")
-				scene_node.RotationOrigin(graph::scene_node::NodeRotationOrigin::Parent);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "local")
-				scene_node.RotationOrigin(graph::scene_node::NodeRotationOrigin::Local);
-		}
-		else if (property.Name() == "scale")
+			break;
+
+			case "rotation-origin"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "parent"_atom:
+					scene_node.RotationOrigin(graph::scene_node::NodeRotationOrigin::Parent);
+					break;
+
+					case "local"_atom:
+					scene_node.RotationOrigin(graph::scene_node::NodeRotationOrigin::Local);
+					break;
+				}
+				break;
+			}
+
+			case "scale"_atom:
 			scene_node.Scale(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "scaling")
+			break;
+
+			case "scaling"_atom:
 			scene_node.Scaling(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "translate")
+			break;
+
+			case "translate"_atom:
 			scene_node.Translate(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "visible")
-		{
-			if (property.NumberOfArguments() == 2)
-				scene_node.Visible(property[0].Get<ScriptType::Boolean>()->Get(), property[1].Get<ScriptType::Boolean>()->Get());
-			else
-				scene_node.Visible(property[0].Get<ScriptType::Boolean>()->Get());
+			break;
+
+			case "visible"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					scene_node.Visible(property[0].Get<ScriptType::Boolean>()->Get(), property[1].Get<ScriptType::Boolean>()->Get());
+				else
+					scene_node.Visible(property[0].Get<ScriptType::Boolean>()->Get());
+				break;
+			}
 		}
 	}
+}
+
+void set_scene_node_properties(const script_tree::ObjectNode &object, graph::SceneNode &scene_node,
+	SceneManager &scene_manager, const ManagerRegister &managers)
+{
+	set_scene_node_properties(object, scene_node);
 
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "camera")
-		{
-			if (auto camera = create_camera(obj, scene_manager); camera)
-				scene_node.AttachObject(*camera);
-		}
-		else if (obj.Name() == "drawable-particle-system")
-		{
-			if (auto particle_system = create_drawable_particle_system(obj, scene_manager, managers); particle_system)
-				scene_node.AttachObject(*particle_system);
-		}
-		else if (obj.Name() == "drawable-text")
-		{
-			if (auto text = create_drawable_text(obj, scene_manager, managers); text)
-				scene_node.AttachObject(*text);
-		}
-		else if (obj.Name() == "light")
-		{
-			if (auto light = create_light(obj, scene_manager); light)
-				scene_node.AttachObject(*light);
-		}
-		else if (obj.Name() == "model")
-		{
-			if (auto model = create_model(obj, scene_manager, managers); model)
-				scene_node.AttachObject(*model);
-		}
-		else if (obj.Name() == "movable-sound")
-		{
-			if (auto sound = create_movable_sound(obj, scene_manager, managers); sound)
-				scene_node.AttachObject(*sound);
-		}
-		else if (obj.Name() == "movable-sound-listener")
-		{
-			if (auto sound_listener = create_movable_sound_listener(obj, scene_manager, managers); sound_listener)
-				scene_node.AttachObject(*sound_listener);
-		}
-
-		else if (obj.Name() == "animation")
+		switch (obj.NameAtom())
+		{
+			case "camera"_atom:
+			case "drawable-particle-system"_atom:
+			case "drawable-text"_atom:
+			case "light"_atom:
+			case "model"_atom:
+			case "movable-sound"_atom:
+			case "movable-sound-listener"_atom:
+			attach_movable_object(obj, scene_node, scene_manager, managers);
+			break;
+
+			case "animation"_atom:
 			create_node_animation(obj, scene_node);
-		else if (obj.Name() == "animation-group")
+			break;
+
+			case "animation-group"_atom:
 			create_node_animation_group(obj, scene_node);
-		else if (obj.Name() == "animation-timeline")
+			break;
+
+			case "animation-timeline"_atom:
 			create_node_animation_timeline(obj, scene_node);
-		else if (obj.Name() == "scene-node")
+			break;
+
+			case "scene-node"_atom:
 			create_scene_node(obj, scene_node, scene_manager, managers);
+			break;
+		}
 	}
 }
 
-
 void set_camera_properties(const script_tree::ObjectNode &object, Camera &camera)
 {
 	set_movable_object_properties(object, camera);
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "base-viewport-height")
+		switch (property.NameAtom())
+		{
+			case "base-viewport-height"_atom:
 			camera.BaseViewportHeight(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			camera.Position(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "rotation")
+			break;
+
+			case "rotation"_atom:
 			camera.Rotation(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "scaling")
+			break;
+
+			case "scaling"_atom:
 			camera.Scaling(property[0].Get<ScriptType::Vector2>()->Get());
+			break;
+		}
 	}
 }
 
@@ -1297,10 +1545,16 @@ void set_drawable_text_properties(const script_tree::ObjectNode &object, Drawabl
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "position")
+		switch (property.NameAtom())
+		{
+			case "position"_atom:
 			text.Position(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "rotation")
+			break;
+
+			case "rotation"_atom:
 			text.Rotation(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()));
+			break;
+		}
 	}
 }
 
@@ -1310,37 +1564,69 @@ void set_light_properties(const script_tree::ObjectNode &object, Light &light)
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "ambient-color")
+		switch (property.NameAtom())
+		{
+			case "ambient-color"_atom:
 			light.AmbientColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "attenuation")
+			break;
+
+			case "attenuation"_atom:
 			light.Attenuation(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
 							  property[1].Get<ScriptType::FloatingPoint>()->As<real>(),
 							  property[2].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "cast-shadows")
+			break;
+
+			case "cast-shadows"_atom:
 			light.CastShadows(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "cutoff")
+			break;
+
+			case "cutoff"_atom:
 			light.Cutoff(utilities::math::ToRadians(property[0].Get<ScriptType::FloatingPoint>()->As<real>()),
 						 utilities::math::ToRadians(property[1].Get<ScriptType::FloatingPoint>()->As<real>()));
-		else if (property.Name() == "diffuse-color")
+			break;
+
+			case "diffuse-color"_atom:
 			light.DiffuseColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "direction")
+			break;
+
+			case "direction"_atom:
 			light.Direction(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "intensity")
+			break;
+
+			case "intensity"_atom:
 			light.Intensity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "position")
+			break;
+
+			case "position"_atom:
 			light.Position(property[0].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "radius")
+			break;
+
+			case "radius"_atom:
 			light.Radius(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "specular-color")
+			break;
+
+			case "specular-color"_atom:
 			light.SpecularColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "type")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "point")
-				light.Type(light::LightType::Point);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "directional")
-				light.Type(light::LightType::Directional);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "spot")
-				light.Type(light::LightType::Spot);
+			break;
+
+			case "type"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "point"_atom:
+					light.Type(light::LightType::Point);
+					break;
+
+					case "directional"_atom:
+					light.Type(light::LightType::Directional);
+					break;
+
+					case "spot"_atom:
+					light.Type(light::LightType::Spot);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
@@ -1352,24 +1638,44 @@ void set_model_properties(const script_tree::ObjectNode &object, Model &model,
 
 	for (auto &obj : object.Objects())
 	{
-		if (obj.Name() == "animated-sprite")
+		switch (obj.NameAtom())
+		{
+			case "animated-sprite"_atom:
 			create_animated_sprite(obj, model, managers);
-		else if (obj.Name() == "border")
+			break;
+
+			case "border"_atom:
 			create_border(obj, model, managers);
-		else if (obj.Name() == "curve")
+			break;
+
+			case "curve"_atom:
 			create_curve(obj, model, managers);
-		else if (obj.Name() == "ellipse")
+			break;
+
+			case "ellipse"_atom:
 			create_ellipse(obj, model, managers);
-		else if (obj.Name() == "line")
+			break;
+
+			case "line"_atom:
 			create_line(obj, model, managers);
-		else if (obj.Name() == "mesh")
+			break;
+
+			case "mesh"_atom:
 			create_mesh(obj, model, managers);
-		else if (obj.Name() == "rectangle")
+			break;
+
+			case "rectangle"_atom:
 			create_rectangle(obj, model, managers);
-		else if (obj.Name() == "sprite")
+			break;
+
+			case "sprite"_atom:
 			create_sprite(obj, model, managers);
-		else if (obj.Name() == "triangle")
+			break;
+
+			case "triangle"_atom:
 			create_triangle(obj, model, managers);
+			break;
+		}
 	}
 }
 
@@ -1377,36 +1683,62 @@ void set_movable_object_properties(const script_tree::ObjectNode &object, Movabl
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "alias")
-			movable_object.Alias(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "bounding-volume-colors")
+		switch (property.NameAtom())
 		{
-			if (property.NumberOfArguments() == 3)
-				movable_object.BoundingVolumeColors(property[0].Get<ScriptType::Color>()->Get(),
-													property[1].Get<ScriptType::Color>()->Get(),
-													property[2].Get<ScriptType::Color>()->Get());
-			else
-				movable_object.BoundingVolumeColors(property[0].Get<ScriptType::Color>()->Get());
-		}
-		else if (property.Name() == "bounding-volume-extent")
+			case "alias"_atom:
+			movable_object.Alias(property[0].Get<ScriptType::String>()->Get());
+			break;
+
+			case "bounding-volume-colors"_atom:
+			{
+				if (property.NumberOfArguments() == 3)
+					movable_object.BoundingVolumeColors(property[0].Get<ScriptType::Color>()->Get(),
+														property[1].Get<ScriptType::Color>()->Get(),
+														property[2].Get<ScriptType::Color>()->Get());
+				else
+					movable_object.BoundingVolumeColors(property[0].Get<ScriptType::Color>()->Get());
+				break;
+			}
+
+			case "bounding-volume-extent"_atom:
 			movable_object.BoundingVolumeExtent(graphics::utilities::Aabb{property[0].Get<ScriptType::Vector2>()->Get(), property[1].Get<ScriptType::Vector2>()->Get()});
-		else if (property.Name() == "prefered-bounding-volume")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "bounding-box")
-				movable_object.PreferredBoundingVolume(movable_object::PreferredBoundingVolumeType::BoundingBox);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "bounding-sphere")
-				movable_object.PreferredBoundingVolume(movable_object::PreferredBoundingVolumeType::BoundingSphere);
-		}
-		else if (property.Name() == "query-flags")
+			break;
+
+			case "prefered-bounding-volume"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "bounding-box"_atom:
+					movable_object.PreferredBoundingVolume(movable_object::PreferredBoundingVolumeType::BoundingBox);
+					break;
+
+					case "bounding-sphere"_atom:
+					movable_object.PreferredBoundingVolume(movable_object::PreferredBoundingVolumeType::BoundingSphere);
+					break;
+				}
+				break;
+			}
+
+			case "query-flags"_atom:
 			movable_object.AddQueryFlags(property[0].Get<ScriptType::Integer>()->As<uint32>());
-		else if (property.Name() == "query-mask")
+			break;
+
+			case "query-mask"_atom:
 			movable_object.AddQueryMask(property[0].Get<ScriptType::Integer>()->As<uint32>());
-		else if (property.Name() == "show-bounding-volumes")
+			break;
+
+			case "show-bounding-volumes"_atom:
 			movable_object.ShowBoundingVolumes(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "tag")
+			break;
+
+			case "tag"_atom:
 			movable_object.Tag(property[0].Get<ScriptType::String>()->Get());
-		else if (property.Name() == "visible")
+			break;
+
+			case "visible"_atom:
 			movable_object.Visible(property[0].Get<ScriptType::Boolean>()->Get());
+			break;
+		}
 	}
 }
 
@@ -2336,8 +2668,7 @@ NonOwningPtr<graph::animations::NodeAnimationTimeline> create_node_animation_tim
 	return node_animation_timeline;
 }
 
-NonOwningPtr<graph::SceneNode> create_scene_node(const script_tree::ObjectNode &object,
-	graph::SceneNode &parent_node, SceneManager &scene_manager, const ManagerRegister &managers)
+OwningPtr<graph::SceneNode> make_scene_node(const script_tree::ObjectNode &object, bool parent_visible)
 {
 	auto name =
 		[&]() noexcept -> std::optional<std::string>
@@ -2355,9 +2686,15 @@ NonOwningPtr<graph::SceneNode> create_scene_node(const script_tree::ObjectNode &
 		.Get<ScriptType::Vector2>().value_or(vector2::UnitY).Get();
 	auto visible = object
 		.Property("visible")[0]
-		.Get<ScriptType::Boolean>().value_or(parent_node.Visible()).Get();
+		.Get<ScriptType::Boolean>().value_or(parent_visible).Get();
 
-	auto node = parent_node.CreateChildNode(std::move(name), position, initial_direction, visible);
+	return make_owning<graph::SceneNode>(std::move(name), position, initial_direction, visible);
+}
+
+NonOwningPtr<graph::SceneNode> create_scene_node(const script_tree::ObjectNode &object,
+	graph::SceneNode &parent_node, SceneManager &scene_manager, const ManagerRegister &managers)
+{
+	auto node = parent_node.Adopt(make_scene_node(object, parent_node.Visible()));
 
 	if (node)
 		set_scene_node_properties(object, *node, scene_manager, managers);
@@ -2366,6 +2703,63 @@ NonOwningPtr<graph::SceneNode> create_scene_node(const script_tree::ObjectNode &
 }
 
 
+void attach_movable_object(const script_tree::ObjectNode &object, graph::SceneNode &scene_node,
+	SceneManager &scene_manager, const ManagerRegister &managers)
+{
+	switch (object.NameAtom())
+	{
+		case "camera"_atom:
+		{
+			if (auto camera = create_camera(object, scene_manager); camera)
+				scene_node.AttachObject(*camera);
+			break;
+		}
+
+		case "drawable-particle-system"_atom:
+		{
+			if (auto particle_system = create_drawable_particle_system(object, scene_manager, managers); particle_system)
+				scene_node.AttachObject(*particle_system);
+			break;
+		}
+
+		case "drawable-text"_atom:
+		{
+			if (auto text = create_drawable_text(object, scene_manager, managers); text)
+				scene_node.AttachObject(*text);
+			break;
+		}
+
+		case "light"_atom:
+		{
+			if (auto light = create_light(object, scene_manager); light)
+				scene_node.AttachObject(*light);
+			break;
+		}
+
+		case "model"_atom:
+		{
+			if (auto model = create_model(object, scene_manager, managers); model)
+				scene_node.AttachObject(*model);
+			break;
+		}
+
+		case "movable-sound"_atom:
+		{
+			if (auto sound = create_movable_sound(object, scene_manager, managers); sound)
+				scene_node.AttachObject(*sound);
+			break;
+		}
+
+		case "movable-sound-listener"_atom:
+		{
+			if (auto sound_listener = create_movable_sound_listener(object, scene_manager, managers); sound_listener)
+				scene_node.AttachObject(*sound_listener);
+			break;
+		}
+	}
+}
+
+
 NonOwningPtr<Camera> create_camera(const script_tree::ObjectNode &object,
 	graphics::scene::SceneManager &scene_manager)
 {
@@ -2596,14 +2990,103 @@ NonOwningPtr<MovableSoundListener> create_movable_sound_listener(const script_tr
 }
 
 
-void create_scene(const ScriptTree &tree, graph::SceneNode &parent_node,
-	SceneManager &scene_manager, const ManagerRegister &managers)
+void decode_scene_node(const script_tree::ObjectNode &object, graph::SceneNode &scene_node,
+	decoded_scene_node &decoded_node)
 {
-	for (auto &object : tree.Objects())
+	//Derived properties depends on the parent node
+	//Set all properties (and create all child nodes) when attached, to keep the script order
+	for (auto &property : object.Properties())
 	{
-		if (object.Name() == "scene-node")
-			create_scene_node(object, parent_node, scene_manager, managers);
+		switch (property.NameAtom())
+		{
+			case "derived-position"_atom:
+			case "derived-rotation"_atom:
+			case "derived-scaling"_atom:
+			decoded_node.deferred.emplace_back(&scene_node, &object);
+			return;
+		}
 	}
+
+	set_scene_node_properties(object, scene_node);
+
+	for (auto &obj : object.Objects())
+	{
+		switch (obj.NameAtom())
+		{
+			//Movable objects are created by the scene manager
+			case "camera"_atom:
+			case "drawable-particle-system"_atom:
+			case "drawable-text"_atom:
+			case "light"_atom:
+			case "model"_atom:
+			case "movable-sound"_atom:
+			case "movable-sound-listener"_atom:
+			decoded_node.deferred.emplace_back(&scene_node, &obj);
+			break;
+
+			case "animation"_atom:
+			create_node_animation(obj, scene_node);
+			break;
+
+			case "animation-group"_atom:
+			create_node_animation_group(obj, scene_node);
+			break;
+
+			case "animation-timeline"_atom:
+			create_node_animation_timeline(obj, scene_node);
+			break;
+
+			case "scene-node"_atom:
+			{
+				if (auto node = scene_node.Adopt(make_scene_node(obj, scene_node.Visible())); node)
+					decode_scene_node(obj, *node, decoded_node);
+				break;
+			}
+		}
+	}
+}
+
+decoded_scene_node decode_scene_node(const script_tree::ObjectNode &object, bool parent_visible)
+{
+	decoded_scene_node decoded_node;
+	decoded_node.node = make_scene_node(object, parent_visible);
+	decode_scene_node(object, *decoded_node.node, decoded_node);
+	return decoded_node;
+}
+
+NonOwningPtr<graph::SceneNode> commit_scene_node(decoded_scene_node &&decoded_node,
+	graph::SceneNode &parent_node, SceneManager &scene_manager, const ManagerRegister &managers)
+{
+	auto node = parent_node.Adopt(std::move(decoded_node.node));
+
+	if (node)
+	{
+		//Replay deferred work in script order
+		for (auto &[scene_node, object] : decoded_node.deferred)
+		{
+			if (object->NameAtom() == "scene-node"_atom)
+				set_scene_node_properties(*object, *scene_node, scene_manager, managers);
+			else
+				attach_movable_object(*object, *scene_node, scene_manager, managers);
+		}
+	}
+
+	return node;
+}
+
+
+void create_scene(const ScriptTree &tree, graph::SceneNode &parent_node,
+	SceneManager &scene_manager, const ManagerRegister &managers)
+{
+	script_interface::detail::create_objects(tree, "scene-node",
+		[&, parent_visible = parent_node.Visible()](const script_tree::ObjectNode &object)
+		{
+			return decode_scene_node(object, parent_visible);
+		},
+		[&](decoded_scene_node &&decoded_node)
+		{
+			commit_scene_node(std::move(decoded_node), parent_node, scene_manager, managers);
+		});
 }
 
 } //scene_script_interface::detail
@@ -2613,7 +3096,8 @@ void create_scene(const ScriptTree &tree, graph::SceneNode &parent_node,
 
 ScriptValidator SceneScriptInterface::GetValidator() const
 {
-	return detail::get_scene_validator();
+	static const auto validator = detail::get_scene_validator().Compile();
+	return validator;
 }
 
 
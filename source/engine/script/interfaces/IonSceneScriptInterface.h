@@ -14,6 +14,8 @@ File:	IonSceneScriptInterface.h
 #define ION_SCENE_SCRIPT_INTERFACE_H
 
 #include <string_view>
+#include <utility>
+#include <vector>
 
 #include "IonScriptInterface.h"
 #include "graphics/render/IonFrustum.h"
@@ -44,6 +46,7 @@ File:	IonSceneScriptInterface.h
 #include "graphics/scene/shapes/IonSprite.h"
 #include "graphics/scene/shapes/IonTriangle.h"
 #include "memory/IonNonOwningPtr.h"
+#include "memory/IonOwningPtr.h"
 #include "script/IonScriptTree.h"
 #include "script/IonScriptValidator.h"
 #include "types/IonTypes.h"
@@ -178,6 +181,16 @@ namespace ion::script::interfaces
 
 		///@}
 
+		///@brief A scene node decoded from a script, without being added to any scene graph
+		///@details Work that needs the parent node or the scene manager is deferred until the scene node is attached.
+		///Deferred work is stored in script order, so that objects are attached in the same order as when created directly
+		struct decoded_scene_node final
+		{
+			OwningPtr<graphics::scene::graph::SceneNode> node;
+			std::vector<std::pair<graphics::scene::graph::SceneNode*, const script_tree::ObjectNode*>> deferred; //Nodes with derived properties and movable objects
+		};
+
+
 		/**
 			@name Tree parsing
 			@{
@@ -215,6 +228,7 @@ namespace ion::script::interfaces
 			graphics::scene::graph::SceneNode &parent_node);
 		void set_node_animation_timeline_properties(const script_tree::ObjectNode &object, graphics::scene::graph::animations::NodeAnimationTimeline &timeline,
 			graphics::scene::graph::SceneNode &parent_node);
+		void set_scene_node_properties(const script_tree::ObjectNode &object, graphics::scene::graph::SceneNode &scene_node);
 		void set_scene_node_properties(const script_tree::ObjectNode &object, graphics::scene::graph::SceneNode &scene_node,
 			graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers);
 
@@ -285,9 +299,13 @@ namespace ion::script::interfaces
 			graphics::scene::graph::SceneNode &parent_node);
 		NonOwningPtr<graphics::scene::graph::animations::NodeAnimationTimeline> create_node_animation_timeline(const script_tree::ObjectNode &object,
 			graphics::scene::graph::SceneNode &parent_node);
+		OwningPtr<graphics::scene::graph::SceneNode> make_scene_node(const script_tree::ObjectNode &object, bool parent_visible);
 		NonOwningPtr<graphics::scene::graph::SceneNode> create_scene_node(const script_tree::ObjectNode &object,
 			graphics::scene::graph::SceneNode &parent_node, graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers);
 
+		void attach_movable_object(const script_tree::ObjectNode &object, graphics::scene::graph::SceneNode &scene_node,
+			graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers);
+
 		NonOwningPtr<graphics::scene::Camera> create_camera(const script_tree::ObjectNode &object,
 			graphics::scene::SceneManager &scene_manager);
 		NonOwningPtr<graphics::scene::DrawableParticleSystem> create_drawable_particle_system(const script_tree::ObjectNode &object,
@@ -303,6 +321,12 @@ namespace ion::script::interfaces
 		NonOwningPtr<graphics::scene::MovableSoundListener> create_movable_sound_listener(const script_tree::ObjectNode &object,
 			graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers);
 
+		void decode_scene_node(const script_tree::ObjectNode &object, graphics::scene::graph::SceneNode &scene_node,
+			decoded_scene_node &decoded_node);
+		decoded_scene_node decode_scene_node(const script_tree::ObjectNode &object, bool parent_visible);
+		NonOwningPtr<graphics::scene::graph::SceneNode> commit_scene_node(decoded_scene_node &&decoded_node,
+			graphics::scene::graph::SceneNode &parent_node, graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers);
+
 		void create_scene(const ScriptTree &tree, graphics::scene::graph::SceneNode &parent_node,
 			graphics::scene::SceneManager &scene_manager, const ManagerRegister &managers);
 
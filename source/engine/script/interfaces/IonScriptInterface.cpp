@@ -39,6 +39,13 @@ bool ScriptInterface::Load(std::string_view asset_name)
 		//Built and validated successfully
 		if (builder_.Build(asset_name))
 		{
+			//Keep track of loaded assets, so that changes can be detected
+			if (builder_.Compiler().Graph())
+			{
+				if (auto file_path = repository->FilePath(asset_name); file_path)
+					loaded_assets_[std::string{asset_name}] = script_compiler::detail::unit_id(file_path->lexically_normal().string());
+			}
+
 			tree_ = builder_.Tree();
 			return tree_.has_value();
 		}
@@ -64,6 +71,32 @@ bool ScriptInterface::Load(std::string_view asset_name)
 
 //Public
 
+/*
+	Reloading
+*/
+
+std::vector<std::string> ScriptInterface::ChangedAssets()
+{
+	std::vector<std::string> asset_names;
+
+	if (auto graph = builder_.Compiler().Graph(); graph)
+	{
+		adaptors::FlatSet<std::string> changed_ids;
+
+		for (auto &file_path : graph->Poll())
+			changed_ids.insert(script_compiler::detail::unit_id(file_path.string()));
+
+		for (auto &[asset_name, id] : loaded_assets_)
+		{
+			if (changed_ids.contains(id))
+				asset_names.push_back(asset_name);
+		}
+	}
+
+	return asset_names;
+}
+
+
 /*
 	Script repositories - Creating
 */
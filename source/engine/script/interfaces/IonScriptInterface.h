@@ -16,12 +16,15 @@ File:	IonScriptInterface.h
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
+#include "adaptors/IonFlatMap.h"
 #include "assets/repositories/IonFileRepository.h"
 #include "assets/repositories/IonScriptRepository.h"
 #include "managed/IonObjectManager.h"
 #include "managed/IonObjectRegister.h"
 #include "memory/IonNonOwningPtr.h"
+#include "parallel/IonTaskScheduler.h"
 #include "script/IonScriptBuilder.h"
 #include "script/IonScriptCompiler.h"
 #include "script/IonScriptTree.h"
@@ -60,6 +63,36 @@ namespace ion::script::interfaces
 
 			return {};
 		}
+
+
+		///@brief Creates all top level objects with the given name from the given tree, in two phases
+		///@details The decode phase calls the given decode function for each object in parallel.
+		///The decode function should return a complete (unmanaged) object, and must not modify any shared state.
+		///The commit phase then calls the given commit function for each decoded object, serially and in script order
+		template <typename DecodeT, typename CommitT>
+		inline void create_objects(const ScriptTree &tree, std::string_view name, DecodeT &&decode, CommitT &&commit)
+		{
+			using object_type = std::invoke_result_t<DecodeT&, const script_tree::ObjectNode&>;
+			std::vector<const script_tree::ObjectNode*> objects;
+
+			for (auto &object : tree.Objects())
+			{
+				if (object.Name() == name)
+					objects.push_back(&object);
+			}
+
+			//Decode
+			std::vector<std::optional<object_type>> decoded_objects(std::size(objects));
+			parallel::TaskScheduler::Instance().ParallelFor(0, static_cast<int>(std::size(objects)),
+				[&](int i)
+				{
+					decoded_objects[i].emplace(std::invoke(decode, *objects[i]));
+				});
+
+			//Commit
+			for (auto &object : decoded_objects)
+				std::invoke(commit, std::move(*object));
+		}
 	} //script_interface::detail
 
 
@@ -78,6 +111,7 @@ namespace ion::script::interfaces
 		
 			ScriptBuilder builder_;
 			std::optional<ScriptTree> tree_;
+			adaptors::FlatMap<std::string, std::string> loaded_assets_; //Asset name -> unit id (when building incrementally)
 
 			static inline ManagerRegister manager_register_;
 
@@ -152,6 +186,14 @@ namespace ion::script::interfaces
 				builder_.Compiler().MaxBuildProcesses(max_build_processes);
 			}
 
+			///@brief Sets whether or not the compiler should build incrementally
+			///@details When enabled, unchanged script files are not lexed again when loading, and changed assets can be found with ChangedAssets
+			inline void IncrementalBuild(bool enable)
+			{
+				builder_.Compiler().IncrementalBuild(enable);
+				loaded_assets_.clear();
+			}
+
 
 			///@brief Sets output options for the builder
 			///@details Pass nullopt or {} to turn off any builder output
@@ -196,6 +238,17 @@ namespace ion::script::interfaces
 
 			///@}
 
+			/**
+				@name Reloading
+				@{
+			*/
+
+			///@brief Returns the names of all loaded assets that have changed on disk (or imports a script file that has changed)
+			///@details Only works when building incrementally. The returned assets should be loaded again to reflect the changes
+			[[nodiscard]] std::vector<std::string> ChangedAssets();
+
+			///@}
+
 			/**
 				@name Script repositories - Creating
 				@{
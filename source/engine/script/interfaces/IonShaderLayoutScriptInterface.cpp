@@ -18,6 +18,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace shader_layout_script_interface;
 using namespace graphics::shaders;
@@ -245,12 +246,20 @@ void set_shader_layout_properties(const script_tree::ObjectNode &object, ShaderL
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "bind-attribute")
+		switch (property.NameAtom())
+		{
+			case "bind-attribute"_atom:
 			bind_attribute(property, shader_layout);
-		else if (property.Name() == "bind-struct")
+			break;
+
+			case "bind-struct"_atom:
 			bind_struct(property, shader_layout);
-		else if (property.Name() == "bind-uniform")
+			break;
+
+			case "bind-uniform"_atom:
 			bind_uniform(property, shader_layout);
+			break;
+		}
 	}
 }
 
@@ -287,7 +296,8 @@ void create_shader_layouts(const ScriptTree &tree,
 
 ScriptValidator ShaderLayoutScriptInterface::GetValidator() const
 {
-	return detail::get_shader_layout_validator();
+	static const auto validator = detail::get_shader_layout_validator().Compile();
+	return validator;
 }
 
 
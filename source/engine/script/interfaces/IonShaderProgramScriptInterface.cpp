@@ -22,6 +22,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace shader_program_script_interface;
 using namespace graphics::shaders;
@@ -446,29 +447,43 @@ void set_shader_program_properties(const script_tree::ObjectNode &object,
 
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "attribute")
-			create_attribute(property, shader_program);
-		else if (property.Name() == "attributes")
-		{
-			if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
-				shader_program.CopyAttributes(*program);
-		}
-		else if (property.Name() == "struct")
-		{
-			if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
-				shader_program.CopyStruct(*program, property[1].Get<ScriptType::String>()->Get());
-		}
-		else if (property.Name() == "structs")
+		switch (property.NameAtom())
 		{
-			if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
-				shader_program.CopyStructs(*program);
-		}
-		else if (property.Name() == "uniform")
+			case "attribute"_atom:
+			create_attribute(property, shader_program);
+			break;
+
+			case "attributes"_atom:
+			{
+				if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
+					shader_program.CopyAttributes(*program);
+				break;
+			}
+
+			case "struct"_atom:
+			{
+				if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
+					shader_program.CopyStruct(*program, property[1].Get<ScriptType::String>()->Get());
+				break;
+			}
+
+			case "structs"_atom:
+			{
+				if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
+					shader_program.CopyStructs(*program);
+				break;
+			}
+
+			case "uniform"_atom:
 			create_uniform(property, shader_program);
-		else if (property.Name() == "uniforms")
-		{
-			if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
-				shader_program.CopyUniforms(*program);
+			break;
+
+			case "uniforms"_atom:
+			{
+				if (auto program = get_shader_program(property[0].Get<ScriptType::String>()->Get(), managers); program)
+					shader_program.CopyUniforms(*program);
+				break;
+			}
 		}
 	}
 }
@@ -545,7 +560,8 @@ void create_shader_programs(const ScriptTree &tree,
 
 ScriptValidator ShaderProgramScriptInterface::GetValidator() const
 {
-	return detail::get_shader_program_validator();
+	static const auto validator = detail::get_shader_program_validator().Compile();
+	return validator;
 }
 
 
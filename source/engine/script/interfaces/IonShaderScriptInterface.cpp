@@ -93,7 +93,8 @@ void create_shaders(const ScriptTree &tree,
 
 ScriptValidator ShaderScriptInterface::GetValidator() const
 {
-	return detail::get_shader_validator();
+	static const auto validator = detail::get_shader_validator().Compile();
+	return validator;
 }
 
 
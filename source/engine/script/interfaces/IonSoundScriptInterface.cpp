@@ -19,6 +19,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace sound_script_interface;
 using namespace sounds;
@@ -132,23 +133,35 @@ void set_sound_channel_properties(const script_tree::ObjectNode &object, SoundCh
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "attributes")
+		switch (property.NameAtom())
+		{
+			case "attributes"_atom:
 			sound_channel.Attributes(property[0].Get<ScriptType::Vector3>()->Get(),
 									 property[1].Get<ScriptType::Vector3>()->Get());
-		else if (property.Name() == "distance")
-		{
-			if (property.NumberOfArguments() == 2)
-				sound_channel.Distance(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
-									   property[1].Get<ScriptType::FloatingPoint>()->As<real>());
-			else
-				sound_channel.Distance(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		}
-		else if (property.Name() == "mute")
+			break;
+
+			case "distance"_atom:
+			{
+				if (property.NumberOfArguments() == 2)
+					sound_channel.Distance(property[0].Get<ScriptType::FloatingPoint>()->As<real>(),
+										   property[1].Get<ScriptType::FloatingPoint>()->As<real>());
+				else
+					sound_channel.Distance(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+				break;
+			}
+
+			case "mute"_atom:
 			sound_channel.Mute(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "pitch")
+			break;
+
+			case "pitch"_atom:
 			sound_channel.Pitch(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "volume")
+			break;
+
+			case "volume"_atom:
 			sound_channel.Volume(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -156,12 +169,20 @@ void set_sound_channel_group_properties(const script_tree::ObjectNode &object, S
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "mute")
+		switch (property.NameAtom())
+		{
+			case "mute"_atom:
 			sound_channel_group.Mute(property[0].Get<ScriptType::Boolean>()->Get());
-		else if (property.Name() == "pitch")
+			break;
+
+			case "pitch"_atom:
 			sound_channel_group.Pitch(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "volume")
+			break;
+
+			case "volume"_atom:
 			sound_channel_group.Volume(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
+			break;
+		}
 	}
 }
 
@@ -279,12 +300,20 @@ void create_sounds(const ScriptTree &tree,
 {
 	for (auto &object : tree.Objects())
 	{
-		if (object.Name() == "sound")
+		switch (object.NameAtom())
+		{
+			case "sound"_atom:
 			create_sound(object, sound_manager);
-		else if (object.Name() == "sound-channel-group")
+			break;
+
+			case "sound-channel-group"_atom:
 			create_sound_channel_group(object, sound_manager);
-		else if (object.Name() == "sound-listener")
+			break;
+
+			case "sound-listener"_atom:
 			create_sound_listener(object, sound_manager);
+			break;
+		}
 	}
 }
 
@@ -295,7 +324,8 @@ void create_sounds(const ScriptTree &tree,
 
 ScriptValidator SoundScriptInterface::GetValidator() const
 {
-	return detail::get_sound_validator();
+	static const auto validator = detail::get_sound_validator().Compile();
+	return validator;
 }
 
 
@@ -19,6 +19,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace text_script_interface;
 using namespace graphics::fonts;
@@ -84,87 +85,171 @@ void set_text_properties(const script_tree::ObjectNode &object, Text &text)
 {
 	for (auto &property : object.Properties())
 	{
-		if (property.Name() == "alignment")
+		switch (property.NameAtom())
 		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "left")
-				text.Alignment(text::TextAlignment::Left);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "center")
-				text.Alignment(text::TextAlignment::Center);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "right")
-				text.Alignment(text::TextAlignment::Right);
-		}
-		else if (property.Name() == "area-size")
+			case "alignment"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "left"_atom:
+					text.Alignment(text::TextAlignment::Left);
+					break;
+
+					case "center"_atom:
+					text.Alignment(text::TextAlignment::Center);
+					break;
+
+					case "right"_atom:
+					text.Alignment(text::TextAlignment::Right);
+					break;
+				}
+				break;
+			}
+
+			case "area-size"_atom:
 			text.AreaSize(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "default-background-color")
+			break;
+
+			case "default-background-color"_atom:
 			text.DefaultBackgroundColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "default-base-opacity")
+			break;
+
+			case "default-base-opacity"_atom:
 			text.DefaultBaseOpacity(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "default-decoration")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "overline")
-				text.DefaultDecoration(text::TextDecoration::Overline);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "line-through")
-				text.DefaultDecoration(text::TextDecoration::LineThrough);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "underline")
-				text.DefaultDecoration(text::TextDecoration::Underline);
-		}
-		else if (property.Name() == "default-decoration-color")
+			break;
+
+			case "default-decoration"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "overline"_atom:
+					text.DefaultDecoration(text::TextDecoration::Overline);
+					break;
+
+					case "line-through"_atom:
+					text.DefaultDecoration(text::TextDecoration::LineThrough);
+					break;
+
+					case "underline"_atom:
+					text.DefaultDecoration(text::TextDecoration::Underline);
+					break;
+				}
+				break;
+			}
+
+			case "default-decoration-color"_atom:
 			text.DefaultDecorationColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "default-font-style")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "bold")
-				text.DefaultFontStyle(text::TextFontStyle::Bold);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "italic")
-				text.DefaultFontStyle(text::TextFontStyle::Italic);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "bold-italic")
-				text.DefaultFontStyle(text::TextFontStyle::BoldItalic);
-		}
-		else if (property.Name() == "default-foreground-color")
+			break;
+
+			case "default-font-style"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "bold"_atom:
+					text.DefaultFontStyle(text::TextFontStyle::Bold);
+					break;
+
+					case "italic"_atom:
+					text.DefaultFontStyle(text::TextFontStyle::Italic);
+					break;
+
+					case "bold-italic"_atom:
+					text.DefaultFontStyle(text::TextFontStyle::BoldItalic);
+					break;
+				}
+				break;
+			}
+
+			case "default-foreground-color"_atom:
 			text.DefaultForegroundColor(property[0].Get<ScriptType::Color>()->Get());
-		else if (property.Name() == "from-line")
+			break;
+
+			case "from-line"_atom:
 			text.FromLine(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "formatting")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "none")
-				text.Formatting(text::TextFormatting::None);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "html")
-				text.Formatting(text::TextFormatting::HTML);
-		}
-		else if (property.Name() == "line-height")
+			break;
+
+			case "formatting"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "none"_atom:
+					text.Formatting(text::TextFormatting::None);
+					break;
+
+					case "html"_atom:
+					text.Formatting(text::TextFormatting::HTML);
+					break;
+				}
+				break;
+			}
+
+			case "line-height"_atom:
 			text.LineHeight(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "line-height-factor")
+			break;
+
+			case "line-height-factor"_atom:
 			text.LineHeightFactor(property[0].Get<ScriptType::FloatingPoint>()->As<real>());
-		else if (property.Name() == "max-lines")
+			break;
+
+			case "max-lines"_atom:
 			text.MaxLines(property[0].Get<ScriptType::Integer>()->As<int>());
-		else if (property.Name() == "overflow")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "truncate")
-				text.Overflow(text::TextOverflow::Truncate);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "truncate-ellipsis")
-				text.Overflow(text::TextOverflow::TruncateEllipsis);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "word-truncate")
-				text.Overflow(text::TextOverflow::WordTruncate);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "word-wrap")
-				text.Overflow(text::TextOverflow::WordWrap);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "wrap")
-				text.Overflow(text::TextOverflow::Wrap);
-		}
-		else if (property.Name() == "padding")
+			break;
+
+			case "overflow"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "truncate"_atom:
+					text.Overflow(text::TextOverflow::Truncate);
+					break;
+
+					case "truncate-ellipsis"_atom:
+					text.Overflow(text::TextOverflow::TruncateEllipsis);
+					break;
+
+					case "word-truncate"_atom:
+					text.Overflow(text::TextOverflow::WordTruncate);
+					break;
+
+					case "word-wrap"_atom:
+					text.Overflow(text::TextOverflow::WordWrap);
+					break;
+
+					case "wrap"_atom:
+					text.Overflow(text::TextOverflow::Wrap);
+					break;
+				}
+				break;
+			}
+
+			case "padding"_atom:
 			text.Padding(property[0].Get<ScriptType::Vector2>()->Get());
-		else if (property.Name() == "vertical-alignment")
-		{
-			if (property[0].Get<ScriptType::Enumerable>()->Get() == "top")
-				text.VerticalAlignment(text::TextVerticalAlignment::Top);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "middle")
-				text.VerticalAlignment(text::TextVerticalAlignment::Middle);
-			else if (property[0].Get<ScriptType::Enumerable>()->Get() == "bottom")
-				text.VerticalAlignment(text::TextVerticalAlignment::Bottom);
+			break;
+
+			case "vertical-alignment"_atom:
+			{
+				switch (property[0].ValueAtom())
+				{
+					case "top"_atom:
+					text.VerticalAlignment(text::TextVerticalAlignment::Top);
+					break;
+
+					case "middle"_atom:
+					text.VerticalAlignment(text::TextVerticalAlignment::Middle);
+					break;
+
+					case "bottom"_atom:
+					text.VerticalAlignment(text::TextVerticalAlignment::Bottom);
+					break;
+				}
+				break;
+			}
 		}
 	}
 }
 
-NonOwningPtr<Text> create_text(const script_tree::ObjectNode &object,
-	TextManager &text_manager, const ManagerRegister &managers)
+Text decode_text(const script_tree::ObjectNode &object,
+	const ManagerRegister &managers)
 {
 	auto name = object
 		.Property("name")[0]
@@ -176,23 +261,30 @@ NonOwningPtr<Text> create_text(const script_tree::ObjectNode &object,
 		.Property("type-face")[0]
 		.Get<ScriptType::String>()->Get();
 
-	auto text = text_manager.CreateText(std::move(name), std::move(content),
-		get_type_face(type_face_name, managers));
-
-	if (text)
-		set_text_properties(object, *text);
-
+	Text text{std::move(name), std::move(content),
+		get_type_face(type_face_name, managers)};
+	set_text_properties(object, text);
 	return text;
 }
 
+NonOwningPtr<Text> create_text(const script_tree::ObjectNode &object,
+	TextManager &text_manager, const ManagerRegister &managers)
+{
+	return text_manager.CreateText(decode_text(object, managers));
+}
+
 void create_texts(const ScriptTree &tree,
 	TextManager &text_manager, const ManagerRegister &managers)
 {
-	for (auto &object : tree.Objects())
-	{
-		if (object.Name() == "text")
-			create_text(object, text_manager, managers);
-	}
+	script_interface::detail::create_objects(tree, "text",
+		[&](const script_tree::ObjectNode &object)
+		{
+			return decode_text(object, managers);
+		},
+		[&](Text &&text)
+		{
+			text_manager.CreateText(std::move(text));
+		});
 }
 
 } //text_script_interface::detail
@@ -202,7 +294,8 @@ void create_texts(const ScriptTree &tree,
 
 ScriptValidator TextScriptInterface::GetValidator() const
 {
-	return detail::get_text_validator();
+	static const auto validator = detail::get_text_validator().Compile();
+	return validator;
 }
 
 
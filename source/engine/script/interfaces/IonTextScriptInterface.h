@@ -47,6 +47,9 @@ namespace ion::script::interfaces
 		void set_text_properties(const script_tree::ObjectNode &object, graphics::fonts::Text &text);
 
 
+		graphics::fonts::Text decode_text(const script_tree::ObjectNode &object,
+			const ManagerRegister &managers);
+
 		NonOwningPtr<graphics::fonts::Text> create_text(const script_tree::ObjectNode &object,
 			graphics::fonts::TextManager &text_manager, const ManagerRegister &managers);
 
@@ -19,6 +19,7 @@ namespace ion::script::interfaces
 {
 
 using namespace std::string_literals;
+using namespace script_tree::literals;
 using namespace script_validator;
 using namespace texture_script_interface;
 using namespace graphics::textures;
@@ -215,10 +216,16 @@ void create_textures(const ScriptTree &tree,
 {
 	for (auto &object : tree.Objects())
 	{
-		if (object.Name() == "texture")
+		switch (object.NameAtom())
+		{
+			case "texture"_atom:
 			create_texture(object, texture_manager);
-		else if (object.Name() == "texture-atlas")
+			break;
+
+			case "texture-atlas"_atom:
 			create_texture_atlas(object, texture_manager);
+			break;
+		}
 	}
 }
 
@@ -229,7 +236,8 @@ void create_textures(const ScriptTree &tree,
 
 ScriptValidator TextureScriptInterface::GetValidator() const
 {
-	return detail::get_texture_validator();
+	static const auto validator = detail::get_texture_validator().Compile();
+	return validator;
 }
 
 
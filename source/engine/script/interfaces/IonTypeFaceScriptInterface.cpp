@@ -106,7 +106,8 @@ void create_type_faces(const ScriptTree &tree,
 
 ScriptValidator TypeFaceScriptInterface::GetValidator() const
 {
-	return detail::get_type_face_validator();
+	static const auto validator = detail::get_type_face_validator().Compile();
+	return validator;
 }
 
 
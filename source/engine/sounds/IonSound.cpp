@@ -163,6 +163,10 @@ NonOwningPtr<SoundChannel> Sound::Play(NonOwningPtr<SoundChannel> sound_channel,
 	if (!sound_channel)
 		return Play(paused);
 
+	//Keep sound resident (or load it back in if evicted)
+	if (auto owner = Owner(); owner)
+		owner->Use(*this);
+
 	if (handle_)
 	{
 		if (auto system = sound_manager::detail::get_system(*handle_); system)
@@ -435,6 +435,18 @@ bool SoundManager::UnloadResource(Sound &sound) noexcept
 		return false;
 }
 
+bool SoundManager::EvictableResource(const Sound &sound) const noexcept
+{
+	//Never evict a sound that is playing
+	for (auto &sound_channel : sound.SoundChannels())
+	{
+		if (sound_channel.IsPlaying())
+			return false;
+	}
+
+	return true;
+}
+
 
 void SoundManager::ResourceLoaded(Sound &sound) noexcept
 {
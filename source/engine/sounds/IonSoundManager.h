@@ -133,6 +133,7 @@ namespace ion::sounds
 			bool PrepareResource(Sound &sound) override;
 			bool LoadResource(Sound &sound) override;
 			bool UnloadResource(Sound &sound) noexcept override;
+			bool EvictableResource(const Sound &sound) const noexcept override;
 
 
 			///@brief See FileResourceManager::ResourceLoaded for more details
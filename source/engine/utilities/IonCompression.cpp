@@ -0,0 +1,216 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	utilities
+File:	IonCompression.cpp
+-------------------------------------------
+*/
+
+#include "IonCompression.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace ion::utilities::compression
+{
+
+namespace detail
+{
+
+void write_length(std::string &result, std::size_t length)
+{
+	for (; length >= 255; length -= 255)
+		result.push_back(static_cast<char>(255));
+
+	result.push_back(static_cast<char>(length));
+}
+
+std::optional<std::size_t> read_length(std::string_view bytes, std::size_t &off) noexcept
+{
+	auto length = std::size_t{0};
+
+	for (uint8 c = 255; c == 255; length += c)
+	{
+		if (off >= std::size(bytes))
+			return {};
+
+		c = static_cast<uint8>(bytes[off++]);
+	}
+
+	return length;
+}
+
+} //detail
+
+
+/*
+	Compressing
+*/
+
+std::string Compress(std::string_view bytes)
+{
+	std::string result;
+	result.reserve(MaxCompressedSize(std::size(bytes)));
+
+	auto size = std::size(bytes);
+	auto first = std::data(bytes);
+	auto anchor = std::size_t{0}; //First literal not yet written
+
+	auto write_sequence =
+		[&](std::size_t literal_length, std::size_t match_length)
+		{
+			auto token = static_cast<uint8>(std::min(literal_length, std::size_t{15}) << 4);
+
+			if (match_length > 0)
+				token |= static_cast<uint8>(std::min(match_length - detail::min_match, std::size_t{15}));
+
+			result.push_back(static_cast<char>(token));
+
+			if (literal_length >= 15)
+				detail::write_length(result, literal_length - 15);
+
+			result.append(first + anchor, literal_length);
+		};
+
+	if (size > detail::match_safe_distance)
+	{
+		//Position + 1 of last occurrence of each hashed sequence (0 if none)
+		auto table = std::make_unique<uint32[]>(detail::hash_table_size);
+		auto match_limit = size - detail::match_safe_distance;
+		auto match_end_limit = size - detail::last_literals;
+
+		for (auto off = std::size_t{0}; off < match_limit;)
+		{
+			auto sequence = detail::read_sequence(first + off);
+			auto &entry = table[detail::hash(sequence)];
+			auto candidate = static_cast<std::size_t>(entry);
+			entry = static_cast<uint32>(off + 1);
+
+			//No match
+			if (candidate == 0 || off - (candidate - 1) > detail::max_offset ||
+				detail::read_sequence(first + candidate - 1) != sequence)
+			{
+				++off;
+				continue;
+			}
+
+			auto match = candidate - 1;
+			auto match_length = static_cast<std::size_t>(detail::min_match);
+
+			while (off + match_length < match_end_limit &&
+				first[match + match_length] == first[off + match_length])
+				++match_length;
+
+			//Extend match backwards
+			while (off > anchor && match > 0 && first[off - 1] == first[match - 1])
+			{
+				--off;
+				--match;
+				++match_length;
+			}
+
+			write_sequence(off - anchor, match_length);
+
+			auto offset = off - match;
+			result.push_back(static_cast<char>(offset & 0xff));
+			result.push_back(static_cast<char>(offset >> 8));
+
+			if (match_length - detail::min_match >= 15)
+				detail::write_length(result, match_length - detail::min_match - 15);
+
+			off += match_length;
+			anchor = off;
+		}
+	}
+
+	//Last literals
+	write_sequence(size - anchor, 0);
+	return result;
+}
+
+
+/*
+	Decompressing
+*/
+
+std::optional<std::string> Decompress(std::string_view compressed_bytes, std::size_t size)
+{
+	std::string result(size, '\0');
+	auto out = std::size_t{0};
+
+	for (auto off = std::size_t{0}; off < std::size(compressed_bytes);)
+	{
+		auto token = static_cast<uint8>(compressed_bytes[off++]);
+		auto literal_length = static_cast<std::size_t>(token >> 4);
+
+		if (literal_length == 15)
+		{
+			if (auto length = detail::read_length(compressed_bytes, off); length)
+				literal_length += *length;
+			else
+				return {};
+		}
+
+		//Control literals
+		if (literal_length > std::size(compressed_bytes) - off ||
+			literal_length > size - out)
+			return {};
+
+		std::copy_n(std::data(compressed_bytes) + off, literal_length, std::data(result) + out);
+		off += literal_length;
+		out += literal_length;
+
+		//Last sequence
+		if (off == std::size(compressed_bytes))
+			break;
+
+		if (std::size(compressed_bytes) - off < 2)
+			return {};
+
+		auto offset = static_cast<std::size_t>(static_cast<uint8>(compressed_bytes[off])) |
+			static_cast<std::size_t>(static_cast<uint8>(compressed_bytes[off + 1])) << 8;
+		off += 2;
+
+		auto match_length = static_cast<std::size_t>(token & 0x0f);
+
+		if (match_length == 15)
+		{
+			if (auto length = detail::read_length(compressed_bytes, off); length)
+				match_length += *length;
+			else
+				return {};
+		}
+
+		match_length += detail::min_match;
+
+		//Control match
+		if (offset == 0 || offset > out ||
+			match_length > size - out)
+			return {};
+
+		auto match = std::data(result) + (out - offset);
+		auto dest = std::data(result) + out;
+
+		if (offset >= match_length)
+			std::copy_n(match, match_length, dest);
+		else
+		{
+			//Copy byte by byte, since the match overlaps
+			for (auto i = std::size_t{0}; i < match_length; ++i)
+				dest[i] = match[i];
+		}
+
+		out += match_length;
+	}
+
+	if (out != size)
+		return {};
+
+	return result;
+}
+
+} //ion::utilities::compression
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	utilities
+File:	IonCompression.h
+-------------------------------------------
+*/
+
+#ifndef ION_COMPRESSION_H
+#define ION_COMPRESSION_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "types/IonTypes.h"
+
+///@brief Namespace containing functions for compressing and decompressing bytes
+///@details Uses a fast LZ77 (LZ4 style) block format, that favors decompression speed over compression ratio
+namespace ion::utilities::compression
+{
+	using namespace types::type_literals;
+
+	namespace detail
+	{
+		/*
+			Block format
+
+			[sequence 0] ... [sequence n-1]
+			sequence: token (1) | literal length (0+) | literals | match offset (2) | match length (0+)
+			token: literal length (high 4 bits) | match length - min match (low 4 bits)
+
+			Lengths of 15 or more continues in the following bytes (each adding 0-255, until a byte less than 255).
+			The last sequence contains literals only, and has no match offset or match length
+		*/
+
+		constexpr auto min_match = 4;
+		constexpr auto max_offset = 65'535;
+		constexpr auto last_literals = 5; //The last bytes are always literals
+		constexpr auto match_safe_distance = 12; //The last match must start before this distance from the end
+
+		constexpr auto hash_bits = 16;
+		constexpr auto hash_table_size = 1 << hash_bits;
+
+
+		constexpr auto hash(uint32 sequence) noexcept
+		{
+			return static_cast<int>((sequence * 2'654'435'761_ui32) >> (32 - hash_bits));
+		}
+
+		inline auto read_sequence(const char *first) noexcept
+		{
+			return static_cast<uint32>(static_cast<uint8>(first[0])) |
+				static_cast<uint32>(static_cast<uint8>(first[1])) << 8 |
+				static_cast<uint32>(static_cast<uint8>(first[2])) << 16 |
+				static_cast<uint32>(static_cast<uint8>(first[3])) << 24;
+		}
+
+
+		void write_length(std::string &result, std::size_t length);
+		std::optional<std::size_t> read_length(std::string_view bytes, std::size_t &off) noexcept;
+	} //detail
+
+
+	/**
+		@name Compressing
+		@{
+	*/
+
+	///@brief Compresses the given bytes and returns the compressed bytes
+	///@details The compressed bytes can be larger than the given bytes, if the given bytes are not compressible.
+	///The size of the given bytes is not stored, and is required for decompressing
+	[[nodiscard]] std::string Compress(std::string_view bytes);
+
+	///@brief Returns the max size of the compressed bytes, for bytes with the given size
+	[[nodiscard]] constexpr auto MaxCompressedSize(std::size_t size) noexcept
+	{
+		return size + size / 255 + 16;
+	}
+
+	///@}
+
+	/**
+		@name Decompressing
+		@{
+	*/
+
+	///@brief Decompresses the given compressed bytes, to bytes with the given (uncompressed) size
+	///@details Returns nullopt if the compressed bytes are malformed, or does not decompress to the given size
+	[[nodiscard]] std::optional<std::string> Decompress(std::string_view compressed_bytes, std::size_t size);
+
+	///@}
+} //ion::utilities::compression
+
+#endif
\ No newline at end of file
@@ -20,10 +20,17 @@ File:	IonCrypto.h
 #include "types/IonTypes.h"
 
 ///@brief Namespace containing safe cryptographic hashing functions like SHA3, SHAKE and Keccac variants
+///@details Also contains fast non-cryptographic hashing functions, like FNV-1a
 namespace ion::utilities::crypto
 {
+	using namespace types::type_literals;
+
 	namespace detail
 	{
+		constexpr auto fnv_offset_basis = 14695981039346656037_ui64;
+		constexpr auto fnv_prime = 1099511628211_ui64;
+
+
 		class keccak final
 		{
 			private:
@@ -115,6 +122,28 @@ namespace ion::utilities::crypto
 	[[nodiscard]] std::string SHAKE_256(std::string_view input, int output_length);
 
 	///@}
+
+	/**
+		@name Hashing - FNV-1a (non-cryptographic)
+		@{
+	*/
+
+	///@brief Function to compute the 64 bit FNV-1a hash of the input message
+	///@details Can be evaluated at compile time
+	[[nodiscard]] constexpr auto FNV1a_64(std::string_view input) noexcept
+	{
+		auto hash = detail::fnv_offset_basis;
+
+		for (auto c : input)
+		{
+			hash ^= static_cast<uint8>(c);
+			hash *= detail::fnv_prime;
+		}
+
+		return hash;
+	}
+
+	///@}
 } //ion::utilities::crypto
 
 #endif
\ No newline at end of file
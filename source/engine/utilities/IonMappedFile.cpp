@@ -0,0 +1,139 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	utilities
+File:	IonMappedFile.cpp
+-------------------------------------------
+*/
+
+#include "IonMappedFile.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "system/IonSystemAPI.h"
+
+#ifndef ION_WIN32
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace ion::utilities::file
+{
+
+//Private
+
+void MappedFile::Unmap() noexcept
+{
+	if (data_)
+	{
+		#ifdef ION_WIN32
+		UnmapViewOfFile(data_);
+		#else
+		munmap(const_cast<char*>(data_), size_);
+		#endif
+
+		data_ = nullptr;
+		size_ = 0;
+	}
+}
+
+
+//Public
+
+MappedFile::MappedFile(std::filesystem::path file_path) noexcept :
+	file_path_{std::move(file_path)}
+{
+	#ifdef ION_WIN32
+	if (auto file = CreateFileW(file_path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr); file != INVALID_HANDLE_VALUE)
+	{
+		//Empty files can not be mapped
+		if (LARGE_INTEGER file_size; GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+		{
+			if (auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr); mapping)
+			{
+				if (auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0); view)
+				{
+					data_ = static_cast<const char*>(view);
+					size_ = static_cast<std::size_t>(file_size.QuadPart);
+				}
+
+				CloseHandle(mapping); //The view keeps the mapping alive
+			}
+		}
+
+		CloseHandle(file);
+	}
+	#else
+	if (auto file = open(file_path_.c_str(), O_RDONLY); file != -1)
+	{
+		//Empty files can not be mapped
+		if (struct stat file_status; fstat(file, &file_status) == 0 && file_status.st_size > 0)
+		{
+			if (auto view = mmap(nullptr, static_cast<std::size_t>(file_status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+				view != MAP_FAILED)
+			{
+				data_ = static_cast<const char*>(view);
+				size_ = static_cast<std::size_t>(file_status.st_size);
+			}
+		}
+
+		close(file); //The view keeps the mapping alive
+	}
+	#endif
+}
+
+MappedFile::MappedFile(MappedFile &&rhs) noexcept :
+	file_path_{std::move(rhs.file_path_)},
+	data_{std::exchange(rhs.data_, nullptr)},
+	size_{std::exchange(rhs.size_, 0)}
+{
+	//Empty
+}
+
+MappedFile::~MappedFile() noexcept
+{
+	Unmap();
+}
+
+
+/*
+	Operators
+*/
+
+MappedFile& MappedFile::operator=(MappedFile &&rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		Unmap();
+		file_path_ = std::move(rhs.file_path_);
+		data_ = std::exchange(rhs.data_, nullptr);
+		size_ = std::exchange(rhs.size_, 0);
+	}
+
+	return *this;
+}
+
+
+/*
+	Viewing
+*/
+
+std::string_view MappedFile::View(std::streamoff position, std::streamsize count) const noexcept
+{
+	auto size = static_cast<std::streamoff>(size_);
+
+	if (position < 0 || position >= size || count <= 0)
+		return {};
+
+	return {data_ + position, static_cast<std::size_t>(std::min<std::streamoff>(size - position, count))};
+}
+
+} //ion::utilities::file
\ No newline at end of file
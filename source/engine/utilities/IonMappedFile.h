@@ -0,0 +1,112 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	utilities
+File:	IonMappedFile.h
+-------------------------------------------
+*/
+
+#ifndef ION_MAPPED_FILE_H
+#define ION_MAPPED_FILE_H
+
+#include <filesystem>
+#include <iosfwd>
+#include <string_view>
+
+namespace ion::utilities::file
+{
+	///@brief A class representing a read-only memory mapping of an entire file
+	///@details The file is mapped once when constructed, and unmapped when destroyed.
+	///Views returned from a mapped file are valid for as long as the mapped file lives
+	class MappedFile final
+	{
+		private:
+
+			std::filesystem::path file_path_;
+			const char *data_ = nullptr;
+			std::size_t size_ = 0;
+
+
+			void Unmap() noexcept;
+
+		public:
+
+			///@brief Default constructor
+			MappedFile() = default;
+
+			///@brief Constructs a new mapped file by mapping the file at the given file path
+			///@details If the file could not be mapped, the mapped file is empty (IsMapped returns false)
+			explicit MappedFile(std::filesystem::path file_path) noexcept;
+
+			///@brief Deleted copy constructor
+			MappedFile(const MappedFile&) = delete;
+
+			///@brief Move constructor
+			MappedFile(MappedFile &&rhs) noexcept;
+
+			///@brief Destructor
+			~MappedFile() noexcept;
+
+
+			/**
+				@name Operators
+				@{
+			*/
+
+			///@brief Deleted copy assignment
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			///@brief Move assignment
+			MappedFile& operator=(MappedFile &&rhs) noexcept;
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns true if the file is mapped into memory
+			[[nodiscard]] inline auto IsMapped() const noexcept
+			{
+				return !!data_;
+			}
+
+			///@brief Returns the file path of the mapped file
+			[[nodiscard]] inline auto& FilePath() const noexcept
+			{
+				return file_path_;
+			}
+
+			///@brief Returns the size of the mapped file in bytes
+			[[nodiscard]] inline auto Size() const noexcept
+			{
+				return size_;
+			}
+
+			///@}
+
+			/**
+				@name Viewing
+				@{
+			*/
+
+			///@brief Returns a view of the entire mapped file
+			[[nodiscard]] inline auto View() const noexcept
+			{
+				return std::string_view{data_, size_};
+			}
+
+			///@brief Returns a view of the mapped file in range [position, position + count)
+			///@details The range is clamped to the size of the mapped file (same as LoadPartOf)
+			[[nodiscard]] std::string_view View(std::streamoff position, std::streamsize count) const noexcept;
+
+			///@}
+	};
+} //ion::utilities::file
+
+#endif
\ No newline at end of file
@@ -20,8 +20,8 @@ namespace detail
 
 void random_generator::Initialize() noexcept
 {
-	Engine32();
-	Engine64();
+	GlobalEngine32();
+	GlobalEngine64();
 }
 
 } //detail
@@ -15,6 +15,8 @@ File:	IonRandom.h
 
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <optional>
 #include <random>
 #include <type_traits>
 
@@ -23,6 +25,8 @@ File:	IonRandom.h
 ///@brief Namespace containing commonly used functions for generating random numbers in different ranges
 namespace ion::utilities::random
 {
+	class Stream; //Forward declaration
+
 	namespace detail
 	{
 		//Type traits for deciding which uniform distribution to use
@@ -61,6 +65,10 @@ namespace ion::utilities::random
 		using random_distribution_t = typename random_distribution<T>::type;
 
 
+		///@brief The random stream used by the calling thread (if any)
+		inline thread_local Stream *current_stream = nullptr;
+
+
 		///@brief Random generator class for seeding a 32 and 64 bit mersenne twister engine
 		class random_generator final
 		{
@@ -104,18 +112,22 @@ namespace ion::utilities::random
 
 				static void Initialize() noexcept;
 
-				static inline auto &Engine32() noexcept
+				static inline auto &GlobalEngine32() noexcept
 				{
 					static auto engine32{SeedEngine32<std::mt19937>()};
 					return engine32;
 				}
 
-				static inline auto &Engine64() noexcept
+				static inline auto &GlobalEngine64() noexcept
 				{
 					static auto engine64{SeedEngine64<std::mt19937_64>()};
 					return engine64;
 				}
 
+				//Returns the engine of the current stream (if any), else the global engine
+				static std::mt19937& Engine32() noexcept;
+				static std::mt19937_64& Engine64() noexcept;
+
 				template <typename T>
 				static auto Number32(T min, T max) noexcept
 				{
@@ -131,12 +143,176 @@ namespace ion::utilities::random
 	} //detail
 
 
+	///@brief A class representing a deterministic stream of random numbers
+	///@details A stream with the same seed always produces the same sequence of numbers.
+	///A stream can be made current for the calling thread with a stream scope,
+	///so that all random numbers generated on that thread are drawn from the stream
+	class Stream final
+	{
+		private:
+
+			uint64 seed_ = 0;
+			std::optional<std::mt19937> engine32_;
+			std::optional<std::mt19937_64> engine64_;
+
+		public:
+
+			///@brief Constructs a new stream with a seed drawn from the current stream of the calling thread (if any), else from the global engine
+			Stream() noexcept :
+				seed_{detail::random_generator::Number64(uint64{0}, std::numeric_limits<uint64>::max())}
+			{
+				//Empty
+			}
+
+			///@brief Constructs a new stream with the given seed
+			explicit Stream(uint64 seed) noexcept :
+				seed_{seed}
+			{
+				//Empty
+			}
+
+
+			/**
+				@name Modifiers
+				@{
+			*/
+
+			///@brief Sets the seed of this stream to the given value
+			///@details The stream is restarted from the beginning of the new sequence
+			inline void Seed(uint64 seed) noexcept
+			{
+				seed_ = seed;
+				engine32_.reset();
+				engine64_.reset();
+			}
+
+			///@}
+
+			/**
+				@name Observers
+				@{
+			*/
+
+			///@brief Returns the seed of this stream
+			[[nodiscard]] inline auto Seed() const noexcept
+			{
+				return seed_;
+			}
+
+			///@}
+
+			/**
+				@name Engines
+				Engines are seeded lazily on first use
+				@{
+			*/
+
+			///@brief Returns the 32 bit mersenne twister engine of this stream
+			[[nodiscard]] inline auto& Engine32() noexcept
+			{
+				if (!engine32_)
+				{
+					std::seed_seq seed{static_cast<uint32>(seed_), static_cast<uint32>(seed_ >> 32)};
+					engine32_.emplace(seed);
+				}
+
+				return *engine32_;
+			}
+
+			///@brief Returns the 64 bit mersenne twister engine of this stream
+			[[nodiscard]] inline auto& Engine64() noexcept
+			{
+				if (!engine64_)
+					engine64_.emplace(seed_);
+
+				return *engine64_;
+			}
+
+			///@}
+
+			/**
+				@name Random numbers
+				@{
+			*/
+
+			///@brief Returns a random number in range [min, max], drawn from this stream
+			template <typename T>
+			[[nodiscard]] inline auto Number(T min, T max) noexcept
+			{
+				static_assert(std::is_arithmetic_v<T>);
+
+				//Use 32 bit engine
+				if constexpr (sizeof(T) <= 4)
+					return detail::random_distribution_t<T>{min, max}(Engine32());
+				//Use 64 bit engine
+				else
+					return detail::random_distribution_t<T>{min, max}(Engine64());
+			}
+
+			///@}
+	};
+
+
+	///@brief A class representing a scope where the given stream is current for the calling thread
+	///@details The previous stream (if any) is made current again when the scope ends
+	class StreamScope final
+	{
+		private:
+
+			Stream *previous_stream_ = nullptr;
+
+		public:
+
+			///@brief Makes the given stream current for the calling thread
+			explicit StreamScope(Stream &stream) noexcept :
+				previous_stream_{detail::current_stream}
+			{
+				detail::current_stream = &stream;
+			}
+
+			///@brief Deleted copy constructor
+			StreamScope(const StreamScope&) = delete;
+
+			///@brief Restores the previous stream for the calling thread
+			~StreamScope() noexcept
+			{
+				detail::current_stream = previous_stream_;
+			}
+
+
+			/**
+				@name Operators
+				@{
+			*/
+
+			///@brief Deleted copy assignment
+			StreamScope& operator=(const StreamScope&) = delete;
+
+			///@}
+	};
+
+
+	namespace detail
+	{
+		inline std::mt19937& random_generator::Engine32() noexcept
+		{
+			return current_stream ? current_stream->Engine32() : GlobalEngine32();
+		}
+
+		inline std::mt19937_64& random_generator::Engine64() noexcept
+		{
+			return current_stream ? current_stream->Engine64() : GlobalEngine64();
+		}
+	} //detail
+
+
 	/**
 		@name Random integer or floating point in specified range
 		@{
 	*/
 
 	///@brief Returns a random number in range [min, max]
+	///@details Drawn from the current stream of the calling thread (if any), else from the global engine
 	template <typename T>
 	[[nodiscard]] inline auto Number(T min, T max) noexcept
 	{
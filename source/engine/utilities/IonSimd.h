@@ -0,0 +1,483 @@
+/*
+-------------------------------------------
+This source file is part of Ion Engine
+	- A fast and lightweight 2D game engine
+	- Written in C++ using OpenGL
+
+Author:	Jan Ivar Goli
+Area:	utilities
+File:	IonSimd.h
+-------------------------------------------
+*/
+
+#ifndef ION_SIMD_H
+#define ION_SIMD_H
+
+#include <bit>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "types/IonTypes.h"
+
+//Select instruction set at compile time
+//Define ION_NO_SIMD to always use the scalar fallback
+#if !defined(ION_NO_SIMD) && !defined(ION_EXTENDED_PRECISION) && !defined(ION_DOUBLE_PRECISION)
+	#if defined(__AVX__)
+		#define ION_SIMD_AVX
+	#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define ION_SIMD_SSE2
+	#endif
+#endif
+
+//Select instruction set for byte packs at compile time
+//Byte packs only use integer instructions, and are therefore not affected by the precision of real
+#if !defined(ION_NO_SIMD)
+	#if defined(__AVX2__)
+		#define ION_SIMD_BYTE_AVX2
+	#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define ION_SIMD_BYTE_SSE2
+	#endif
+#endif
+
+#if defined(ION_SIMD_AVX) || defined(ION_SIMD_BYTE_AVX2)
+	#include <immintrin.h>
+#elif defined(ION_SIMD_SSE2) || defined(ION_SIMD_BYTE_SSE2)
+	#include <emmintrin.h>
+#endif
+
+///@brief Namespace containing thin wrappers around SIMD instructions (SSE2/AVX) with a scalar fallback
+///@details All operations are done lane by lane with the same IEEE rounding as the scalar operations.
+///Kernels written once against a pack type are therefore bit-compatible between the SIMD and the scalar path
+namespace ion::utilities::simd
+{
+	using namespace types::type_literals;
+
+	namespace detail
+	{
+		///@brief A pack containing a single scalar value (scalar fallback)
+		template <typename T>
+		struct scalar_pack final
+		{
+			using value_type = T;
+			using mask_type = bool;
+			static constexpr auto width = 1;
+
+			T value{};
+
+
+			[[nodiscard]] static inline auto Load(const T *data) noexcept
+			{
+				return scalar_pack{*data};
+			}
+
+			[[nodiscard]] static inline auto Broadcast(T value) noexcept
+			{
+				return scalar_pack{value};
+			}
+
+			inline void Store(T *data) const noexcept
+			{
+				*data = value;
+			}
+
+
+			[[nodiscard]] friend inline auto operator+(scalar_pack x, scalar_pack y) noexcept { return scalar_pack{x.value + y.value}; }
+			[[nodiscard]] friend inline auto operator-(scalar_pack x, scalar_pack y) noexcept { return scalar_pack{x.value - y.value}; }
+			[[nodiscard]] friend inline auto operator*(scalar_pack x, scalar_pack y) noexcept { return scalar_pack{x.value * y.value}; }
+			[[nodiscard]] friend inline auto operator/(scalar_pack x, scalar_pack y) noexcept { return scalar_pack{x.value / y.value}; }
+
+			[[nodiscard]] friend inline auto operator<(scalar_pack x, scalar_pack y) noexcept { return x.value < y.value; }
+			[[nodiscard]] friend inline auto operator<=(scalar_pack x, scalar_pack y) noexcept { return x.value <= y.value; }
+			[[nodiscard]] friend inline auto operator>(scalar_pack x, scalar_pack y) noexcept { return x.value > y.value; }
+			[[nodiscard]] friend inline auto operator>=(scalar_pack x, scalar_pack y) noexcept { return x.value >= y.value; }
+
+			///@brief Returns x where mask is set, else y
+			[[nodiscard]] static inline auto Select(mask_type mask, scalar_pack x, scalar_pack y) noexcept
+			{
+				return mask ? x : y;
+			}
+
+			///@brief Returns a bit mask with one bit per lane
+			[[nodiscard]] static inline int Bits(mask_type mask) noexcept
+			{
+				return mask ? 1 : 0;
+			}
+		};
+
+
+		#if defined(ION_SIMD_SSE2)
+
+		///@brief A pack containing four single precision values (SSE2)
+		struct sse_pack final
+		{
+			using value_type = float32;
+			using mask_type = __m128;
+			static constexpr auto width = 4;
+
+			__m128 value;
+
+
+			[[nodiscard]] static inline auto Load(const float32 *data) noexcept
+			{
+				return sse_pack{_mm_loadu_ps(data)};
+			}
+
+			[[nodiscard]] static inline auto Broadcast(float32 value) noexcept
+			{
+				return sse_pack{_mm_set1_ps(value)};
+			}
+
+			inline void Store(float32 *data) const noexcept
+			{
+				_mm_storeu_ps(data, value);
+			}
+
+
+			[[nodiscard]] friend inline auto operator+(sse_pack x, sse_pack y) noexcept { return sse_pack{_mm_add_ps(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator-(sse_pack x, sse_pack y) noexcept { return sse_pack{_mm_sub_ps(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator*(sse_pack x, sse_pack y) noexcept { return sse_pack{_mm_mul_ps(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator/(sse_pack x, sse_pack y) noexcept { return sse_pack{_mm_div_ps(x.value, y.value)}; }
+
+			[[nodiscard]] friend inline auto operator<(sse_pack x, sse_pack y) noexcept { return _mm_cmplt_ps(x.value, y.value); }
+			[[nodiscard]] friend inline auto operator<=(sse_pack x, sse_pack y) noexcept { return _mm_cmple_ps(x.value, y.value); }
+			[[nodiscard]] friend inline auto operator>(sse_pack x, sse_pack y) noexcept { return _mm_cmpgt_ps(x.value, y.value); }
+			[[nodiscard]] friend inline auto operator>=(sse_pack x, sse_pack y) noexcept { return _mm_cmpge_ps(x.value, y.value); }
+
+			///@brief Returns x where mask is set, else y
+			[[nodiscard]] static inline auto Select(mask_type mask, sse_pack x, sse_pack y) noexcept
+			{
+				return sse_pack{_mm_or_ps(_mm_and_ps(mask, x.value), _mm_andnot_ps(mask, y.value))};
+			}
+
+			///@brief Returns a bit mask with one bit per lane
+			[[nodiscard]] static inline int Bits(mask_type mask) noexcept
+			{
+				return _mm_movemask_ps(mask);
+			}
+		};
+
+		#elif defined(ION_SIMD_AVX)
+
+		///@brief A pack containing eight single precision values (AVX)
+		struct avx_pack final
+		{
+			using value_type = float32;
+			using mask_type = __m256;
+			static constexpr auto width = 8;
+
+			__m256 value;
+
+
+			[[nodiscard]] static inline auto Load(const float32 *data) noexcept
+			{
+				return avx_pack{_mm256_loadu_ps(data)};
+			}
+
+			[[nodiscard]] static inline auto Broadcast(float32 value) noexcept
+			{
+				return avx_pack{_mm256_set1_ps(value)};
+			}
+
+			inline void Store(float32 *data) const noexcept
+			{
+				_mm256_storeu_ps(data, value);
+			}
+
+
+			[[nodiscard]] friend inline auto operator+(avx_pack x, avx_pack y) noexcept { return avx_pack{_mm256_add_ps(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator-(avx_pack x, avx_pack y) noexcept { return avx_pack{_mm256_sub_ps(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator*(avx_pack x, avx_pack y) noexcept { return avx_pack{_mm256_mul_ps(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator/(avx_pack x, avx_pack y) noexcept { return avx_pack{_mm256_div_ps(x.value, y.value)}; }
+
+			[[nodiscard]] friend inline auto operator<(avx_pack x, avx_pack y) noexcept { return _mm256_cmp_ps(x.value, y.value, _CMP_LT_OQ); }
+			[[nodiscard]] friend inline auto operator<=(avx_pack x, avx_pack y) noexcept { return _mm256_cmp_ps(x.value, y.value, _CMP_LE_OQ); }
+			[[nodiscard]] friend inline auto operator>(avx_pack x, avx_pack y) noexcept { return _mm256_cmp_ps(x.value, y.value, _CMP_GT_OQ); }
+			[[nodiscard]] friend inline auto operator>=(avx_pack x, avx_pack y) noexcept { return _mm256_cmp_ps(x.value, y.value, _CMP_GE_OQ); }
+
+			///@brief Returns x where mask is set, else y
+			[[nodiscard]] static inline auto Select(mask_type mask, avx_pack x, avx_pack y) noexcept
+			{
+				return avx_pack{_mm256_blendv_ps(y.value, x.value, mask)};
+			}
+
+			///@brief Returns a bit mask with one bit per lane
+			[[nodiscard]] static inline int Bits(mask_type mask) noexcept
+			{
+				return _mm256_movemask_ps(mask);
+			}
+		};
+
+		#endif
+
+
+		///@brief A pack containing a single character (scalar fallback)
+		///@details Comparisons returns a pack with all bits set in each lane that compares true
+		struct scalar_byte_pack final
+		{
+			static constexpr auto width = 1;
+
+			char value{};
+
+
+			[[nodiscard]] static inline auto Load(const char *data) noexcept
+			{
+				return scalar_byte_pack{*data};
+			}
+
+			[[nodiscard]] static inline auto Broadcast(char value) noexcept
+			{
+				return scalar_byte_pack{value};
+			}
+
+
+			[[nodiscard]] friend inline auto operator==(scalar_byte_pack x, scalar_byte_pack y) noexcept { return scalar_byte_pack{x.value == y.value ? '\xff' : '\0'}; }
+			[[nodiscard]] friend inline auto operator|(scalar_byte_pack x, scalar_byte_pack y) noexcept { return scalar_byte_pack{static_cast<char>(x.value | y.value)}; }
+			[[nodiscard]] friend inline auto operator&(scalar_byte_pack x, scalar_byte_pack y) noexcept { return scalar_byte_pack{static_cast<char>(x.value & y.value)}; }
+
+			///@brief Returns a pack with all bits set in each lane that is in range [first, last]
+			[[nodiscard]] inline auto InRange(char first, char last) const noexcept
+			{
+				return scalar_byte_pack{value >= first && value <= last ? '\xff' : '\0'};
+			}
+
+			///@brief Returns a bit mask with one bit per lane
+			[[nodiscard]] static inline unsigned int Bits(scalar_byte_pack mask) noexcept
+			{
+				return mask.value != 0 ? 1 : 0;
+			}
+		};
+
+
+		#if defined(ION_SIMD_BYTE_SSE2)
+
+		///@brief A pack containing sixteen characters (SSE2)
+		///@details Comparisons returns a pack with all bits set in each lane that compares true
+		struct sse_byte_pack final
+		{
+			static constexpr auto width = 16;
+
+			__m128i value;
+
+
+			[[nodiscard]] static inline auto Load(const char *data) noexcept
+			{
+				return sse_byte_pack{_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))};
+			}
+
+			[[nodiscard]] static inline auto Broadcast(char value) noexcept
+			{
+				return sse_byte_pack{_mm_set1_epi8(value)};
+			}
+
+
+			[[nodiscard]] friend inline auto operator==(sse_byte_pack x, sse_byte_pack y) noexcept { return sse_byte_pack{_mm_cmpeq_epi8(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator|(sse_byte_pack x, sse_byte_pack y) noexcept { return sse_byte_pack{_mm_or_si128(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator&(sse_byte_pack x, sse_byte_pack y) noexcept { return sse_byte_pack{_mm_and_si128(x.value, y.value)}; }
+
+			///@brief Returns a pack with all bits set in each lane that is in range [first, last]
+			///@details The given range must not contain the smallest or the largest char value
+			[[nodiscard]] inline auto InRange(char first, char last) const noexcept
+			{
+				return sse_byte_pack{_mm_and_si128(
+					_mm_cmpgt_epi8(value, _mm_set1_epi8(static_cast<char>(first - 1))),
+					_mm_cmplt_epi8(value, _mm_set1_epi8(static_cast<char>(last + 1))))};
+			}
+
+			///@brief Returns a bit mask with one bit per lane
+			[[nodiscard]] static inline unsigned int Bits(sse_byte_pack mask) noexcept
+			{
+				return static_cast<unsigned int>(_mm_movemask_epi8(mask.value));
+			}
+		};
+
+		#elif defined(ION_SIMD_BYTE_AVX2)
+
+		///@brief A pack containing thirty-two characters (AVX2)
+		///@details Comparisons returns a pack with all bits set in each lane that compares true
+		struct avx2_byte_pack final
+		{
+			static constexpr auto width = 32;
+
+			__m256i value;
+
+
+			[[nodiscard]] static inline auto Load(const char *data) noexcept
+			{
+				return avx2_byte_pack{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data))};
+			}
+
+			[[nodiscard]] static inline auto Broadcast(char value) noexcept
+			{
+				return avx2_byte_pack{_mm256_set1_epi8(value)};
+			}
+
+
+			[[nodiscard]] friend inline auto operator==(avx2_byte_pack x, avx2_byte_pack y) noexcept { return avx2_byte_pack{_mm256_cmpeq_epi8(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator|(avx2_byte_pack x, avx2_byte_pack y) noexcept { return avx2_byte_pack{_mm256_or_si256(x.value, y.value)}; }
+			[[nodiscard]] friend inline auto operator&(avx2_byte_pack x, avx2_byte_pack y) noexcept { return avx2_byte_pack{_mm256_and_si256(x.value, y.value)}; }
+
+			///@brief Returns a pack with all bits set in each lane that is in range [first, last]
+			///@details The given range must not contain the smallest or the largest char value
+			[[nodiscard]] inline auto InRange(char first, char last) const noexcept
+			{
+				return avx2_byte_pack{_mm256_and_si256(
+					_mm256_cmpgt_epi8(value, _mm256_set1_epi8(static_cast<char>(first - 1))),
+					_mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(last + 1)), value))};
+			}
+
+			///@brief Returns a bit mask with one bit per lane
+			[[nodiscard]] static inline unsigned int Bits(avx2_byte_pack mask) noexcept
+			{
+				return static_cast<unsigned int>(_mm256_movemask_epi8(mask.value));
+			}
+		};
+
+		#endif
+
+
+		template <typename Pack, typename Predicate>
+		inline auto find_first(std::string_view str, std::size_t off, bool match, Predicate &predicate) noexcept
+		{
+			for (; off + Pack::width <= std::size(str); off += Pack::width)
+			{
+				auto bits = Pack::Bits(predicate(Pack::Load(std::data(str) + off)));
+
+				if (!match)
+					bits = ~bits;
+
+				if (bits &= (Pack::width < 32 ? (1u << Pack::width) - 1 : ~0u); bits != 0)
+					return off + std::countr_zero(bits);
+			}
+
+			return off;
+		}
+	} //detail
+
+
+	///@brief The widest pack of real values supported by the target instruction set
+	#if defined(ION_SIMD_AVX)
+	using RealPack = detail::avx_pack;
+	#elif defined(ION_SIMD_SSE2)
+	using RealPack = detail::sse_pack;
+	#else
+	using RealPack = detail::scalar_pack<real>;
+	#endif
+
+	///@brief A pack containing a single real value
+	using ScalarPack = detail::scalar_pack<real>;
+
+	static_assert(std::is_same_v<RealPack::value_type, real>);
+
+
+	///@brief The widest pack of characters supported by the target instruction set
+	#if defined(ION_SIMD_BYTE_AVX2)
+	using BytePack = detail::avx2_byte_pack;
+	#elif defined(ION_SIMD_BYTE_SSE2)
+	using BytePack = detail::sse_byte_pack;
+	#else
+	using BytePack = detail::scalar_byte_pack;
+	#endif
+
+	///@brief A pack containing a single character
+	using ScalarBytePack = detail::scalar_byte_pack;
+
+
+	/**
+		@name Functions
+		@{
+	*/
+
+	///@brief Returns true if the target has SIMD support for real values
+	[[nodiscard]] constexpr auto IsVectorized() noexcept
+	{
+		return RealPack::width > 1;
+	}
+
+	///@brief Returns the smallest value of x and y, lane by lane
+	///@details Returns x if x < y, else y (same as std::min with swapped arguments)
+	template <typename Pack>
+	[[nodiscard]] inline auto Min(Pack x, Pack y) noexcept
+	{
+		return Pack::Select(y < x, y, x);
+	}
+
+	///@brief Returns the largest value of x and y, lane by lane
+	template <typename Pack>
+	[[nodiscard]] inline auto Max(Pack x, Pack y) noexcept
+	{
+		return Pack::Select(x < y, y, x);
+	}
+
+	///@brief Clamps x to range [0.0, 1.0], lane by lane
+	///@details Gives the same result as math::Saturate
+	template <typename Pack>
+	[[nodiscard]] inline auto Saturate(Pack x) noexcept
+	{
+		auto zero = Pack::Broadcast(0.0_r);
+		auto one = Pack::Broadcast(1.0_r);
+		return Pack::Select(x < zero, zero, Pack::Select(one < x, one, x));
+	}
+
+	///@brief Calls the given function for each pack in range [first, last)
+	///@details The given function is called with RealPack as template argument for each whole pack,
+	///and with ScalarPack for each remaining value (tail)
+	template <typename Function>
+	inline void ForEach(int first, int last, Function &&function) noexcept(noexcept(function.template operator()<ScalarPack>(first)))
+	{
+		auto i = first;
+
+		if constexpr (RealPack::width > 1)
+		{
+			for (; i + RealPack::width <= last; i += RealPack::width)
+				function.template operator()<RealPack>(i);
+		}
+
+		for (; i < last; ++i)
+			function.template operator()<ScalarPack>(i);
+	}
+
+
+	///@brief Returns the offset of the first character in the given string (starting at offset) that matches the given predicate
+	///@details The given predicate is called with a BytePack for each whole pack, and with a ScalarBytePack for each remaining character (tail).
+	///Returns the size of the given string if no characters matches
+	template <typename Predicate>
+	[[nodiscard]] inline auto FindFirstOf(std::string_view str, std::size_t off, Predicate &&predicate) noexcept
+	{
+		off = detail::find_first<BytePack>(str, off, true, predicate);
+		return detail::find_first<ScalarBytePack>(str, off, true, predicate);
+	}
+
+	///@brief Returns the offset of the first character in the given string (starting at offset) that does not match the given predicate
+	///@details The given predicate is called with a BytePack for each whole pack, and with a ScalarBytePack for each remaining character (tail).
+	///Returns the size of the given string if all characters matches
+	template <typename Predicate>
+	[[nodiscard]] inline auto FindFirstNotOf(std::string_view str, std::size_t off, Predicate &&predicate) noexcept
+	{
+		off = detail::find_first<BytePack>(str, off, false, predicate);
+		return detail::find_first<ScalarBytePack>(str, off, false, predicate);
+	}
+
+	///@brief Returns the number of occurrences of the given character in the given string
+	[[nodiscard]] inline auto Count(std::string_view str, char c) noexcept
+	{
+		auto count = 0;
+		std::size_t off = 0;
+
+		if constexpr (BytePack::width > 1)
+		{
+			for (auto x = BytePack::Broadcast(c); off + BytePack::width <= std::size(str); off += BytePack::width)
+				count += std::popcount(BytePack::Bits(BytePack::Load(std::data(str) + off) == x));
+		}
+
+		for (; off < std::size(str); ++off)
+			count += static_cast<int>(str[off] == c);
+
+		return count;
+	}
+
+	///@}
+} //ion::utilities::simd
+
+#endif
\ No newline at end of file